@@ -131,10 +131,11 @@ int main(int, const char*[])
         gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements);
         gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
         gvk::cppgen::ExecuteCommandStructureGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
+        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements);
+        gvk::cppgen::StructureEnumeratePointersGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
         gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements, "gvk-command-structures/detail/make-tuple-manual.hpp");
         gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
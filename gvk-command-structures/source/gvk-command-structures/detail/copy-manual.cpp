@@ -48,7 +48,7 @@ GvkCommandStructureBuildAccelerationStructuresKHR create_structure_copy<GvkComma
     auto result = obj;
     result.pInfos = create_dynamic_array_copy(obj.infoCount, obj.pInfos, pAllocator);
     pAllocator = validate_allocation_callbacks(pAllocator);
-    auto ppBuildRangeInfos = (VkAccelerationStructureBuildRangeInfoKHR**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(VkAccelerationStructureBuildRangeInfoKHR*), 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    auto ppBuildRangeInfos = (VkAccelerationStructureBuildRangeInfoKHR**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(VkAccelerationStructureBuildRangeInfoKHR*), alignof(VkAccelerationStructureBuildRangeInfoKHR*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     for (uint32_t i = 0; i < obj.infoCount; ++i) {
         ppBuildRangeInfos[i] = create_dynamic_array_copy(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i], pAllocator);
     }
@@ -66,6 +66,17 @@ void destroy_structure_copy<GvkCommandStructureBuildAccelerationStructuresKHR>(c
     destroy_dynamic_array_copy(obj.infoCount, obj.ppBuildRangeInfos, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureBuildAccelerationStructuresKHR>(const GvkCommandStructureBuildAccelerationStructuresKHR& obj)
+{
+    size_t size = get_dynamic_array_copy_size(obj.infoCount, obj.pInfos);
+    size += get_allocation_size<VkAccelerationStructureBuildRangeInfoKHR*>(obj.infoCount);
+    for (uint32_t i = 0; i < obj.infoCount; ++i) {
+        size += get_dynamic_array_copy_size(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i]);
+    }
+    return size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR
 template <>
@@ -76,7 +87,7 @@ GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR create_structure_co
     result.pIndirectDeviceAddresses = create_dynamic_array_copy(obj.infoCount, obj.pIndirectDeviceAddresses, pAllocator);
     result.pIndirectStrides = create_dynamic_array_copy(obj.infoCount, obj.pIndirectStrides, pAllocator);
     pAllocator = validate_allocation_callbacks(pAllocator);
-    auto ppMaxPrimitiveCounts = (uint32_t**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(uint32_t*), 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    auto ppMaxPrimitiveCounts = (uint32_t**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(uint32_t*), alignof(uint32_t*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     for (uint32_t i = 0; i < obj.infoCount; ++i) {
         ppMaxPrimitiveCounts[i] = create_dynamic_array_copy(obj.pInfos[i].geometryCount, obj.ppMaxPrimitiveCounts[i], pAllocator);
     }
@@ -96,6 +107,19 @@ void destroy_structure_copy<GvkCommandStructureCmdBuildAccelerationStructuresInd
     destroy_dynamic_array_copy(obj.infoCount, obj.ppMaxPrimitiveCounts, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR>(const GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR& obj)
+{
+    size_t size = get_dynamic_array_copy_size(obj.infoCount, obj.pInfos);
+    size += get_dynamic_array_copy_size(obj.infoCount, obj.pIndirectDeviceAddresses);
+    size += get_dynamic_array_copy_size(obj.infoCount, obj.pIndirectStrides);
+    size += get_allocation_size<uint32_t*>(obj.infoCount);
+    for (uint32_t i = 0; i < obj.infoCount; ++i) {
+        size += get_dynamic_array_copy_size(obj.pInfos[i].geometryCount, obj.ppMaxPrimitiveCounts[i]);
+    }
+    return size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdBuildAccelerationStructuresKHR
 template <>
@@ -104,7 +128,7 @@ GvkCommandStructureCmdBuildAccelerationStructuresKHR create_structure_copy<GvkCo
     auto result = obj;
     result.pInfos = create_dynamic_array_copy(obj.infoCount, obj.pInfos, pAllocator);
     pAllocator = validate_allocation_callbacks(pAllocator);
-    auto ppBuildRangeInfos = (VkAccelerationStructureBuildRangeInfoKHR**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(VkAccelerationStructureBuildRangeInfoKHR*), 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    auto ppBuildRangeInfos = (VkAccelerationStructureBuildRangeInfoKHR**)pAllocator->pfnAllocation(pAllocator->pUserData, obj.infoCount * sizeof(VkAccelerationStructureBuildRangeInfoKHR*), alignof(VkAccelerationStructureBuildRangeInfoKHR*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     for (uint32_t i = 0; i < obj.infoCount; ++i) {
         ppBuildRangeInfos[i] = create_dynamic_array_copy(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i], pAllocator);
     }
@@ -122,6 +146,17 @@ void destroy_structure_copy<GvkCommandStructureCmdBuildAccelerationStructuresKHR
     destroy_dynamic_array_copy(obj.infoCount, obj.ppBuildRangeInfos, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdBuildAccelerationStructuresKHR>(const GvkCommandStructureCmdBuildAccelerationStructuresKHR& obj)
+{
+    size_t size = get_dynamic_array_copy_size(obj.infoCount, obj.pInfos);
+    size += get_allocation_size<VkAccelerationStructureBuildRangeInfoKHR*>(obj.infoCount);
+    for (uint32_t i = 0; i < obj.infoCount; ++i) {
+        size += get_dynamic_array_copy_size(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i]);
+    }
+    return size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdPushConstants
 template <>
@@ -138,6 +173,12 @@ void destroy_structure_copy<GvkCommandStructureCmdPushConstants>(const GvkComman
     destroy_dynamic_array_copy(obj.size, (const uint8_t*)obj.pValues, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdPushConstants>(const GvkCommandStructureCmdPushConstants& obj)
+{
+    return get_dynamic_array_copy_size(obj.size, (const uint8_t*)obj.pValues);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdSetBlendConstants
 template <>
@@ -153,6 +194,13 @@ void destroy_structure_copy<GvkCommandStructureCmdSetBlendConstants>(const GvkCo
     // NOOP :
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdSetBlendConstants>(const GvkCommandStructureCmdSetBlendConstants&)
+{
+    // NOOP :
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdSetFragmentShadingRateEnumNV
 template <>
@@ -168,6 +216,13 @@ void destroy_structure_copy<GvkCommandStructureCmdSetFragmentShadingRateEnumNV>(
     // NOOP :
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdSetFragmentShadingRateEnumNV>(const GvkCommandStructureCmdSetFragmentShadingRateEnumNV&)
+{
+    // NOOP :
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdSetFragmentShadingRateKHR
 template <>
@@ -184,6 +239,12 @@ void destroy_structure_copy<GvkCommandStructureCmdSetFragmentShadingRateKHR>(con
     destroy_dynamic_array_copy(1, obj.pFragmentSize, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdSetFragmentShadingRateKHR>(const GvkCommandStructureCmdSetFragmentShadingRateKHR& obj)
+{
+    return get_dynamic_array_copy_size(1, obj.pFragmentSize);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureCmdSetSampleMaskEXT
 template <>
@@ -200,6 +261,12 @@ void destroy_structure_copy<GvkCommandStructureCmdSetSampleMaskEXT>(const GvkCom
     destroy_dynamic_array_copy(std::max(1, obj.samples / 32), obj.pSampleMask, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureCmdSetSampleMaskEXT>(const GvkCommandStructureCmdSetSampleMaskEXT& obj)
+{
+    return get_dynamic_array_copy_size(std::max(1, obj.samples / 32), obj.pSampleMask);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // GvkCommandStructureGetAccelerationStructureBuildSizesKHR
 template <>
@@ -220,5 +287,14 @@ void destroy_structure_copy<GvkCommandStructureGetAccelerationStructureBuildSize
     destroy_dynamic_array_copy(1, obj.pSizeInfo, pAllocator);
 }
 
+template <>
+size_t get_structure_copy_size<GvkCommandStructureGetAccelerationStructureBuildSizesKHR>(const GvkCommandStructureGetAccelerationStructureBuildSizesKHR& obj)
+{
+    size_t size = get_dynamic_array_copy_size(1, obj.pBuildInfo);
+    size += get_dynamic_array_copy_size(obj.pBuildInfo->geometryCount, obj.pMaxPrimitiveCounts);
+    size += get_dynamic_array_copy_size(1, obj.pSizeInfo);
+    return size;
+}
+
 } // namespace detail
 } // namespace gvk
@@ -0,0 +1,161 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-command-structures/generated/command-structure-enumerate-pointers.hpp"
+#include "gvk-structures/generated/core-structure-enumerate-pointers.hpp"
+
+namespace gvk {
+namespace detail {
+
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(GvkCommandStructureAllocateCommandBuffers)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(GvkCommandStructureAllocateDescriptorSets)
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(GvkCommandStructureCreateXlibSurfaceKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(GvkCommandStructureGetPhysicalDeviceXlibPresentationSupportKHR)
+#endif // VK_USE_PLATFORM_XLIB_KHR
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureBuildAccelerationStructuresKHR>(const GvkCommandStructureBuildAccelerationStructuresKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.device, callback);
+    enumerate_value(obj.deferredOperation, callback);
+    enumerate_value(obj.infoCount, callback);
+    enumerate_pointer(obj.pInfos, callback);
+    enumerate_dynamic_structure_array_pointers(obj.infoCount, obj.pInfos, callback);
+    enumerate_pointer(obj.ppBuildRangeInfos, callback);
+    if (obj.pInfos && obj.ppBuildRangeInfos) {
+        for (uint32_t i = 0; i < obj.infoCount; ++i) {
+            enumerate_pointer(obj.ppBuildRangeInfos[i], callback);
+            enumerate_dynamic_structure_array_pointers(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i], callback);
+        }
+    }
+    enumerate_value(obj.result, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR>(const GvkCommandStructureCmdBuildAccelerationStructuresIndirectKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.infoCount, callback);
+    enumerate_pointer(obj.pInfos, callback);
+    enumerate_dynamic_structure_array_pointers(obj.infoCount, obj.pInfos, callback);
+    enumerate_pointer(obj.pIndirectDeviceAddresses, callback);
+    enumerate_pointer(obj.pIndirectStrides, callback);
+    enumerate_pointer(obj.ppMaxPrimitiveCounts, callback);
+    enumerate_dynamic_pointer_array_pointers(obj.infoCount, obj.ppMaxPrimitiveCounts, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdBuildAccelerationStructuresKHR>(const GvkCommandStructureCmdBuildAccelerationStructuresKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.infoCount, callback);
+    enumerate_pointer(obj.pInfos, callback);
+    enumerate_dynamic_structure_array_pointers(obj.infoCount, obj.pInfos, callback);
+    enumerate_pointer(obj.ppBuildRangeInfos, callback);
+    if (obj.pInfos && obj.ppBuildRangeInfos) {
+        for (uint32_t i = 0; i < obj.infoCount; ++i) {
+            enumerate_pointer(obj.ppBuildRangeInfos[i], callback);
+            enumerate_dynamic_structure_array_pointers(obj.pInfos[i].geometryCount, obj.ppBuildRangeInfos[i], callback);
+        }
+    }
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdPushConstants>(const GvkCommandStructureCmdPushConstants& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.layout, callback);
+    enumerate_value(obj.stageFlags, callback);
+    enumerate_value(obj.offset, callback);
+    enumerate_value(obj.size, callback);
+    enumerate_pointer(obj.pValues, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdSetBlendConstants>(const GvkCommandStructureCmdSetBlendConstants& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.blendConstants, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdSetFragmentShadingRateEnumNV>(const GvkCommandStructureCmdSetFragmentShadingRateEnumNV& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.shadingRate, callback);
+    enumerate_value(obj.combinerOps, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdSetFragmentShadingRateKHR>(const GvkCommandStructureCmdSetFragmentShadingRateKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_pointer(obj.pFragmentSize, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pFragmentSize, callback);
+    enumerate_value(obj.combinerOps, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureCmdSetSampleMaskEXT>(const GvkCommandStructureCmdSetSampleMaskEXT& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.commandBuffer, callback);
+    enumerate_value(obj.samples, callback);
+    enumerate_pointer(obj.pSampleMask, callback);
+}
+
+template <>
+void enumerate_structure_pointers<GvkCommandStructureGetAccelerationStructureBuildSizesKHR>(const GvkCommandStructureGetAccelerationStructureBuildSizesKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_value(obj.device, callback);
+    enumerate_value(obj.buildType, callback);
+    enumerate_pointer(obj.pBuildInfo, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pBuildInfo, callback);
+    enumerate_pointer(obj.pMaxPrimitiveCounts, callback);
+    enumerate_pointer(obj.pSizeInfo, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pSizeInfo, callback);
+}
+
+} // namespace detail
+} // namespace gvk
@@ -36,11 +36,20 @@ namespace cppgen {
 class StructureComparisonOperatorsGenerator final
 {
 public:
-    static void generate(const ApiElementCollectionInfo& apiElements);
+    static void generate(
+        const xml::Manifest& manifest,
+        const ApiElementCollectionInfo& apiElements,
+        const std::string& manualImplementationInclude = std::string()
+    );
 
 private:
-    static void generate_header(FileGenerator& file, const ApiElementCollectionInfo& apiElements);
-    static void generate_source(FileGenerator& file, const ApiElementCollectionInfo& apiElements);
+    static void generate_header(
+        FileGenerator& file,
+        const xml::Manifest& manifest,
+        const ApiElementCollectionInfo& apiElements,
+        const std::string& manualImplementationInclude
+    );
+    static void generate_source(FileGenerator& file, const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements);
 };
 
 } // namespace cppgen
@@ -26,12 +26,15 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "gvk-cppgen/api-element-collection-info.hpp"
 #include "gvk-cppgen/file-generator.hpp"
 #include "gvk-string.hpp"
 #include "gvk-xml.hpp"
 
+#include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace gvk {
 namespace cppgen {
@@ -76,5 +79,17 @@ void generate_object_type_switch(
     const std::string& defaultProcessor = std::string()
 );
 
+std::vector<const xml::Structure*> get_flat_structures(
+    const xml::Manifest& manifest,
+    const ApiElementCollectionInfo& apiElements,
+    const std::function<bool(const xml::Parameter&)>& isFlatMember
+);
+
+void generate_flat_structure_traits(
+    FileGenerator& file,
+    const std::vector<const xml::Structure*>& flatStructures,
+    const std::string& traitName
+);
+
 } // namespace cppgen
 } // namespace gvk
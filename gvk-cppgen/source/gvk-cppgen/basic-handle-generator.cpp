@@ -358,6 +358,8 @@ void BasicHandleGenerator::generate_control_block_declaration(FileGenerator& fil
 R"(class {handleName}::ControlBlock final
 {
 public:
+    static constexpr size_t ReferenceRegistryShardCount = 64;
+    static constexpr bool ReferenceUsesPoolAllocator = true;
     ControlBlock() = default;
     ~ControlBlock();
 )", replacements);
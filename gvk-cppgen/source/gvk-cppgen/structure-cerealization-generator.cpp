@@ -172,6 +172,19 @@ void StructureCerealizationGenerator::generate(
         file << "#include \"" << manualImplementationInclude << "\"" << std::endl;
     }
     file << std::endl;
+    {
+        // NOTE : Handles aren't flat because they're cerealized individually via
+        //  gvk::detail::cerealize_handle().
+        auto flatStructures = get_flat_structures(manifest, apiElements,
+            [&](const xml::Parameter& member)
+            {
+                return !manifest.handles.count(member.unqualifiedType);
+            }
+        );
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+        generate_flat_structure_traits(file, flatStructures, "IsFlatCerealizable");
+    }
+    file << std::endl;
     NamespaceGenerator namespaceGenerator(file, "cereal");
     for (const auto& structure : apiElements.structures) {
         if (structure.alias.empty() && !apiElements.manuallyImplemented.count(structure.name)) {
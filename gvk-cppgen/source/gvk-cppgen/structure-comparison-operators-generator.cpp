@@ -29,12 +29,216 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/compile-guard-generator.hpp"
 #include "gvk-cppgen/module-generator.hpp"
 #include "gvk-cppgen/namespace-generator.hpp"
+#include "gvk-cppgen/utilities.hpp"
 #include "gvk-string.hpp"
 
+#include <cassert>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace gvk {
 namespace cppgen {
 
-void StructureComparisonOperatorsGenerator::generate(const ApiElementCollectionInfo& apiElements)
+class StructureMemberComparisonGenerator final
+    : public BasicStructureMemberProcessorGenerator
+{
+public:
+    enum class Operation
+    {
+        Equal,
+        Compare,
+        Hash,
+    };
+
+    StructureMemberComparisonGenerator(Operation operation)
+        : mOperation { operation }
+    {
+    }
+
+protected:
+    std::string generate_pnext_processor() const override final
+    {
+        return generate_processor("_pnext", "obj.{memberName}");
+    }
+
+    std::string generate_void_pointer_processor() const override final
+    {
+        return generate_processor("", "(uint64_t)obj.{memberName}");
+    }
+
+    std::string generate_function_pointer_processor() const override final
+    {
+        return generate_processor("", "(uint64_t)obj.{memberName}");
+    }
+
+    std::string generate_dynamic_handle_array_processor() const override final
+    {
+        return generate_processor("_array", "gvk::detail::get_count(obj.{memberLength}), obj.{memberName}");
+    }
+
+    std::string generate_dynamic_structure_array_processor() const override final
+    {
+        return generate_processor("_array", "gvk::detail::get_count(obj.{memberLength}), obj.{memberName}");
+    }
+
+    std::string generate_dynamic_enumeration_array_processor() const override final
+    {
+        return generate_processor("_array", "gvk::detail::get_count(obj.{memberLength}), obj.{memberName}");
+    }
+
+    std::string generate_dynamic_string_processor() const override final
+    {
+        return generate_processor("_string", "obj.{memberName}");
+    }
+
+    std::string generate_dynamic_string_array_processor() const override final
+    {
+        return generate_processor("_string_array", "gvk::detail::get_count(obj.{memberLength}), obj.{memberName}");
+    }
+
+    std::string generate_dynamic_primitive_array_processor() const override final
+    {
+        return generate_processor("_array", "gvk::detail::get_count(obj.{memberLength}), obj.{memberName}");
+    }
+
+    std::string generate_handle_pointer_processor() const override final
+    {
+        return generate_processor("_array", "1, obj.{memberName}");
+    }
+
+    std::string generate_structure_pointer_processor() const override final
+    {
+        return generate_processor("_array", "1, obj.{memberName}");
+    }
+
+    std::string generate_enumeration_pointer_processor() const override final
+    {
+        return generate_processor("_array", "1, obj.{memberName}");
+    }
+
+    std::string generate_primitive_pointer_processor() const override final
+    {
+        return generate_processor("_array", "1, obj.{memberName}");
+    }
+
+    std::string generate_static_handle_array_processor() const override final
+    {
+        return generate_processor("_array", "{memberLength}, obj.{memberName}");
+    }
+
+    std::string generate_static_structure_array_processor() const override final
+    {
+        return generate_processor("_array", "{memberLength}, obj.{memberName}");
+    }
+
+    std::string generate_static_enumeration_array_processor() const override final
+    {
+        return generate_processor("_array", "{memberLength}, obj.{memberName}");
+    }
+
+    std::string generate_static_string_processor() const override final
+    {
+        return generate_processor("_array", "{memberLength}, obj.{memberName}");
+    }
+
+    std::string generate_static_primitive_array_processor() const override final
+    {
+        return generate_processor("_array", "{memberLength}, obj.{memberName}");
+    }
+
+    std::string generate_handle_processor() const override final
+    {
+        return generate_processor("", "obj.{memberName}");
+    }
+
+    std::string generate_structure_processor() const override final
+    {
+        return generate_processor("", "obj.{memberName}");
+    }
+
+    std::string generate_enumeration_processor() const override final
+    {
+        return generate_processor("", "obj.{memberName}");
+    }
+
+    std::string generate_flags_processor() const override final
+    {
+        return generate_processor("", "obj.{memberName}");
+    }
+
+    std::string generate_primitive_processor() const override final
+    {
+        return generate_processor("", "obj.{memberName}");
+    }
+
+private:
+    std::string generate_processor(const std::string& functionSuffix, const std::string& arguments) const
+    {
+        // NOTE : arguments refers to the member being processed via "obj.", Equal
+        //  and Compare processors expand arguments for both lhs and rhs.
+        switch (mOperation) {
+        case Operation::Equal: {
+            return
+                "if (!gvk::detail::equal" + functionSuffix + "(" +
+                string::replace(arguments, "obj.", "lhs.") + ", " + string::replace(arguments, "obj.", "rhs.") + ")) {\n"
+                "    return false;\n"
+                "}";
+        } break;
+        case Operation::Compare: {
+            return
+                "if (auto result = gvk::detail::compare" + functionSuffix + "(" +
+                string::replace(arguments, "obj.", "lhs.") + ", " + string::replace(arguments, "obj.", "rhs.") + ")) {\n"
+                "    return result;\n"
+                "}";
+        } break;
+        case Operation::Hash: {
+            return "result = gvk::detail::hash_combine(result, gvk::detail::hash" + functionSuffix + "(" + arguments + "));";
+        } break;
+        default: {
+            assert(false && "Unserviced StructureMemberComparisonGenerator::Operation; gvk maintenance required");
+        } break;
+        }
+        return std::string();
+    }
+
+    Operation mOperation { };
+};
+
+static std::vector<const xml::Structure*> get_bitwise_comparable_structures(const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    return get_flat_structures(manifest, apiElements,
+        [](const xml::Parameter& member)
+        {
+            // NOTE : Floating point members aren't bitwise comparable because 0.0
+            //  and -0.0 are equal and NaN isn't equal to itself.
+            return member.unqualifiedType != "float" && member.unqualifiedType != "double";
+        }
+    );
+}
+
+static void generate_member_processors(
+    FileGenerator& file,
+    const xml::Manifest& manifest,
+    const xml::Structure& structure,
+    StructureMemberComparisonGenerator::Operation operation,
+    const std::string& indentation
+)
+{
+    for (const auto& member : structure.members) {
+        CompileGuardGenerator memberCompileGuardGenerator(file, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
+        auto source = StructureMemberComparisonGenerator(operation).generate(manifest, member);
+        for (const auto& line : string::split(source, "\n")) {
+            file << indentation << line << std::endl;
+        }
+    }
+}
+
+void StructureComparisonOperatorsGenerator::generate(
+    const xml::Manifest& manifest,
+    const ApiElementCollectionInfo& apiElements,
+    const std::string& manualImplementationInclude
+)
 {
     ModuleGenerator module(
         apiElements.includePath,
@@ -42,45 +246,151 @@ void StructureComparisonOperatorsGenerator::generate(const ApiElementCollectionI
         apiElements.sourcePath,
         apiElements.name + "-structure-comparison-operators"
     );
-    generate_header(module.header, apiElements);
-    generate_source(module.source, apiElements);
+    generate_header(module.header, manifest, apiElements, manualImplementationInclude);
+    generate_source(module.source, manifest, apiElements);
 }
 
-void StructureComparisonOperatorsGenerator::generate_header(FileGenerator& file, const ApiElementCollectionInfo& apiElements)
+void StructureComparisonOperatorsGenerator::generate_header(
+    FileGenerator& file,
+    const xml::Manifest& manifest,
+    const ApiElementCollectionInfo& apiElements,
+    const std::string& manualImplementationInclude
+)
 {
     file << "#include \"gvk-defines.hpp\"" << std::endl;
     for (const auto& include : apiElements.headerIncludes) {
         file << "#include \"" << include << "\"" << std::endl;
     }
+    file << "#include \"gvk-structures/detail/comparison-utilities.hpp\"" << std::endl;
+    if (!manualImplementationInclude.empty()) {
+        file << "#include \"" << manualImplementationInclude << "\"" << std::endl;
+    }
+    file << std::endl;
+    {
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+        generate_flat_structure_traits(file, get_bitwise_comparable_structures(manifest, apiElements), "IsBitwiseComparable");
+        for (const auto& structure : apiElements.structures) {
+            if (structure.alias.empty()) {
+                CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+                file << string::replace(
+R"(template <> int compare<{structureName}>(const {structureName}& lhs, const {structureName}& rhs);
+template <> uint64_t hash<{structureName}>(const {structureName}& obj);)", "{structureName}", structure.name) << std::endl;
+            }
+        }
+        file << std::endl;
+    }
     file << std::endl;
     for (const auto& structure : apiElements.structures) {
-        CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
-        file << string::replace(
+        if (structure.alias.empty()) {
+            CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+            file << string::replace(
 R"(bool operator==(const {structureName}& lhs, const {structureName}& rhs);
 bool operator!=(const {structureName}& lhs, const {structureName}& rhs);
 bool operator<(const {structureName}& lhs, const {structureName}& rhs);
 bool operator>(const {structureName}& lhs, const {structureName}& rhs);
 bool operator<=(const {structureName}& lhs, const {structureName}& rhs);
 bool operator>=(const {structureName}& lhs, const {structureName}& rhs);)", "{structureName}", structure.name) << std::endl;
+        }
     }
 }
 
-void StructureComparisonOperatorsGenerator::generate_source(FileGenerator& file, const ApiElementCollectionInfo& apiElements)
+void StructureComparisonOperatorsGenerator::generate_source(FileGenerator& file, const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
 {
     for (const auto& include : apiElements.sourceIncludes) {
         file << "#include \"" << include << "\"" << std::endl;
     }
     file << "#include \"" << apiElements.includePrefix << apiElements.name << "-structure-make-tuple.hpp" << "\"" << std::endl;
+    file << "#include \"gvk-structures/detail/get-count.hpp\"" << std::endl;
+    file << std::endl;
+    file << "#include <cstring>" << std::endl;
     file << std::endl;
+    std::set<std::string> bitwiseComparableStructures;
+    for (const auto& pStructure : get_bitwise_comparable_structures(manifest, apiElements)) {
+        bitwiseComparableStructures.insert(pStructure->name);
+    }
+    {
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+        for (const auto& structure : apiElements.structures) {
+            if (structure.alias.empty()) {
+                file << std::endl;
+                CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+                if (apiElements.manuallyImplemented.count(structure.name)) {
+                    // NOTE : Manually implemented structures are compared and hashed via
+                    //  their manually implemented make_tuple().
+                    file << string::replace(
+R"(template <>
+int compare<{structureName}>(const {structureName}& lhs, const {structureName}& rhs)
+{
+    auto lhsTuple = gvk::make_tuple(lhs);
+    auto rhsTuple = gvk::make_tuple(rhs);
+    return lhsTuple < rhsTuple ? -1 : (rhsTuple < lhsTuple ? 1 : 0);
+}
+
+template <>
+uint64_t hash<{structureName}>(const {structureName}& obj)
+{
+    return hash_tuple(gvk::make_tuple(obj));
+})", "{structureName}", structure.name) << std::endl;
+                } else {
+                    file << "template <>" << std::endl;
+                    file << string::replace("int compare<{structureName}>(const {structureName}& lhs, const {structureName}& rhs)", "{structureName}", structure.name) << std::endl;
+                    file << "{" << std::endl;
+                    generate_member_processors(file, manifest, structure, StructureMemberComparisonGenerator::Operation::Compare, "    ");
+                    file << "    return 0;" << std::endl;
+                    file << "}" << std::endl;
+                    file << std::endl;
+                    file << "template <>" << std::endl;
+                    file << string::replace("uint64_t hash<{structureName}>(const {structureName}& obj)", "{structureName}", structure.name) << std::endl;
+                    file << "{" << std::endl;
+                    if (bitwiseComparableStructures.count(structure.name)) {
+                        file << string::replace("    if constexpr (IsBitwiseComparable<{structureName}>::value) {", "{structureName}", structure.name) << std::endl;
+                        file << "        return hash_bytes(&obj, sizeof(obj));" << std::endl;
+                        file << "    } else {" << std::endl;
+                        file << "        uint64_t result = 0;" << std::endl;
+                        generate_member_processors(file, manifest, structure, StructureMemberComparisonGenerator::Operation::Hash, "        ");
+                        file << "        return result;" << std::endl;
+                        file << "    }" << std::endl;
+                    } else {
+                        file << "    uint64_t result = 0;" << std::endl;
+                        generate_member_processors(file, manifest, structure, StructureMemberComparisonGenerator::Operation::Hash, "    ");
+                        file << "    return result;" << std::endl;
+                    }
+                    file << "}" << std::endl;
+                }
+            }
+        }
+        file << std::endl;
+    }
     for (const auto& structure : apiElements.structures) {
-        CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
-        file << string::replace(
-R"(bool operator==(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) == gvk::make_tuple(rhs); }
-bool operator!=(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) != gvk::make_tuple(rhs); }
-bool operator<(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) < gvk::make_tuple(rhs); }
-bool operator>(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) > gvk::make_tuple(rhs); }
-bool operator<=(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) <= gvk::make_tuple(rhs); }
-bool operator>=(const {structureName}& lhs, const {structureName}& rhs) { return gvk::make_tuple(lhs) >= gvk::make_tuple(rhs); })", "{structureName}", structure.name) << std::endl;
+        if (structure.alias.empty()) {
+            file << std::endl;
+            CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+            file << string::replace("bool operator==(const {structureName}& lhs, const {structureName}& rhs)", "{structureName}", structure.name) << std::endl;
+            file << "{" << std::endl;
+            if (apiElements.manuallyImplemented.count(structure.name)) {
+                file << "    return gvk::make_tuple(lhs) == gvk::make_tuple(rhs);" << std::endl;
+            } else if (bitwiseComparableStructures.count(structure.name)) {
+                // NOTE : Bitwise comparable candidates fall back to member-wise
+                //  comparison if the compiler inserts padding.
+                file << string::replace("    if constexpr (gvk::detail::IsBitwiseComparable<{structureName}>::value) {", "{structureName}", structure.name) << std::endl;
+                file << "        return !memcmp(&lhs, &rhs, sizeof(lhs));" << std::endl;
+                file << "    } else {" << std::endl;
+                generate_member_processors(file, manifest, structure, StructureMemberComparisonGenerator::Operation::Equal, "        ");
+                file << "        return true;" << std::endl;
+                file << "    }" << std::endl;
+            } else {
+                generate_member_processors(file, manifest, structure, StructureMemberComparisonGenerator::Operation::Equal, "    ");
+                file << "    return true;" << std::endl;
+            }
+            file << "}" << std::endl;
+            file << std::endl;
+            file << string::replace(
+R"(bool operator!=(const {structureName}& lhs, const {structureName}& rhs) { return !(lhs == rhs); }
+bool operator<(const {structureName}& lhs, const {structureName}& rhs) { return gvk::detail::compare(lhs, rhs) < 0; }
+bool operator>(const {structureName}& lhs, const {structureName}& rhs) { return gvk::detail::compare(lhs, rhs) > 0; }
+bool operator<=(const {structureName}& lhs, const {structureName}& rhs) { return gvk::detail::compare(lhs, rhs) <= 0; }
+bool operator>=(const {structureName}& lhs, const {structureName}& rhs) { return gvk::detail::compare(lhs, rhs) >= 0; })", "{structureName}", structure.name) << std::endl;
+        }
     }
 }
 
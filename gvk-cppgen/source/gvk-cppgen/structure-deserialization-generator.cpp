@@ -83,11 +83,12 @@ void StructureDeserializationGenerator::generate_source(FileGenerator& file, con
             std::stringstream strStrm;
             strStrm << "void deserialize(std::istream& istrm, const VkAllocationCallbacks* pAllocator, Auto<{structureType}>& obj)" << std::endl;
             strStrm << "{"                                                                                                          << std::endl;
-            strStrm << "    assert(!pAllocator && \"TODO : VkAllocationCallbacks need to be hooked up in gvk::Auto <>\");"          << std::endl;
-            strStrm << "    obj.reset();"                                                                                           << std::endl;
+            strStrm << "    {structureType} deserialized { };"                                                                      << std::endl;
             strStrm << "    cereal::BinaryInputArchive archive(istrm);"                                                             << std::endl;
             strStrm << "    detail::tlpDecerealizationAllocator = detail::validate_allocation_callbacks(pAllocator);"               << std::endl;
-            strStrm << "    archive(const_cast<{structureType}&>(*obj));"                                                           << std::endl;
+            strStrm << "    archive(deserialized);"                                                                                 << std::endl;
+            strStrm << "    obj = Auto<{structureType}>(deserialized, pAllocator);"                                                 << std::endl;
+            strStrm << "    detail::destroy_structure_copy(deserialized, pAllocator);"                                              << std::endl;
             strStrm << "}"                                                                                                          << std::endl;
             file << string::replace(strStrm.str(), "{structureType}", structure.name);
         }
@@ -0,0 +1,229 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-cppgen/structure-enumerate-pointers-generator.hpp"
+#include "gvk-cppgen/basic-structure-member-processor-generator.hpp"
+#include "gvk-cppgen/compile-guard-generator.hpp"
+#include "gvk-cppgen/module-generator.hpp"
+#include "gvk-cppgen/namespace-generator.hpp"
+#include "gvk-cppgen/utilities.hpp"
+#include "gvk-string.hpp"
+
+#include <algorithm>
+
+namespace gvk {
+namespace cppgen {
+
+class StructureMemberEnumeratePointersGenerator final
+    : public BasicStructureMemberProcessorGenerator
+{
+protected:
+    inline std::string generate_pnext_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback); enumerate_pnext_pointers(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_void_pointer_processor() const override final
+    {
+        return "enumerate_host_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_function_pointer_processor() const override final
+    {
+        return "enumerate_host_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_handle_array_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_structure_array_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback); enumerate_dynamic_structure_array_pointers(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_enumeration_array_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_string_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_string_array_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback); enumerate_dynamic_pointer_array_pointers(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_dynamic_primitive_array_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_handle_pointer_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_structure_pointer_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback); enumerate_dynamic_structure_array_pointers(1, obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_enumeration_pointer_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_primitive_pointer_processor() const override final
+    {
+        return "enumerate_pointer(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_static_handle_array_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_static_structure_array_processor() const override final
+    {
+        return "enumerate_static_structure_array_pointers<{memberLength}>(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_static_enumeration_array_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_static_string_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_static_primitive_array_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_handle_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_structure_processor() const override final
+    {
+        return "enumerate_structure_pointers(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_enumeration_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_flags_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+
+    inline std::string generate_primitive_processor() const override final
+    {
+        return "enumerate_value(obj.{memberName}, callback);";
+    }
+};
+
+void StructureEnumeratePointersGenerator::generate(const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    ModuleGenerator module(
+        apiElements.includePath,
+        apiElements.includePrefix,
+        apiElements.sourcePath,
+        apiElements.name + "-structure-enumerate-pointers"
+    );
+    generate_header(module.header, apiElements);
+    generate_source(module.source, manifest, apiElements);
+}
+
+void StructureEnumeratePointersGenerator::generate_header(FileGenerator& file, const ApiElementCollectionInfo& apiElements)
+{
+    file << "#include \"gvk-defines.hpp\"" << std::endl;
+    for (const auto& include : apiElements.headerIncludes) {
+        file << "#include \"" << include << "\"" << std::endl;
+    }
+    file << "#include \"gvk-structures/detail/pointer-enumeration-utilities.hpp\"" << std::endl;
+    file << std::endl;
+    NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+    file << std::endl;
+    for (const auto& structure : apiElements.structures) {
+        CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+        file << string::replace("template <> void enumerate_structure_pointers<{structureType}>(const {structureType}& obj, const EnumeratePointersCallback& callback);", "{structureType}", structure.name) << std::endl;
+    }
+    file << std::endl;
+}
+
+void StructureEnumeratePointersGenerator::generate_source(FileGenerator& file, const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    for (const auto& include : apiElements.sourceIncludes) {
+        file << "#include \"" << include << "\"" << std::endl;
+    }
+    if (apiElements.name != "core") {
+        file << "#include \"gvk-structures/generated/core-structure-enumerate-pointers.hpp\"" << std::endl;
+    }
+    file << "#include \"gvk-structures/detail/get-count.hpp\"" << std::endl;
+    file << std::endl;
+    NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+    for (const auto& structure : apiElements.structures) {
+        if (!apiElements.manuallyImplemented.count(structure.name)) {
+            file << std::endl;
+            CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+            file << string::replace("template <> void enumerate_structure_pointers<{structureType}>(const {structureType}& obj, const EnumeratePointersCallback& callback)", "{structureType}", structure.name) << std::endl;
+            file << "{" << std::endl;
+            // NOTE : Bitfields can't be addressed individually, unions and structures
+            //  with bitfield members are reported as a single value.
+            auto hasBitField = std::any_of(structure.members.begin(), structure.members.end(), [](const xml::Parameter& member) { return member.bitField; });
+            if (structure.isUnion || hasBitField) {
+                file << "    enumerate_value(obj, callback);" << std::endl;
+            } else {
+                file << "    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));" << std::endl;
+                for (size_t i = 0; i < structure.members.size(); ++i) {
+                    const auto& member = structure.members[i];
+                    CompileGuardGenerator memberCompileGuardGenerator(file, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
+                    auto source = StructureMemberEnumeratePointersGenerator().generate(manifest, member);
+                    if (!source.empty()) {
+                        file << "    " << source << std::endl;
+                    }
+                }
+            }
+            file << "}" << std::endl;
+        }
+    }
+    file << std::endl;
+}
+
+} // namespace cppgen
+} // namespace gvk
@@ -28,6 +28,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/utilities.hpp"
 
 #include <cassert>
+#include <map>
+#include <set>
 
 namespace gvk {
 namespace cppgen {
@@ -272,5 +274,90 @@ void generate_object_type_switch(
     file << indentation << "}\n";
 }
 
+std::vector<const xml::Structure*> get_flat_structures(
+    const xml::Manifest& manifest,
+    const ApiElementCollectionInfo& apiElements,
+    const std::function<bool(const xml::Parameter&)>& isFlatMember
+)
+{
+    // NOTE : A structure is flat when it has no pNext, pointers, or bitfields,
+    //  every member is itself flat, and (checked at compile time by the generated
+    //  traits) it has no padding.  isFlatMember() can exclude additional member
+    //  types depending on how flatness is used.  Structure members are only
+    //  considered if they're in the same ApiElementCollectionInfo so their traits
+    //  are always specialized before they're used, other structures fall back to
+    //  the primary template.  Flat structures are returned in dependency order.
+    std::map<std::string, const xml::Structure*> structures;
+    for (const auto& structure : apiElements.structures) {
+        if (structure.alias.empty() && !structure.isUnion && !apiElements.manuallyImplemented.count(structure.name)) {
+            structures[structure.name] = &structure;
+        }
+    }
+    std::set<std::string> processedStructures;
+    std::set<std::string> flatStructureNames;
+    std::vector<const xml::Structure*> flatStructures;
+    std::function<void(const xml::Structure&)> processStructure = [&](const xml::Structure& structure)
+    {
+        if (!processedStructures.insert(structure.name).second) {
+            return;
+        }
+        for (const auto& member : structure.members) {
+            if (member.name == "pNext" ||
+                member.flags & xml::Pointer ||
+                member.bitField ||
+                !isFlatMember(member) ||
+                !get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards).empty()) {
+                return;
+            }
+            if (manifest.structures.count(member.unqualifiedType)) {
+                auto structureItr = structures.find(member.unqualifiedType);
+                if (structureItr == structures.end()) {
+                    return;
+                }
+                processStructure(*structureItr->second);
+                if (!flatStructureNames.count(member.unqualifiedType)) {
+                    return;
+                }
+            }
+        }
+        if (!structure.members.empty()) {
+            flatStructureNames.insert(structure.name);
+            flatStructures.push_back(&structure);
+        }
+    };
+    for (const auto& structureItr : structures) {
+        processStructure(*structureItr.second);
+    }
+    return flatStructures;
+}
+
+void generate_flat_structure_traits(
+    FileGenerator& file,
+    const std::vector<const xml::Structure*>& flatStructures,
+    const std::string& traitName
+)
+{
+    for (const auto& pStructure : flatStructures) {
+        const auto& structure = *pStructure;
+        file << std::endl;
+        CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+        file << "template <>" << std::endl;
+        file << "struct " << traitName << "<" << structure.name << ">" << std::endl;
+        file << "    : std::integral_constant<bool," << std::endl;
+        for (const auto& member : structure.members) {
+            file << "        " << traitName << "<" << member.unqualifiedType << ">::value &&" << std::endl;
+        }
+        file << "        sizeof(" << structure.name << ") == (" << std::endl;
+        for (size_t i = 0; i < structure.members.size(); ++i) {
+            file << "            " << (i ? "+ " : "") << "sizeof(" << structure.name << "::" << structure.members[i].name << ")" << std::endl;
+        }
+        file << "        )" << std::endl;
+        file << "    >" << std::endl;
+        file << "{" << std::endl;
+        file << "};" << std::endl;
+    }
+    file << std::endl;
+}
+
 } // namespace cppgen
 } // namespace gvk
@@ -260,7 +260,7 @@ int main(int, const char*[])
         };
         gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
         gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
+        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
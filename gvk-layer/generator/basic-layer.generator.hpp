@@ -64,11 +64,27 @@ private:
     {
         file << "#include \"gvk-defines.hpp\"" << std::endl;
         file << std::endl;
+        file << "#include <bitset>" << std::endl;
+        file << "#include <type_traits>" << std::endl;
+        file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::layer");
         file << std::endl;
+        file << "enum class Hook" << std::endl;
+        file << "{" << std::endl;
+        for (const auto& commandItr : manifest.commands) {
+            const auto& command = commandItr.second;
+            CompileGuardGenerator compileGuardGenerator(file, command.compileGuards);
+            file << "    " << command.name << "," << std::endl;
+        }
+        file << "    Count," << std::endl;
+        file << "};" << std::endl;
+        file << std::endl;
+        file << "using HookMask = std::bitset<(size_t)Hook::Count>;" << std::endl;
+        file << std::endl;
         file << "class BasicLayer" << std::endl;
         file << "{" << std::endl;
         file << "public:" << std::endl;
+        file << "    BasicLayer();" << std::endl;
         file << "    virtual ~BasicLayer() = 0;" << std::endl;
         for (const auto& commandItr : manifest.commands) {
             const auto& command = append_return_result_parameter(commandItr.second);
@@ -77,8 +93,32 @@ private:
             file << "    virtual " << command.returnType << " post_" << command.name << "(" << get_parameter_list(command.parameters) << ");" << std::endl;
         }
         file << "    bool enabled { true };" << std::endl;
+        file << "    HookMask preHooks;" << std::endl;
+        file << "    HookMask postHooks;" << std::endl;
         file << "};" << std::endl;
         file << std::endl;
+        generate_get_overridden_hooks(file, manifest);
+    }
+
+    static void generate_get_overridden_hooks(FileGenerator& file, const xml::Manifest& manifest)
+    {
+        // NOTE : When LayerType doesn't override a hook, &LayerType::pre_vkCmdDraw
+        //  names the BasicLayer member and its type matches the BasicLayer hook, so
+        //  hook overrides can be resolved at compile time without touching vtables.
+        file << "template <typename LayerType>" << std::endl;
+        file << "inline void get_overridden_hooks(HookMask& preHooks, HookMask& postHooks)" << std::endl;
+        file << "{" << std::endl;
+        file << "    static_assert(std::is_base_of_v<BasicLayer, LayerType>, \"LayerType must derive from gvk::layer::BasicLayer\");" << std::endl;
+        file << "    preHooks.reset();" << std::endl;
+        file << "    postHooks.reset();" << std::endl;
+        for (const auto& commandItr : manifest.commands) {
+            const auto& command = commandItr.second;
+            CompileGuardGenerator compileGuardGenerator(file, command.compileGuards);
+            file << string::replace("    preHooks.set((size_t)Hook::{commandName}, !std::is_same_v<decltype(&LayerType::pre_{commandName}), decltype(&BasicLayer::pre_{commandName})>);", "{commandName}", command.name) << std::endl;
+            file << string::replace("    postHooks.set((size_t)Hook::{commandName}, !std::is_same_v<decltype(&LayerType::post_{commandName}), decltype(&BasicLayer::post_{commandName})>);", "{commandName}", command.name) << std::endl;
+        }
+        file << "}" << std::endl;
+        file << std::endl;
     }
 
     static void generate_source(FileGenerator& file, const xml::Manifest& manifest)
@@ -86,6 +126,12 @@ private:
         file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::layer");
         file << std::endl;
+        file << "BasicLayer::BasicLayer()" << std::endl;
+        file << "{" << std::endl;
+        file << "    preHooks.set();" << std::endl;
+        file << "    postHooks.set();" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
         file << "BasicLayer::~BasicLayer()" << std::endl;
         file << "{" << std::endl;
         file << "}" << std::endl;
@@ -81,7 +81,7 @@ private:
                 { "{vkCommandArgs}", get_parameter_list(command.parameters, false, true) },
                 { "{gvkCommandArgs}", get_parameter_list(append_return_result_parameter(command).parameters, false, true) },
                 { "{resultAssignment}", command.returnType == "void" ? std::string() : "gvkResult = " },
-                { "{dispatchableHandleType}", (command.parameters[0].type == "VkInstance" || command.parameters[0].type == "VkPhysicalDevice") ? "VkInstance" : "VkDevice" },
+                { "{dispatchTableType}", (command.parameters[0].type == "VkInstance" || command.parameters[0].type == "VkPhysicalDevice") ? "instance" : "device" },
                 { "{dispatchableHandle}", command.parameters[0].name },
             };
             file << std::endl;
@@ -90,22 +90,27 @@ private:
             file << "{" << std::endl;
             file << (command.returnType == "void" ? std::string() : "    " + command.returnType + " gvkResult { };\n");
             file << string::replace(
-R"(    auto& layers = Registry::get().layers;
-    for (auto layerItr = layers.begin(); layerItr != layers.end(); ++layerItr) {
-        assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
-        if ((*layerItr)->enabled) {
-            {resultAssignment}(*layerItr)->pre_{commandName}({gvkCommandArgs});
+R"(    auto& registry = Registry::get();
+    auto& layers = registry.layers;
+    if (registry.preHooks[(size_t)Hook::{commandName}]) {
+        for (auto layerItr = layers.begin(); layerItr != layers.end(); ++layerItr) {
+            assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
+            if ((*layerItr)->enabled && (*layerItr)->preHooks[(size_t)Hook::{commandName}]) {
+                {resultAssignment}(*layerItr)->pre_{commandName}({gvkCommandArgs});
+            }
         }
     }
-    const auto& dispatchTableItr = Registry::get().{dispatchableHandleType}DispatchTables.find(get_dispatch_key({dispatchableHandle}));
-    assert(dispatchTableItr != Registry::get().{dispatchableHandleType}DispatchTables.end());
-    if (dispatchTableItr->second.g{commandName}) {
-        {resultAssignment}dispatchTableItr->second.g{commandName}({vkCommandArgs});
+    auto pDispatchTable = registry.find_{dispatchTableType}_dispatch_table(get_dispatch_key({dispatchableHandle}));
+    assert(pDispatchTable);
+    if (pDispatchTable->g{commandName}) {
+        {resultAssignment}pDispatchTable->g{commandName}({vkCommandArgs});
     }
-    for (auto layerItr = layers.rbegin(); layerItr != layers.rend(); ++layerItr) {
-        assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
-        if ((*layerItr)->enabled) {
-            {resultAssignment}(*layerItr)->post_{commandName}({gvkCommandArgs});
+    if (registry.postHooks[(size_t)Hook::{commandName}]) {
+        for (auto layerItr = layers.rbegin(); layerItr != layers.rend(); ++layerItr) {
+            assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
+            if ((*layerItr)->enabled && (*layerItr)->postHooks[(size_t)Hook::{commandName}]) {
+                {resultAssignment}(*layerItr)->post_{commandName}({gvkCommandArgs});
+            }
         }
     }
 )", replacements);
@@ -0,0 +1,173 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-dispatch-table.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace gvk {
+namespace layer {
+
+/**
+Provides lock-free lookup of DispatchTable objects by dispatch key
+    @note Lookups may run concurrently with each other and with modifications
+    @note Modifications must be externally synchronized (see Registry::mutex)
+    @note Cached DispatchTable objects must maintain a stable address until they're erased from the DispatchTableCache
+    @note When the DispatchTableCache is full, find() returns nullptr for keys that couldn't be inserted
+*/
+class DispatchTableCache final
+{
+public:
+    static constexpr size_t Capacity = 256;
+    static_assert(!(Capacity & (Capacity - 1)), "DispatchTableCache::Capacity must be a power of two");
+
+    DispatchTableCache() = default;
+
+    /**
+    Gets the DispatchTable associated with a given dispatch key
+    @param [in] pDispatchKey The dispatch key of the DispatchTable to get
+    @return The DispatchTable associated with the given dispatch key, or nullptr if the dispatch key isn't cached
+    */
+    inline const DispatchTable* find(const void* pDispatchKey) const
+    {
+        auto index = get_index(pDispatchKey);
+        for (size_t i = 0; i < Capacity; ++i) {
+            const auto& slot = mSlots[(index + i) & (Capacity - 1)];
+            auto pSlotDispatchKey = slot.pDispatchKey.load(std::memory_order_acquire);
+            if (pSlotDispatchKey == pDispatchKey) {
+                return slot.pDispatchTable.load(std::memory_order_acquire);
+            }
+            if (!pSlotDispatchKey) {
+                break;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+    Inserts a DispatchTable into this DispatchTableCache
+    @param [in] pDispatchKey The dispatch key to associate with the given DispatchTable
+    @param [in] pDispatchTable The DispatchTable to insert
+    @return Whether or not the DispatchTable was inserted
+    */
+    inline bool insert(const void* pDispatchKey, const DispatchTable* pDispatchTable)
+    {
+        assert(pDispatchKey && pDispatchKey != get_tombstone());
+        Slot* pAvailableSlot = nullptr;
+        auto index = get_index(pDispatchKey);
+        for (size_t i = 0; i < Capacity; ++i) {
+            auto& slot = mSlots[(index + i) & (Capacity - 1)];
+            auto pSlotDispatchKey = slot.pDispatchKey.load(std::memory_order_relaxed);
+            if (pSlotDispatchKey == pDispatchKey) {
+                slot.pDispatchTable.store(pDispatchTable, std::memory_order_release);
+                return true;
+            }
+            if (pSlotDispatchKey == get_tombstone() && !pAvailableSlot) {
+                pAvailableSlot = &slot;
+            }
+            if (!pSlotDispatchKey) {
+                pAvailableSlot = pAvailableSlot ? pAvailableSlot : &slot;
+                break;
+            }
+        }
+        if (pAvailableSlot) {
+            // NOTE : The DispatchTable is published before the dispatch key so that
+            //  readers that observe the dispatch key also observe the DispatchTable
+            pAvailableSlot->pDispatchTable.store(pDispatchTable, std::memory_order_release);
+            pAvailableSlot->pDispatchKey.store(pDispatchKey, std::memory_order_release);
+        }
+        return pAvailableSlot != nullptr;
+    }
+
+    /**
+    Erases the DispatchTable associated with a given dispatch key from this DispatchTableCache
+    @param [in] pDispatchKey The dispatch key of the DispatchTable to erase
+    */
+    inline void erase(const void* pDispatchKey)
+    {
+        auto index = get_index(pDispatchKey);
+        for (size_t i = 0; i < Capacity; ++i) {
+            auto& slot = mSlots[(index + i) & (Capacity - 1)];
+            auto pSlotDispatchKey = slot.pDispatchKey.load(std::memory_order_relaxed);
+            if (pSlotDispatchKey == pDispatchKey) {
+                slot.pDispatchTable.store(nullptr, std::memory_order_release);
+                slot.pDispatchKey.store(get_tombstone(), std::memory_order_release);
+                break;
+            }
+            if (!pSlotDispatchKey) {
+                break;
+            }
+        }
+    }
+
+    /**
+    Erases all DispatchTable objects from this DispatchTableCache
+    */
+    inline void clear()
+    {
+        for (auto& slot : mSlots) {
+            slot.pDispatchTable.store(nullptr, std::memory_order_release);
+            slot.pDispatchKey.store(nullptr, std::memory_order_release);
+        }
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<const void*> pDispatchKey { };
+        std::atomic<const DispatchTable*> pDispatchTable { };
+    };
+
+    static inline const void* get_tombstone()
+    {
+        return reinterpret_cast<const void*>(uintptr_t(1));
+    }
+
+    static inline size_t get_index(const void* pDispatchKey)
+    {
+        // NOTE : Dispatch keys are pointers to loader dispatch tables, the low bits
+        //  are discarded since they're always zero due to alignment...
+        auto value = (uint64_t)(uintptr_t)pDispatchKey >> 4;
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        return (size_t)value;
+    }
+
+    std::array<Slot, Capacity> mSlots { };
+
+    DispatchTableCache(const DispatchTableCache&) = delete;
+    DispatchTableCache& operator=(const DispatchTableCache&) = delete;
+};
+
+} // namespace layer
+} // namespace gvk
@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-layer/generated/basic-layer.hpp"
 #include "gvk-layer/generated/layer-hooks.hpp"
+#include "gvk-layer/dispatch-table-cache.hpp"
 #include "gvk-defines.hpp"
 #include "gvk-dispatch-table.hpp"
 
@@ -35,6 +36,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -55,6 +57,44 @@ class Registry final
 public:
     static Registry& get();
 
+    /**
+    Gets the VkInstance DispatchTable associated with a given dispatch key
+    @param [in] pDispatchKey The dispatch key of the VkInstance DispatchTable to get
+    @return The VkInstance DispatchTable associated with the given dispatch key, or nullptr if no DispatchTable is found
+        @note VkInstanceDispatchTableCache is checked before falling back to VkInstanceDispatchTables
+        @note Falling back to VkInstanceDispatchTables takes a shared lock on mutex, so this method must not be called
+            on a thread that holds mutex for a dispatch key that isn't cached
+    */
+    inline const DispatchTable* find_instance_dispatch_table(const void* pDispatchKey)
+    {
+        auto pDispatchTable = VkInstanceDispatchTableCache.find(pDispatchKey);
+        if (!pDispatchTable) {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto itr = VkInstanceDispatchTables.find(const_cast<void*>(pDispatchKey));
+            pDispatchTable = itr != VkInstanceDispatchTables.end() ? &itr->second : nullptr;
+        }
+        return pDispatchTable;
+    }
+
+    /**
+    Gets the VkDevice DispatchTable associated with a given dispatch key
+    @param [in] pDispatchKey The dispatch key of the VkDevice DispatchTable to get
+    @return The VkDevice DispatchTable associated with the given dispatch key, or nullptr if no DispatchTable is found
+        @note VkDeviceDispatchTableCache is checked before falling back to VkDeviceDispatchTables
+        @note Falling back to VkDeviceDispatchTables takes a shared lock on mutex, so this method must not be called
+            on a thread that holds mutex for a dispatch key that isn't cached
+    */
+    inline const DispatchTable* find_device_dispatch_table(const void* pDispatchKey)
+    {
+        auto pDispatchTable = VkDeviceDispatchTableCache.find(pDispatchKey);
+        if (!pDispatchTable) {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto itr = VkDeviceDispatchTables.find(const_cast<void*>(pDispatchKey));
+            pDispatchTable = itr != VkDeviceDispatchTables.end() ? &itr->second : nullptr;
+        }
+        return pDispatchTable;
+    }
+
     template <typename DispatchableVkHandleType>
     inline DispatchTable& get_instance_dispatch_table(DispatchableVkHandleType dispatchableVkHandle)
     {
@@ -79,12 +119,40 @@ public:
         return itr != VkDeviceDispatchTables.end() ? itr->second : sDispatchTable;
     }
 
-    std::mutex mutex;
+    /**
+    Adds a layer to this Registry, recording which pre/post hooks the layer overrides
+    @param <LayerType> The type of layer to add
+    @param <ArgTypes> The types of arguments to forward to the LayerType constructor
+    @param [in] args The arguments to forward to the LayerType constructor
+    @return A reference to the added layer
+        @note Layers added directly to the layers member are assumed to override every hook
+    */
+    template <typename LayerType, typename ...ArgTypes>
+    inline LayerType& add_layer(ArgTypes&&... args)
+    {
+        auto upLayer = std::make_unique<LayerType>(std::forward<ArgTypes>(args)...);
+        auto& layer = *upLayer;
+        get_overridden_hooks<LayerType>(layer.preHooks, layer.postHooks);
+        layers.push_back(std::move(upLayer));
+        return layer;
+    }
+
+    /**
+    Updates this Registry object's preHooks and postHooks from its layers
+        @note This method is called after gvk::layer::on_load(), layers added or modified after on_load() require an additional call to this method
+    */
+    void update_hooks();
+
+    std::shared_mutex mutex;
     VkInstance instance{ };
     uint32_t apiVersion{ VK_API_VERSION_1_0 };
     std::vector<std::unique_ptr<BasicLayer>> layers;
+    HookMask preHooks;
+    HookMask postHooks;
     std::unordered_map<void*, DispatchTable> VkInstanceDispatchTables;
     std::unordered_map<void*, DispatchTable> VkDeviceDispatchTables;
+    DispatchTableCache VkInstanceDispatchTableCache;
+    DispatchTableCache VkDeviceDispatchTableCache;
     using ApplicationVkPhysicalDevice = VkPhysicalDevice;
     using LoaderVkPhysicalDevice = VkPhysicalDevice;
     std::unordered_map<ApplicationVkPhysicalDevice, LoaderVkPhysicalDevice> VkPhysicalDevices;
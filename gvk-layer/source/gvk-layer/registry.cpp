@@ -49,6 +49,17 @@ Registry& Registry::get()
     return *spRegistry;
 }
 
+void Registry::update_hooks()
+{
+    preHooks.reset();
+    postHooks.reset();
+    for (const auto& upLayer : layers) {
+        assert(upLayer && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
+        preHooks |= upLayer->preHooks;
+        postHooks |= upLayer->postHooks;
+    }
+}
+
 VkLayerInstanceCreateInfo* get_instance_chain_info(const VkInstanceCreateInfo* pCreateInfo, VkLayerFunction layerFunction)
 {
     assert(pCreateInfo);
@@ -75,7 +86,7 @@ VkResult create_instance(const VkInstanceCreateInfo* pCreateInfo, const VkAlloca
 {
     assert(pCreateInfo);
     assert(pInstance);
-    std::lock_guard<std::mutex> lock(Registry::get().mutex);
+    std::lock_guard<std::shared_mutex> lock(Registry::get().mutex);
     auto vkResult = VK_ERROR_INITIALIZATION_FAILED;
     auto pLayerLinkInfo = get_instance_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
     Registry::get().pfn_vkGetInstanceProcAddr = (pLayerLinkInfo && pLayerLinkInfo->u.pLayerInfo) ? pLayerLinkInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr : nullptr;
@@ -95,6 +106,7 @@ VkResult create_instance(const VkInstanceCreateInfo* pCreateInfo, const VkAlloca
         // Get layers and run pre vkCreateInstance() handlers
         auto& layers = Registry::get().layers;
         on_load(Registry::get());
+        Registry::get().update_hooks();
         vkResult = VK_SUCCESS;
         for (auto layerItr = layers.begin(); layerItr != layers.end(); ++layerItr) {
             assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
@@ -109,7 +121,8 @@ VkResult create_instance(const VkInstanceCreateInfo* pCreateInfo, const VkAlloca
             DispatchTable::load_instance_entry_points(*pInstance, &instanceDispatchTable);
             Registry::get().instance = *pInstance;
             Registry::get().apiVersion = pCreateInfo->pApplicationInfo ? pCreateInfo->pApplicationInfo->apiVersion : VK_API_VERSION_1_0;
-            Registry::get().VkInstanceDispatchTables.insert({ get_dispatch_key(*pInstance), instanceDispatchTable });
+            auto instanceDispatchTableItr = Registry::get().VkInstanceDispatchTables.insert({ get_dispatch_key(*pInstance), instanceDispatchTable }).first;
+            Registry::get().VkInstanceDispatchTableCache.insert(instanceDispatchTableItr->first, &instanceDispatchTableItr->second);
         }
 
         // Run post vkCreateInstance() handlers
@@ -124,7 +137,7 @@ VkResult create_instance(const VkInstanceCreateInfo* pCreateInfo, const VkAlloca
 void destroy_instance(VkInstance instance, const VkAllocationCallbacks* pAllocator)
 {
     assert(instance);
-    std::lock_guard<std::mutex> lock(Registry::get().mutex);
+    std::lock_guard<std::shared_mutex> lock(Registry::get().mutex);
     auto& layers = Registry::get().layers;
     for (auto layerItr = layers.begin(); layerItr != layers.end(); ++layerItr) {
         assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
@@ -135,6 +148,8 @@ void destroy_instance(VkInstance instance, const VkAllocationCallbacks* pAllocat
     const auto& instanceDispatchTable = instanceDispatchTableItr->second;
     assert(instanceDispatchTable.gvkDestroyInstance && "gvk::layer::Registry VkInstance gvk::DispatchTable contains a null entry point; are the Vulkan SDK, runtime, and layers configured correctly?");
     instanceDispatchTable.gvkDestroyInstance(instance, pAllocator);
+    Registry::get().VkInstanceDispatchTableCache.clear();
+    Registry::get().VkDeviceDispatchTableCache.clear();
     Registry::get().VkInstanceDispatchTables.clear();
     Registry::get().VkDeviceDispatchTables.clear();
     Registry::get().VkPhysicalDevices.clear();
@@ -143,6 +158,7 @@ void destroy_instance(VkInstance instance, const VkAllocationCallbacks* pAllocat
         (*layerItr)->post_vkDestroyInstance(instance, pAllocator);
     }
     layers.clear();
+    Registry::get().update_hooks();
 }
 
 VkResult get_physical_device_infos(const DispatchTable& dispatchTable, VkInstance instance, std::map<VkPhysicalDeviceProperties, std::vector<VkPhysicalDevice>>& physicalDeviceInfos)
@@ -213,7 +229,7 @@ VkResult create_device(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo
     assert(physicalDevice);
     assert(pCreateInfo);
     assert(pDevice);
-    std::lock_guard<std::mutex> lock(Registry::get().mutex);
+    std::lock_guard<std::shared_mutex> lock(Registry::get().mutex);
     auto vkResult = create_physical_device_mappings(Registry::get().instance);
     auto pLayerDeviceCreateInfo = get_device_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
     auto pfn_vkGetDeviceProcAddr = (pLayerDeviceCreateInfo && pLayerDeviceCreateInfo->u.pLayerInfo) ? pLayerDeviceCreateInfo->u.pLayerInfo->pfnNextGetDeviceProcAddr : nullptr;
@@ -233,7 +249,8 @@ VkResult create_device(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo
             DispatchTable deviceDispatchTable { };
             deviceDispatchTable.gvkGetDeviceProcAddr = pfn_vkGetDeviceProcAddr;
             DispatchTable::load_device_entry_points(*pDevice, &deviceDispatchTable);
-            Registry::get().VkDeviceDispatchTables.insert({ get_dispatch_key(*pDevice), deviceDispatchTable });
+            auto deviceDispatchTableItr = Registry::get().VkDeviceDispatchTables.insert({ get_dispatch_key(*pDevice), deviceDispatchTable }).first;
+            Registry::get().VkDeviceDispatchTableCache.insert(deviceDispatchTableItr->first, &deviceDispatchTableItr->second);
         }
         for (auto layerItr = layers.rbegin(); layerItr != layers.rend(); ++layerItr) {
             assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
@@ -246,7 +263,7 @@ VkResult create_device(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo
 void destroy_device(VkDevice device, const VkAllocationCallbacks* pAllocator)
 {
     assert(device);
-    std::lock_guard<std::mutex> lock(Registry::get().mutex);
+    std::lock_guard<std::shared_mutex> lock(Registry::get().mutex);
     auto& layers = Registry::get().layers;
     for (auto layerItr = layers.begin(); layerItr != layers.end(); ++layerItr) {
         assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
@@ -257,6 +274,7 @@ void destroy_device(VkDevice device, const VkAllocationCallbacks* pAllocator)
     const auto& deviceDispatchTable = deviceDispatchTableItr->second;
     assert(deviceDispatchTable.gvkDestroyDevice && "gvk::layer::Registry VkDevice gvk::DispatchTable contains a null entry point for vkDestroyDevice; are the Vulkan SDK, runtime, and layers configured correctly?");
     deviceDispatchTable.gvkDestroyDevice(device, pAllocator);
+    Registry::get().VkDeviceDispatchTableCache.erase(get_dispatch_key(device));
     Registry::get().VkDeviceDispatchTables.erase(get_dispatch_key(device));
     for (auto layerItr = layers.rbegin(); layerItr != layers.rend(); ++layerItr) {
         assert(*layerItr && "gvk::layer::Registry contains a null layer; are layers configured correctly and intialized via gvk::layer::on_load()?");
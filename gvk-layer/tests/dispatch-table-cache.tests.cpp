@@ -0,0 +1,214 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-layer/dispatch-table-cache.hpp"
+#include "gvk-layer/registry.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace gvk {
+namespace layer {
+
+void on_load(Registry&)
+{
+}
+
+} // namespace layer
+} // namespace gvk
+
+// NOTE : Dispatchable Vulkan handles point to an object whose first member is a
+//  pointer to the loader's dispatch table, the dispatch key is that pointer.
+//  NullDispatchableHandle stands in for objects created by the loader/ICD...
+struct NullDispatchableHandle
+{
+    void* pLoaderDispatch { };
+};
+
+static uint64_t sNullCmdDrawCallCount;
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t)
+{
+    ++sNullCmdDrawCallCount;
+}
+
+TEST(DispatchTableCache, InsertFindErase)
+{
+    std::vector<uint64_t> loaderDispatches(gvk::layer::DispatchTableCache::Capacity * 2);
+    std::vector<gvk::DispatchTable> dispatchTables(loaderDispatches.size());
+    gvk::layer::DispatchTableCache dispatchTableCache;
+    for (size_t i = 0; i < loaderDispatches.size(); ++i) {
+        EXPECT_EQ(dispatchTableCache.find(&loaderDispatches[i]), nullptr);
+        auto inserted = dispatchTableCache.insert(&loaderDispatches[i], &dispatchTables[i]);
+        EXPECT_EQ(inserted, i < gvk::layer::DispatchTableCache::Capacity);
+        EXPECT_EQ(dispatchTableCache.find(&loaderDispatches[i]), inserted ? &dispatchTables[i] : nullptr);
+    }
+
+    // Erase every other entry, the remaining entries must still be found when
+    //  probing past tombstones...
+    for (size_t i = 0; i < gvk::layer::DispatchTableCache::Capacity; i += 2) {
+        dispatchTableCache.erase(&loaderDispatches[i]);
+    }
+    for (size_t i = 0; i < gvk::layer::DispatchTableCache::Capacity; ++i) {
+        EXPECT_EQ(dispatchTableCache.find(&loaderDispatches[i]), i % 2 ? &dispatchTables[i] : nullptr);
+    }
+
+    // Tombstones are reused for subsequent insertions...
+    for (size_t i = gvk::layer::DispatchTableCache::Capacity; i < loaderDispatches.size(); i += 2) {
+        EXPECT_TRUE(dispatchTableCache.insert(&loaderDispatches[i], &dispatchTables[i]));
+        EXPECT_EQ(dispatchTableCache.find(&loaderDispatches[i]), &dispatchTables[i]);
+    }
+
+    dispatchTableCache.clear();
+    for (const auto& loaderDispatch : loaderDispatches) {
+        EXPECT_EQ(dispatchTableCache.find(&loaderDispatch), nullptr);
+    }
+}
+
+TEST(DispatchTableCache, DispatchOverhead)
+{
+    // Register a collection of null devices with the gvk::layer::Registry...
+    constexpr size_t DeviceCount = 16;
+    constexpr size_t CallCount = 1 << 22;
+    std::array<uint64_t, DeviceCount> loaderDispatches { };
+    std::array<NullDispatchableHandle, DeviceCount> commandBuffers { };
+    auto& registry = gvk::layer::Registry::get();
+    {
+        std::lock_guard<std::shared_mutex> lock(registry.mutex);
+        for (size_t i = 0; i < DeviceCount; ++i) {
+            commandBuffers[i].pLoaderDispatch = &loaderDispatches[i];
+            gvk::DispatchTable dispatchTable { };
+            dispatchTable.gvkCmdDraw = null_vkCmdDraw;
+            auto itr = registry.VkDeviceDispatchTables.insert({ &loaderDispatches[i], dispatchTable }).first;
+            ASSERT_TRUE(registry.VkDeviceDispatchTableCache.insert(itr->first, &itr->second));
+        }
+        registry.update_hooks();
+    }
+
+    // Measure the cost of dispatching through the generated hook, which uses the
+    //  DispatchTableCache, against the std::unordered_map<> lookup it replaces...
+    sNullCmdDrawCallCount = 0;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < CallCount; ++i) {
+        gvk::layer::hooks::gvkCmdDraw((VkCommandBuffer)&commandBuffers[i % DeviceCount], 3, 1, 0, 0);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto cachedNanoseconds = std::chrono::duration<double, std::nano>(end - begin).count() / CallCount;
+    EXPECT_EQ(sNullCmdDrawCallCount, CallCount);
+
+    sNullCmdDrawCallCount = 0;
+    begin = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < CallCount; ++i) {
+        auto commandBuffer = (VkCommandBuffer)&commandBuffers[i % DeviceCount];
+        auto itr = registry.VkDeviceDispatchTables.find(gvk::layer::get_dispatch_key(commandBuffer));
+        ASSERT_NE(itr, registry.VkDeviceDispatchTables.end());
+        itr->second.gvkCmdDraw(commandBuffer, 3, 1, 0, 0);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto mapNanoseconds = std::chrono::duration<double, std::nano>(end - begin).count() / CallCount;
+    EXPECT_EQ(sNullCmdDrawCallCount, CallCount);
+    std::cout << "[ gvkCmdDraw() ] " << cachedNanoseconds << " ns/call (DispatchTableCache), " << mapNanoseconds << " ns/call (std::unordered_map<>)" << std::endl;
+
+    // Cleanup...
+    std::lock_guard<std::shared_mutex> lock(registry.mutex);
+    for (auto& loaderDispatch : loaderDispatches) {
+        registry.VkDeviceDispatchTableCache.erase(&loaderDispatch);
+        registry.VkDeviceDispatchTables.erase(&loaderDispatch);
+    }
+}
+
+TEST(DispatchTableCache, RegistryFallback)
+{
+    // Register more null devices than the DispatchTableCache can hold, devices
+    //  that don't fit must be found in VkDeviceDispatchTables...
+    constexpr size_t DeviceCount = gvk::layer::DispatchTableCache::Capacity + 16;
+    std::vector<uint64_t> loaderDispatches(DeviceCount);
+    std::vector<NullDispatchableHandle> commandBuffers(DeviceCount);
+    auto& registry = gvk::layer::Registry::get();
+    size_t cachedCount = 0;
+    {
+        std::lock_guard<std::shared_mutex> lock(registry.mutex);
+        for (size_t i = 0; i < DeviceCount; ++i) {
+            commandBuffers[i].pLoaderDispatch = &loaderDispatches[i];
+            gvk::DispatchTable dispatchTable { };
+            dispatchTable.gvkCmdDraw = null_vkCmdDraw;
+            auto itr = registry.VkDeviceDispatchTables.insert({ &loaderDispatches[i], dispatchTable }).first;
+            cachedCount += registry.VkDeviceDispatchTableCache.insert(itr->first, &itr->second) ? 1 : 0;
+        }
+        registry.update_hooks();
+    }
+    EXPECT_EQ(cachedCount, gvk::layer::DispatchTableCache::Capacity);
+    for (auto& loaderDispatch : loaderDispatches) {
+        auto itr = registry.VkDeviceDispatchTables.find(&loaderDispatch);
+        ASSERT_NE(itr, registry.VkDeviceDispatchTables.end());
+        EXPECT_EQ(registry.find_device_dispatch_table(&loaderDispatch), &itr->second);
+    }
+
+    // Lookups that fall back to VkDeviceDispatchTables must be safe while other
+    //  devices are being created and destroyed...
+    std::atomic_bool done { false };
+    std::thread thread(
+        [&]()
+        {
+            std::vector<uint64_t> transientLoaderDispatches(64);
+            while (!done) {
+                for (auto& transientLoaderDispatch : transientLoaderDispatches) {
+                    std::lock_guard<std::shared_mutex> lock(registry.mutex);
+                    registry.VkDeviceDispatchTables.insert({ &transientLoaderDispatch, gvk::DispatchTable { } });
+                }
+                for (auto& transientLoaderDispatch : transientLoaderDispatches) {
+                    std::lock_guard<std::shared_mutex> lock(registry.mutex);
+                    registry.VkDeviceDispatchTables.erase(&transientLoaderDispatch);
+                }
+            }
+        }
+    );
+    constexpr size_t CallCount = 1 << 16;
+    sNullCmdDrawCallCount = 0;
+    for (size_t i = 0; i < CallCount; ++i) {
+        gvk::layer::hooks::gvkCmdDraw((VkCommandBuffer)&commandBuffers[i % DeviceCount], 3, 1, 0, 0);
+    }
+    done = true;
+    thread.join();
+    EXPECT_EQ(sNullCmdDrawCallCount, CallCount);
+
+    // Cleanup...
+    std::lock_guard<std::shared_mutex> lock(registry.mutex);
+    for (auto& loaderDispatch : loaderDispatches) {
+        registry.VkDeviceDispatchTableCache.erase(&loaderDispatch);
+        registry.VkDeviceDispatchTables.erase(&loaderDispatch);
+    }
+}
@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-reference/handle-id.hpp"
 #include "gvk-reference/reference.hpp"
+#include "gvk-reference/reference-pool.hpp"
 
 #include <cstddef>
 #include <cstdint>
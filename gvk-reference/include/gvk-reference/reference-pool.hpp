@@ -0,0 +1,294 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace gvk {
+
+/**
+Statistics describing the pool used to allocate Reference<> control blocks for a given object type
+*/
+struct ReferencePoolStats
+{
+    uint64_t liveCount { }; //!< The number of control blocks currently allocated from the pool
+    uint64_t highWaterMark { }; //!< The maximum number of control blocks that have been allocated from the pool at one time
+    uint64_t capacity { }; //!< The number of control blocks the pool is able to provide before growing
+};
+
+/**
+Specifies whether or not Reference<> control blocks for a given object type are allocated from a pool
+@param <ObjType> The type of object to specify pool allocation for
+    @note Pool allocation is disabled by default
+    @note Object types may opt into pool allocation by declaring a static constexpr bool ReferenceUsesPoolAllocator member or by specializing this template
+    @note Memory allocated for a pool is recycled but never returned to the system
+*/
+template <typename ObjType, typename = void>
+struct ReferenceUsesPoolAllocator
+    : std::false_type
+{
+};
+
+template <typename ObjType>
+struct ReferenceUsesPoolAllocator<ObjType, std::void_t<decltype(ObjType::ReferenceUsesPoolAllocator)>>
+    : std::bool_constant<ObjType::ReferenceUsesPoolAllocator>
+{
+};
+
+namespace detail {
+
+/**
+Tracks ReferencePoolStats for all pools associated with a given tag type
+@param <TagType> The type used to group pools
+*/
+template <typename TagType>
+class ReferencePoolCounters final
+{
+public:
+    static ReferencePoolCounters& get_instance()
+    {
+        static ReferencePoolCounters* spReferencePoolCounters { new ReferencePoolCounters };
+        return *spReferencePoolCounters;
+    }
+
+    inline void on_allocate()
+    {
+        auto liveCount = ++mLiveCount;
+        auto highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+        while (highWaterMark < liveCount && !mHighWaterMark.compare_exchange_weak(highWaterMark, liveCount, std::memory_order_relaxed)) { }
+    }
+
+    inline void on_deallocate()
+    {
+        --mLiveCount;
+    }
+
+    inline void on_grow(uint64_t count)
+    {
+        mCapacity += count;
+    }
+
+    inline ReferencePoolStats get_stats() const
+    {
+        ReferencePoolStats stats { };
+        stats.liveCount = mLiveCount.load(std::memory_order_relaxed);
+        stats.highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+        stats.capacity = mCapacity.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    std::atomic_uint64_t mLiveCount { };
+    std::atomic_uint64_t mHighWaterMark { };
+    std::atomic_uint64_t mCapacity { };
+
+    ReferencePoolCounters() = default;
+    ReferencePoolCounters(const ReferencePoolCounters&) = delete;
+    ReferencePoolCounters& operator=(const ReferencePoolCounters&) = delete;
+};
+
+/**
+Provides storage for objects of a given type from a collection of slabs, recycling storage via a lock-free free list
+@param <T> The type of object to provide storage for
+@param <TagType> The type used to group ReferencePoolStats
+    @note Slabs double in size each time the pool grows and are never released
+    @note The free list head packs a node index with a tag that is incremented on every update to avoid ABA
+*/
+template <typename T, typename TagType>
+class ReferencePool final
+{
+public:
+    static ReferencePool& get_instance()
+    {
+        static ReferencePool* spReferencePool { new ReferencePool };
+        return *spReferencePool;
+    }
+
+    inline T* allocate()
+    {
+        auto head = mHead.load(std::memory_order_acquire);
+        while (true) {
+            auto nodeId = (uint32_t)(head & NodeIdMask);
+            if (!nodeId) {
+                grow();
+                head = mHead.load(std::memory_order_acquire);
+                continue;
+            }
+            auto pNode = get_node(nodeId);
+            auto newHead = get_next_tag(head) | pNode->next.load(std::memory_order_relaxed);
+            if (mHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+                ReferencePoolCounters<TagType>::get_instance().on_allocate();
+                return reinterpret_cast<T*>(pNode->storage);
+            }
+        }
+    }
+
+    inline void deallocate(T* p)
+    {
+        auto pNode = reinterpret_cast<Node*>(p);
+        auto head = mHead.load(std::memory_order_relaxed);
+        do {
+            pNode->next.store((uint32_t)(head & NodeIdMask), std::memory_order_relaxed);
+        } while (!mHead.compare_exchange_weak(head, get_next_tag(head) | pNode->id, std::memory_order_release, std::memory_order_relaxed));
+        ReferencePoolCounters<TagType>::get_instance().on_deallocate();
+    }
+
+private:
+    static constexpr uint64_t NodeIdMask = 0xffffffff;
+    static constexpr uint32_t FirstSlabNodeCount = 64;
+    static constexpr uint32_t MaxSlabCount = 24;
+
+    struct Node
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic_uint32_t next { };
+        uint32_t id { };
+    };
+
+    static inline uint64_t get_next_tag(uint64_t head)
+    {
+        return ((head >> 32) + 1) << 32;
+    }
+
+    static inline uint32_t get_slab_first_node_id(uint32_t slabIndex)
+    {
+        return FirstSlabNodeCount * ((1u << slabIndex) - 1) + 1;
+    }
+
+    inline Node* get_node(uint32_t nodeId) const
+    {
+        // NOTE : Node ids are 1 based so that 0 can represent an empty free list.
+        //  Slab k holds FirstSlabNodeCount << k nodes...
+        auto slabRelativeId = (nodeId - 1) / FirstSlabNodeCount + 1;
+        uint32_t slabIndex = 0;
+        while (slabRelativeId >> (slabIndex + 1)) {
+            ++slabIndex;
+        }
+        auto pSlab = mSlabs[slabIndex].load(std::memory_order_acquire);
+        return &pSlab[nodeId - get_slab_first_node_id(slabIndex)];
+    }
+
+    inline void grow()
+    {
+        std::lock_guard<std::mutex> lock(mGrowMutex);
+        if (mHead.load(std::memory_order_acquire) & NodeIdMask) {
+            return;
+        }
+        if (mSlabCount == MaxSlabCount) {
+            throw std::bad_alloc();
+        }
+        auto slabIndex = mSlabCount++;
+        auto nodeCount = FirstSlabNodeCount << slabIndex;
+        auto firstNodeId = get_slab_first_node_id(slabIndex);
+        auto pSlab = new Node[nodeCount];
+        for (uint32_t i = 0; i < nodeCount; ++i) {
+            pSlab[i].id = firstNodeId + i;
+            pSlab[i].next.store(i + 1 < nodeCount ? firstNodeId + i + 1 : 0, std::memory_order_relaxed);
+        }
+        mSlabs[slabIndex].store(pSlab, std::memory_order_release);
+        ReferencePoolCounters<TagType>::get_instance().on_grow(nodeCount);
+
+        // NOTE : Nodes may have been returned to the free list since it was checked
+        //  above, so the new slab is spliced onto the front of the existing list...
+        auto pLastNode = &pSlab[nodeCount - 1];
+        auto head = mHead.load(std::memory_order_relaxed);
+        do {
+            pLastNode->next.store((uint32_t)(head & NodeIdMask), std::memory_order_relaxed);
+        } while (!mHead.compare_exchange_weak(head, get_next_tag(head) | firstNodeId, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::atomic_uint64_t mHead { };
+    std::array<std::atomic<Node*>, MaxSlabCount> mSlabs { };
+    uint32_t mSlabCount { };
+    std::mutex mGrowMutex;
+
+    ReferencePool() = default;
+    ReferencePool(const ReferencePool&) = delete;
+    ReferencePool& operator=(const ReferencePool&) = delete;
+};
+
+/**
+Allocator used with std::allocate_shared<>() to allocate Reference<> control blocks from a ReferencePool<>
+@param <T> The type of object to allocate
+@param <TagType> The type used to group ReferencePoolStats
+    @note Single object allocations are served by ReferencePool<>, array allocations fall back to std::allocator<>
+*/
+template <typename T, typename TagType>
+class ReferencePoolAllocator final
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = ReferencePoolAllocator<U, TagType>;
+    };
+
+    ReferencePoolAllocator() = default;
+
+    template <typename U>
+    inline ReferencePoolAllocator(const ReferencePoolAllocator<U, TagType>&)
+    {
+    }
+
+    inline T* allocate(size_t count)
+    {
+        return count == 1 ? ReferencePool<T, TagType>::get_instance().allocate() : std::allocator<T>().allocate(count);
+    }
+
+    inline void deallocate(T* p, size_t count)
+    {
+        if (count == 1) {
+            ReferencePool<T, TagType>::get_instance().deallocate(p);
+        } else {
+            std::allocator<T>().deallocate(p, count);
+        }
+    }
+
+    template <typename U>
+    inline friend bool operator==(const ReferencePoolAllocator&, const ReferencePoolAllocator<U, TagType>&)
+    {
+        return true;
+    }
+
+    template <typename U>
+    inline friend bool operator!=(const ReferencePoolAllocator&, const ReferencePoolAllocator<U, TagType>&)
+    {
+        return false;
+    }
+};
+
+} // namespace detail
+} // namespace gvk
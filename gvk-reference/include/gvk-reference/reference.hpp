@@ -26,10 +26,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "gvk-reference/reference-pool.hpp"
+
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -87,6 +93,25 @@ private:
     uint64_t mValue { };
 };
 
+/**
+Specifies the number of shards used by the Reference<> registry for a given object type
+@param <ObjType> The type of object to specify the registry shard count for
+    @note The default shard count is 1, which serializes all registry access through a single mutex
+    @note Object types may opt into a sharded registry by declaring a static constexpr size_t ReferenceRegistryShardCount member or by specializing this template
+    @note The shard count must be a power of two
+*/
+template <typename ObjType, typename = void>
+struct ReferenceRegistryShardCount
+{
+    static constexpr size_t value = 1;
+};
+
+template <typename ObjType>
+struct ReferenceRegistryShardCount<ObjType, std::void_t<decltype(ObjType::ReferenceRegistryShardCount)>>
+{
+    static constexpr size_t value = ObjType::ReferenceRegistryShardCount;
+};
+
 /**
 Provides high level control over a ref counted, enumerable, managed object
 @param <ObjType> The type of object to manage
@@ -177,7 +202,7 @@ public:
     {
         reset(nullref);
         mId = IdType(newref);
-        mspLifetimeMonitor = std::make_shared<LifetimeMonitor>(mId);
+        mspLifetimeMonitor = create_lifetime_monitor(mId);
         Registry::get_instance().insert(mspLifetimeMonitor);
     }
 
@@ -190,7 +215,7 @@ public:
     {
         reset(nullref);
         mId = id;
-        mspLifetimeMonitor = std::make_shared<LifetimeMonitor>(mId);
+        mspLifetimeMonitor = create_lifetime_monitor(mId);
         Registry::get_instance().insert(mspLifetimeMonitor);
     }
 
@@ -312,7 +337,28 @@ public:
         return Registry::get_instance().enumerate(processReference);
     }
 
+    /**
+    Gets ReferencePoolStats for Reference<> objects with the same ObjType and IdType
+    @return ReferencePoolStats for Reference<> objects with the same ObjType and IdType
+        @note ReferencePoolStats will be zeroed unless ReferenceUsesPoolAllocator<ObjType> is enabled
+    */
+    inline static ReferencePoolStats get_pool_stats()
+    {
+        return detail::ReferencePoolCounters<LifetimeMonitor>::get_instance().get_stats();
+    }
+
 private:
+    class LifetimeMonitor;
+
+    inline static std::shared_ptr<LifetimeMonitor> create_lifetime_monitor(const IdType& id)
+    {
+        if constexpr (ReferenceUsesPoolAllocator<ObjType>::value) {
+            return std::allocate_shared<LifetimeMonitor>(detail::ReferencePoolAllocator<LifetimeMonitor, LifetimeMonitor>(), id);
+        } else {
+            return std::make_shared<LifetimeMonitor>(id);
+        }
+    }
+
     class LifetimeMonitor final
     {
     public:
@@ -352,29 +398,35 @@ private:
     class Registry final
     {
     public:
+        static constexpr size_t ShardCount = ReferenceRegistryShardCount<ObjType>::value;
+        static_assert(ShardCount && !(ShardCount & (ShardCount - 1)), "ReferenceRegistryShardCount<> must be a power of two");
+
         inline void insert(std::shared_ptr<LifetimeMonitor> spReference)
         {
             assert(spReference && "References to deleted objects must be cleared upon destruction; gvk maintenance required");
-            std::lock_guard<std::mutex> lock(mMutex);
-            auto success = mWeakReferences.insert({ spReference->get_id(), spReference }).second;
+            auto& shard = get_shard(spReference->get_id());
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto success = shard.weakReferences.insert({ spReference->get_id(), spReference }).second;
             (void)success;
             assert(success && "Failed to insert std::shared_ptr<LifetimeMonitor>; was a Reference<> initialized with a duplicate id?");
         }
 
         inline void erase(const IdType& id)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            auto success = mWeakReferences.erase(id);
+            auto& shard = get_shard(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto success = shard.weakReferences.erase(id);
             (void)success;
             assert(success && "References to deleted objects must be cleared upon destruction; gvk maintenance required");
         }
 
         inline Reference get(const IdType& id)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            auto itr = mWeakReferences.find(id);
+            auto& shard = get_shard(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto itr = shard.weakReferences.find(id);
             Reference reference;
-            if (itr != mWeakReferences.end()) {
+            if (itr != shard.weakReferences.end()) {
                 reference.mId = itr->first;
                 reference.mspLifetimeMonitor = itr->second.lock();
                 assert(reference && "References to deleted objects must be cleared upon destruction; gvk maintenance required");
@@ -385,12 +437,17 @@ private:
         template <typename ProcessReferenceFunctionType>
         inline void enumerate(ProcessReferenceFunctionType processReference)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& itr : mWeakReferences) {
-                Reference reference;
-                reference.mId = itr.first;
-                reference.mspLifetimeMonitor = itr.second.lock();
-                processReference(reference);
+            // NOTE : Shards are locked one at a time, References<> inserted into or
+            //  erased from a shard that has already been visited during enumeration
+            //  will not be observed...see the notes on Reference<>::enumerate()
+            for (auto& shard : mShards) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                for (const auto& itr : shard.weakReferences) {
+                    Reference reference;
+                    reference.mId = itr.first;
+                    reference.mspLifetimeMonitor = itr.second.lock();
+                    processReference(reference);
+                }
             }
         }
 
@@ -401,8 +458,30 @@ private:
         }
 
     private:
-        std::mutex mMutex;
-        std::unordered_map<IdType, std::weak_ptr<LifetimeMonitor>> mWeakReferences;
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<IdType, std::weak_ptr<LifetimeMonitor>> weakReferences;
+        };
+
+        inline Shard& get_shard(const IdType& id)
+        {
+            if constexpr (ShardCount == 1) {
+                (void)id;
+                return mShards[0];
+            } else {
+                // NOTE : std::hash<> is often the identity function for integral ids, so
+                //  the hash is mixed before masking to keep sequential ids from piling
+                //  into neighboring shards...
+                auto hash = (uint64_t)std::hash<IdType> { }(id);
+                hash ^= hash >> 33;
+                hash *= 0xff51afd7ed558ccdull;
+                hash ^= hash >> 33;
+                return mShards[hash & (ShardCount - 1)];
+            }
+        }
+
+        std::array<Shard, ShardCount> mShards;
 
         Registry() = default;
         Registry(const Registry&) = delete;
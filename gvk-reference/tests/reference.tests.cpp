@@ -33,8 +33,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <iostream>
 #include <random>
 #include <string>
+#include <thread>
 
 constexpr size_t TestCount = 256;
 
@@ -43,6 +46,18 @@ struct Widget
     size_t value{ };
 };
 
+struct ShardedWidget
+{
+    static constexpr size_t ReferenceRegistryShardCount = 64;
+    size_t value{ };
+};
+
+struct PooledWidget
+{
+    static constexpr bool ReferenceUsesPoolAllocator = true;
+    size_t value{ };
+};
+
 struct ExpectedId { size_t value{ }; };
 struct ExpectedRefCount { size_t value{ }; };
 struct ExpectedValue { size_t value{ }; };
@@ -268,3 +283,115 @@ TEST(Reference, Enumerate)
     );
     EXPECT_EQ(actualValues, expectedValues);
 }
+
+TEST(Reference, PoolAllocation)
+{
+    // Create a collection of pooled references...
+    std::vector<gvk::Reference<PooledWidget>> references(TestCount);
+    for (size_t i = 0; i < references.size(); ++i) {
+        references[i].reset(gvk::newref);
+        references[i]->value = i;
+    }
+    auto stats = gvk::Reference<PooledWidget>::get_pool_stats();
+    EXPECT_EQ(stats.liveCount, references.size());
+    EXPECT_EQ(stats.highWaterMark, references.size());
+    EXPECT_GE(stats.capacity, references.size());
+    for (size_t i = 0; i < references.size(); ++i) {
+        EXPECT_EQ(gvk::Reference<PooledWidget>::get(references[i].get_id()), references[i]);
+        EXPECT_EQ(references[i]->value, i);
+    }
+
+    // Destroy and recreate the references, the pool should recycle its storage
+    //  rather than growing...
+    auto capacity = stats.capacity;
+    for (auto& reference : references) {
+        reference = gvk::nullref;
+    }
+    EXPECT_EQ(gvk::Reference<PooledWidget>::get_pool_stats().liveCount, 0);
+    for (auto& reference : references) {
+        reference.reset(gvk::newref);
+    }
+    stats = gvk::Reference<PooledWidget>::get_pool_stats();
+    EXPECT_EQ(stats.liveCount, references.size());
+    EXPECT_EQ(stats.highWaterMark, references.size());
+    EXPECT_EQ(stats.capacity, capacity);
+
+    // Create and destroy references from many threads...
+    asio::thread_pool threadPool;
+    for (size_t i = 0; i < TestCount; ++i) {
+        asio::post(threadPool,
+            [i]()
+            {
+                std::vector<gvk::Reference<PooledWidget>> threadReferences(TestCount);
+                for (auto& threadReference : threadReferences) {
+                    threadReference.reset(gvk::newref);
+                    threadReference->value = i;
+                }
+                for (const auto& threadReference : threadReferences) {
+                    EXPECT_EQ(threadReference->value, i);
+                }
+            }
+        );
+    }
+    threadPool.wait();
+    references.clear();
+    EXPECT_EQ(gvk::Reference<PooledWidget>::get_pool_stats().liveCount, 0);
+    EXPECT_EQ(gvk::Reference<Widget>::get_pool_stats().capacity, 0);
+}
+
+template <typename ObjType>
+double measure_lookup_throughput(const std::vector<gvk::Reference<ObjType>>& references, size_t threadCount)
+{
+    // Each thread looks up every reference by id several times, returning the
+    //  number of lookups per second across all threads...
+    constexpr size_t LookupPassCount = 64;
+    std::atomic_size_t failureCount { };
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+        threads.emplace_back(
+            [&references, &failureCount, threadIndex]()
+            {
+                for (size_t pass = 0; pass < LookupPassCount; ++pass) {
+                    for (size_t i = 0; i < references.size(); ++i) {
+                        const auto& reference = references[(i + threadIndex) % references.size()];
+                        if (gvk::Reference<ObjType>::get(reference.get_id()) != reference) {
+                            ++failureCount;
+                        }
+                    }
+                }
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(failureCount, 0);
+    auto seconds = std::chrono::duration<double>(end - begin).count();
+    return seconds ? (double)(threadCount * LookupPassCount * references.size()) / seconds : 0;
+}
+
+TEST(Reference, LookupThroughput)
+{
+    // Create collections of references using the default single mutex registry
+    //  and a sharded registry...
+    std::vector<gvk::Reference<Widget>> references(TestCount * 16);
+    for (auto& reference : references) {
+        reference.reset(gvk::newref);
+    }
+    std::vector<gvk::Reference<ShardedWidget>> shardedReferences(references.size());
+    for (auto& shardedReference : shardedReferences) {
+        shardedReference.reset(gvk::newref);
+    }
+
+    // Compare lookup throughput at varying levels of contention...
+    for (size_t threadCount : { 1, 4, 16 }) {
+        auto throughput = measure_lookup_throughput(references, threadCount);
+        auto shardedThroughput = measure_lookup_throughput(shardedReferences, threadCount);
+        std::cout << "[ Reference<>::get() ] " << threadCount << " thread(s) : "
+            << (size_t)throughput << " lookups/s (1 shard), "
+            << (size_t)shardedThroughput << " lookups/s (" << gvk::ReferenceRegistryShardCount<ShardedWidget>::value << " shards)" << std::endl;
+    }
+}
@@ -111,6 +111,14 @@ std::vector<gvk::xml::Structure> get_restore_info_structures(const gvk::xml::Man
                 structure.members.push_back(gvk::cppgen::create_parameter("GvkMappedMemoryInfo", "mappedMemoryInfo"));
                 gvk::cppgen::add_array_members_to_structure("VkBindBufferMemoryInfo", "bufferBindInfoCount", "pBufferBindInfos", structure);
                 gvk::cppgen::add_array_members_to_structure("VkBindImageMemoryInfo", "imageBindInfoCount", "pImageBindInfos", structure);
+
+                // NOTE : When dataRegionCount is 0 the VkDeviceMemory data contains the
+                //  entire allocation, unless the restore point was created with
+                //  GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT, in which case
+                //  nothing was bound and there's no data.  Otherwise each VkBufferCopy
+                //  describes a range of the allocation (srcOffset) and where it's packed
+                //  in the data (dstOffset).
+                gvk::cppgen::add_array_members_to_structure("VkBufferCopy", "dataRegionCount", "pDataRegions", structure);
             }
             if (handle.name == "VkAccelerationStructureKHR") {
                 gvk::xml::Structure serializationInfo;
@@ -226,7 +234,7 @@ int main(int, const char*[])
         };
 
         gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
+        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(manifest, apiElements, "gvk-restore-info/detail/comparison-manual.hpp");
         gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements);
 
         // NOTE : GvkStateTrackedObject is defined in VK_LAYER_INTEL_gvk_state_tracker.h
@@ -245,6 +253,7 @@ int main(int, const char*[])
         gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
         gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
+        gvk::cppgen::StructureEnumeratePointersGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
         gvk::cppgen::StructureSerializationGenerator::generate(apiElements);
         apiElements.manuallyImplemented.insert("GvkStateTrackedObject");
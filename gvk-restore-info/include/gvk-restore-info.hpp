@@ -32,6 +32,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-info/generated/restore-info-structure-create-copy.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-deserialization.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-destroy-copy.hpp"
+#include "gvk-restore-info/generated/restore-info-structure-enumerate-pointers.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-get-stype.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-serialization.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-to-string.hpp"
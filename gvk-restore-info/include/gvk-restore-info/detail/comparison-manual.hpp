@@ -0,0 +1,58 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/detail/comparison-utilities.hpp"
+#include "VK_LAYER_INTEL_gvk_state_tracker.hpp"
+
+namespace gvk {
+namespace detail {
+
+// NOTE : GvkStateTrackedObject comparison operators are defined in
+//  VK_LAYER_INTEL_gvk_state_tracker.hpp, compare() and hash() are provided here
+//  so restore infos with GvkStateTrackedObject members can be compared/hashed.
+template <>
+inline int compare<GvkStateTrackedObject>(const GvkStateTrackedObject& lhs, const GvkStateTrackedObject& rhs)
+{
+    if (auto result = compare(lhs.type, rhs.type)) {
+        return result;
+    }
+    if (auto result = compare(lhs.handle, rhs.handle)) {
+        return result;
+    }
+    return compare(lhs.dispatchableHandle, rhs.dispatchableHandle);
+}
+
+template <>
+inline uint64_t hash<GvkStateTrackedObject>(const GvkStateTrackedObject& obj)
+{
+    return hash_tuple(gvk::make_tuple(obj));
+}
+
+} // namespace detail
+} // namespace gvk
@@ -46,7 +46,8 @@ public:
         file << "#include \"gvk-structures.hpp\"" << std::endl;
         file << std::endl;
         file << "#include <cassert>" << std::endl;
-        file << "#include <fstream>" << std::endl;
+        file << "#include <istream>" << std::endl;
+        file << "#include <memory>" << std::endl;
         file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::restore_point");
         file << std::endl;
@@ -54,11 +55,11 @@ public:
         file << "{" << std::endl;
         file << "    gvk_result_scope_begin(VK_SUCCESS) {" << std::endl;
         file << "        auto cmdsPath = (mApplyInfo.path / \"VkCommandBuffer\" / to_hex_string(restorePointObject.handle)).replace_extension(\".cmds\");" << std::endl;
-        file << "        if (std::filesystem::exists(cmdsPath)) {" << std::endl;
-        file << "            std::ifstream cmdsFile(cmdsPath, std::ios::binary);" << std::endl;
-        file << "            gvk_result(cmdsFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+        file << "        auto upCmdsFile = open_resource_data(mApplyInfo, cmdsPath);" << std::endl;
+        file << "        if (upCmdsFile) {" << std::endl;
+        file << "            auto& cmdsFile = *upCmdsFile;" << std::endl;
         file << "            Auto<GvkCommandBufferRestoreInfo> restoreInfo;" << std::endl;
-        file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"VkCommandBuffer\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+        file << "            gvk_result(read_object_restore_info(mApplyInfo, \"VkCommandBuffer\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
         file << "            auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);" << std::endl;
         file << "            while (!cmdsFile.eof()) {" << std::endl;
         file << "                GvkCommandStructureType commandStructureType = GVK_COMMAND_STRUCTURE_TYPE_UNDEFINED;" << std::endl;
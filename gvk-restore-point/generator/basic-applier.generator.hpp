@@ -86,6 +86,8 @@ private:
         file << "#include \"VK_LAYER_INTEL_gvk_state_tracker.hpp\"" << std::endl;
         file << std::endl;
         file << "#include <map>" << std::endl;
+        file << "#include <memory>" << std::endl;
+        file << "#include <mutex>" << std::endl;
         file << "#include <set>" << std::endl;
         file << "#include <vector>" << std::endl;
         file << std::endl;
@@ -105,6 +107,8 @@ private:
         file << "    virtual VkResult restore_object_state(const GvkStateTrackedObject& restorePointObject);" << std::endl;
         file << "    virtual VkResult restore_object_name(const GvkStateTrackedObject& restorePointObject);" << std::endl;
         file << "    virtual VkResult restore_object_name(const GvkStateTrackedObject& restorePointObject, uint32_t dependencyCount, const GvkStateTrackedObject* pDependencies, const char* pName) = 0;" << std::endl;
+        file << "    VkResult read_object_dependencies(const GvkStateTrackedObject& restorePointObject, std::vector<GvkStateTrackedObject>& dependencies);" << std::endl;
+        file << "    void clear_read_restore_infos();" << std::endl;
         file << "    VkResult restore_dependencies(uint32_t dependencyCount, const GvkStateTrackedObject* pDependencies);" << std::endl;
         file << "    VkResult restore_dependencies_state(uint32_t dependencyCount, const GvkStateTrackedObject* pDependencies);" << std::endl;
         file << "    virtual void destroy_object(const GvkStateTrackedObject& restorePointObject);" << std::endl;
@@ -128,6 +132,22 @@ private:
         file << "    ApplyInfo mApplyInfo{ };" << std::endl;
         file << "    VkResult mResult{ VK_ERROR_INITIALIZATION_FAILED };" << std::endl;
         file << "private:" << std::endl;
+        file << "    template <typename RestoreInfoType>" << std::endl;
+        file << "    std::shared_ptr<Auto<RestoreInfoType>> take_read_restore_info(const GvkStateTrackedObject& restorePointObject)" << std::endl;
+        file << "    {" << std::endl;
+        file << "        std::lock_guard<std::mutex> lock(mReadRestoreInfosMutex);" << std::endl;
+        file << "        auto itr = mReadRestoreInfos.find(restorePointObject);" << std::endl;
+        file << "        if (itr == mReadRestoreInfos.end()) {" << std::endl;
+        file << "            return nullptr;" << std::endl;
+        file << "        }" << std::endl;
+        file << "        auto spRestoreInfo = std::static_pointer_cast<Auto<RestoreInfoType>>(itr->second);" << std::endl;
+        file << "        mReadRestoreInfos.erase(itr);" << std::endl;
+        file << "        return spRestoreInfo;" << std::endl;
+        file << "    }" << std::endl;
+        file << "    // NOTE : Restore infos read by read_object_dependencies() are kept until" << std::endl;
+        file << "    //  restore_object() takes them so each one is only deserialized once" << std::endl;
+        file << "    std::mutex mReadRestoreInfosMutex;" << std::endl;
+        file << "    std::map<GvkStateTrackedObject, std::shared_ptr<void>> mReadRestoreInfos;" << std::endl;
         file << "    BasicApplier(const BasicApplier&) = delete;" << std::endl;
         file << "    BasicApplier& operator=(const BasicApplier&) = delete;" << std::endl;
         file << "};" << std::endl;
@@ -159,8 +179,12 @@ private:
             if (handle.alias.empty()) {
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
-                file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            auto spRestoreInfo = take_read_restore_info<" << get_restore_info_type_name(handle.name) << ">(restorePointObject);" << std::endl;
+                file << "            if (!spRestoreInfo) {" << std::endl;
+                file << "                spRestoreInfo = std::make_shared<Auto<" << get_restore_info_type_name(handle.name) << ">>();" << std::endl;
+                file << "                gvk_result(read_object_restore_info(mApplyInfo, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), *spRestoreInfo));" << std::endl;
+                file << "            }" << std::endl;
+                file << "            const auto& restoreInfo = *spRestoreInfo;" << std::endl;
                 file << "            gvk_result(restore_dependencies(restoreInfo->dependencyCount, restoreInfo->pDependencies));" << std::endl;
                 file << "            gvk_result(restore_" << handle.name << "(restorePointObject, *restoreInfo));" << std::endl;
                 file << "        } break;" << std::endl;
@@ -184,7 +208,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
                 file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
                 file << "            gvk_result(restore_dependencies_state(restoreInfo->dependencyCount, restoreInfo->pDependencies));" << std::endl;
                 file << "            gvk_result(restore_" << handle.name << "_state(restorePointObject, *restoreInfo));" << std::endl;
                 file << "            if (restoreInfo->flags & GVK_STATE_TRACKED_OBJECT_STATUS_DESTROYED_BIT) {" << std::endl;
@@ -211,7 +235,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
                 file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
                 file << "            gvk_result(restore_object_name(restorePointObject, restoreInfo->dependencyCount, restoreInfo->pDependencies, restoreInfo->pName));" << std::endl;
                 file << "        } break;" << std::endl;
             }
@@ -224,6 +248,38 @@ private:
         file << "    return gvkResult;" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
+        file << "VkResult BasicApplier::read_object_dependencies(const GvkStateTrackedObject& restorePointObject, std::vector<GvkStateTrackedObject>& dependencies)" << std::endl;
+        file << "{" << std::endl;
+        file << "    gvk_result_scope_begin(VK_SUCCESS) {" << std::endl;
+        file << "        switch (restorePointObject.type) {" << std::endl;
+        for (const auto& handleItr : manifest.handles) {
+            const auto& handle = handleItr.second;
+            if (handle.alias.empty()) {
+                CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
+                file << "        case " << handle.vkObjectType << ": {" << std::endl;
+                file << "            auto spRestoreInfo = std::make_shared<Auto<" << get_restore_info_type_name(handle.name) << ">>();" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), *spRestoreInfo));" << std::endl;
+                file << "            const auto& restoreInfo = *spRestoreInfo;" << std::endl;
+                file << "            dependencies.insert(dependencies.end(), restoreInfo->pDependencies, restoreInfo->pDependencies + restoreInfo->dependencyCount);" << std::endl;
+                file << "            std::lock_guard<std::mutex> lock(mReadRestoreInfosMutex);" << std::endl;
+                file << "            mReadRestoreInfos[restorePointObject] = spRestoreInfo;" << std::endl;
+                file << "        } break;" << std::endl;
+            }
+        }
+        file << "        default: {" << std::endl;
+        file << "            gvk_result(VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+        file << "        } break;" << std::endl;
+        file << "        }" << std::endl;
+        file << "    } gvk_result_scope_end;" << std::endl;
+        file << "    return gvkResult;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "void BasicApplier::clear_read_restore_infos()" << std::endl;
+        file << "{" << std::endl;
+        file << "    std::lock_guard<std::mutex> lock(mReadRestoreInfosMutex);" << std::endl;
+        file << "    mReadRestoreInfos.clear();" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
         file << "VkResult BasicApplier::restore_dependencies(uint32_t dependencyCount, const GvkStateTrackedObject* pDependencies)" << std::endl;
         file << "{" << std::endl;
         file << "    gvk_result_scope_begin(VK_SUCCESS) {" << std::endl;
@@ -296,7 +352,10 @@ private:
                                     }
                                 }
                                 file << "            gvk_result(process_GvkCommandStructure" << string::strip_vk(createCommand.name) << "(restorePointObject, restoreInfo, commandStructure));" << std::endl;
-                                file << "            gvk_result(update_command_structure_handles(mApplyInfo.gvkRestorePoint->objectMap.get_restored_objects(), commandStructure));" << std::endl;
+                                file << "            {" << std::endl;
+                                file << "                auto restoredObjectsLock = mApplyInfo.gvkRestorePoint->objectMap.get_shared_lock();" << std::endl;
+                                file << "                gvk_result(update_command_structure_handles(mApplyInfo.gvkRestorePoint->objectMap.get_restored_objects(), commandStructure));" << std::endl;
+                                file << "            }" << std::endl;
                                 file << "            " << handle.name << " handle = restoreInfo.handle;" << std::endl;
                                 file << "            commandStructure." << outHandleParameterName << " = &handle;" << std::endl;
                                 file << "            gvk_result(detail::execute_command_structure(mApplyInfo.dispatchTable, commandStructure));" << std::endl;
@@ -84,6 +84,7 @@ private:
         file << "protected:" << std::endl;
         file << "    static void process_object(const GvkStateTrackedObject* pStateTrackedObject, const VkBaseInStructure* pInfo, void* pUserData);" << std::endl;
         file << "    static void process_dependency(const GvkStateTrackedObject* pStateTrackedObject, const VkBaseInStructure* pInfo, void* pUserData);" << std::endl;
+        file << "    VkResult process_restore_info(const GvkStateTrackedObject& stateTrackedObject, const std::vector<GvkStateTrackedObject>& dependencies);" << std::endl;
         for (const auto& handleItr : manifest.handles) {
             const auto& handle = handleItr.second;
             if (handle.alias.empty()) {
@@ -91,6 +92,13 @@ private:
                 file << "    virtual VkResult process_" << handle.name << "(" << get_restore_info_type_name(handle.name) << "& restoreInfo); " << std::endl;
             }
         }
+        file << "    class DeferredObject final" << std::endl;
+        file << "    {" << std::endl;
+        file << "    public:" << std::endl;
+        file << "        GvkStateTrackedObject object { };" << std::endl;
+        file << "        std::vector<GvkStateTrackedObject> dependencies;" << std::endl;
+        file << "    };" << std::endl;
+        file << "    std::vector<DeferredObject> mDeferredObjects;" << std::endl;
         file << "    std::unordered_set<HandleId<uint64_t, uint64_t>> mProcessedHandles;" << std::endl;
         file << "    CreateInfo mCreateInfo{ };" << std::endl;
         file << "    VkResult mResult { VK_ERROR_INITIALIZATION_FAILED };" << std::endl;
@@ -114,6 +122,8 @@ private:
         file << "#include \"gvk-restore-point/layer.hpp\"" << std::endl;
         file << "#include \"VK_LAYER_INTEL_gvk_state_tracker.hpp\"" << std::endl;
         file << std::endl;
+        file << "#include <utility>" << std::endl;
+        file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::restore_point");
         file << std::endl;
         file << "BasicCreator::~BasicCreator()" << std::endl;
@@ -129,63 +139,75 @@ private:
         file << "    gvk_result_scope_begin(VK_SUCCESS) {" << std::endl;
         file << "        if (pCreator->mProcessedHandles.insert(HandleId<uint64_t, uint64_t>(pStateTrackedObject->dispatchableHandle, pStateTrackedObject->handle)).second) {" << std::endl;
         file << "            pCreator->mCreateInfo.gvkRestorePoint->objectMap.register_object_restoration(*pStateTrackedObject, *pStateTrackedObject);" << std::endl;
-        file << "            GvkStateTrackedObjectInfo stateTrackedObjectInfo { };" << std::endl;
-        file << "            gvkGetStateTrackedObjectInfo(pStateTrackedObject, &stateTrackedObjectInfo);" << std::endl;
         file << "            DependencyEnumerationInfo dependencyEnumerationInfo { };" << std::endl;
         file << "            dependencyEnumerationInfo.pCreator = pCreator;" << std::endl;
         file << "            GvkStateTrackedObjectEnumerateInfo enumerateInfo { };" << std::endl;
         file << "            enumerateInfo.pfnCallback = process_dependency;" << std::endl;
         file << "            enumerateInfo.pUserData = &dependencyEnumerationInfo;" << std::endl;
         file << "            gvkEnumerateStateTrackedObjectDependencies(pStateTrackedObject, &enumerateInfo);" << std::endl;
-        file << "            switch (pStateTrackedObject->type) {" << std::endl;
+        file << "            if (pCreator->mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_PARALLEL_OBJECT_PROCESSING_BIT) {" << std::endl;
+        file << "                pCreator->mDeferredObjects.push_back({ *pStateTrackedObject, std::move(dependencyEnumerationInfo.dependencies) });" << std::endl;
+        file << "            } else {" << std::endl;
+        file << "                gvk_result(pCreator->process_restore_info(*pStateTrackedObject, dependencyEnumerationInfo.dependencies));" << std::endl;
+        file << "            }" << std::endl;
+        file << "        }" << std::endl;
+        file << "    } gvk_result_scope_end;" << std::endl;
+        file << "    pCreator->mResult = gvkResult;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "VkResult BasicCreator::process_restore_info(const GvkStateTrackedObject& stateTrackedObject, const std::vector<GvkStateTrackedObject>& dependencies)" << std::endl;
+        file << "{" << std::endl;
+        file << "    gvk_result_scope_begin(VK_SUCCESS) {" << std::endl;
+        file << "        GvkStateTrackedObjectInfo stateTrackedObjectInfo { };" << std::endl;
+        file << "        gvkGetStateTrackedObjectInfo(&stateTrackedObject, &stateTrackedObjectInfo);" << std::endl;
+        file << "        switch (stateTrackedObject.type) {" << std::endl;
         for (const auto& handleItr : manifest.handles) {
             const auto& handle = handleItr.second;
             if (handle.alias.empty()) {
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
-                file << "            case " << handle.vkObjectType << ": {" << std::endl;
-                file << "                auto restoreInfo = get_default<" << get_restore_info_type_name(handle.name) << ">();" << std::endl;
-                file << "                restoreInfo.flags = stateTrackedObjectInfo.flags;" << std::endl;
-                file << "                restoreInfo.handle = (" << handle.name << ")pStateTrackedObject->handle;" << std::endl;
-                file << "                restoreInfo.pName = stateTrackedObjectInfo.pName;" << std::endl;
-                file << "                restoreInfo.dependencyCount = (uint32_t)dependencyEnumerationInfo.dependencies.size();" << std::endl;
-                file << "                restoreInfo.pDependencies = !dependencyEnumerationInfo.dependencies.empty() ? dependencyEnumerationInfo.dependencies.data() : nullptr;" << std::endl;
+                file << "        case " << handle.vkObjectType << ": {" << std::endl;
+                file << "            auto restoreInfo = get_default<" << get_restore_info_type_name(handle.name) << ">();" << std::endl;
+                file << "            restoreInfo.flags = stateTrackedObjectInfo.flags;" << std::endl;
+                file << "            restoreInfo.handle = (" << handle.name << ")stateTrackedObject.handle;" << std::endl;
+                file << "            restoreInfo.pName = stateTrackedObjectInfo.pName;" << std::endl;
+                file << "            restoreInfo.dependencyCount = (uint32_t)dependencies.size();" << std::endl;
+                file << "            restoreInfo.pDependencies = !dependencies.empty() ? dependencies.data() : nullptr;" << std::endl;
                 if (!handle.createInfos.empty()) {
-                    file << "                VkStructureType createInfoType { };" << std::endl;
-                    file << "                gvkGetStateTrackedObjectCreateInfo(pStateTrackedObject, &createInfoType, nullptr);" << std::endl;
+                    file << "            VkStructureType createInfoType { };" << std::endl;
+                    file << "            gvkGetStateTrackedObjectCreateInfo(&stateTrackedObject, &createInfoType, nullptr);" << std::endl;
                     for (const auto& createInfoType : handle.createInfos) {
                         const auto& createInfoItr = manifest.structures.find(createInfoType);
                         assert(createInfoItr != manifest.structures.end());
                         const auto& createInfo = createInfoItr->second;
                         CompileGuardGenerator createInfoCompileGuard(file, get_inner_scope_compile_guards(handle.compileGuards, createInfo.compileGuards));
-                        file << "                " << createInfo.name << " " << get_create_info_variable_name(createInfo.name) << " { };" << std::endl;
+                        file << "            " << createInfo.name << " " << get_create_info_variable_name(createInfo.name) << " { };" << std::endl;
                     }
-                    file << "                switch (createInfoType) {" << std::endl;
+                    file << "            switch (createInfoType) {" << std::endl;
                     for (const auto& createInfoType : handle.createInfos) {
                         const auto& createInfoItr = manifest.structures.find(createInfoType);
                         assert(createInfoItr != manifest.structures.end());
                         const auto& createInfo = createInfoItr->second;
                         CompileGuardGenerator createInfoCompileGuard(file, get_inner_scope_compile_guards(handle.compileGuards, createInfo.compileGuards));
-                        file << "                case " << createInfo.vkStructureType << ": {" << std::endl;
-                        file << "                    gvkGetStateTrackedObjectCreateInfo(pStateTrackedObject, &createInfoType, (VkBaseOutStructure*)&" << get_create_info_variable_name(createInfo.name) << ");" << std::endl;
-                        file << "                    restoreInfo.p" << string::strip_vk(createInfo.name) << " = &" << get_create_info_variable_name(createInfo.name) << ";" << std::endl;
-                        file << "                } break;" << std::endl;
+                        file << "            case " << createInfo.vkStructureType << ": {" << std::endl;
+                        file << "                gvkGetStateTrackedObjectCreateInfo(&stateTrackedObject, &createInfoType, (VkBaseOutStructure*)&" << get_create_info_variable_name(createInfo.name) << ");" << std::endl;
+                        file << "                restoreInfo.p" << string::strip_vk(createInfo.name) << " = &" << get_create_info_variable_name(createInfo.name) << ";" << std::endl;
+                        file << "            } break;" << std::endl;
                     }
-                    file << "                default: {" << std::endl;
-                    file << "                    gvk_result(VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
-                    file << "                } break;" << std::endl;
-                    file << "                }" << std::endl;
+                    file << "            default: {" << std::endl;
+                    file << "                gvk_result(VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+                    file << "            } break;" << std::endl;
+                    file << "            }" << std::endl;
                 }
-                file << "                gvk_result(pCreator->process_" << handle.name << "(restoreInfo));" << std::endl;
-                file << "            } break;" << std::endl;
+                file << "            gvk_result(process_" << handle.name << "(restoreInfo));" << std::endl;
+                file << "        } break;" << std::endl;
             }
         }
-        file << "            default: {" << std::endl;
-        file << "                gvk_result(VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
-        file << "            } break;" << std::endl;
-        file << "            }" << std::endl;
+        file << "        default: {" << std::endl;
+        file << "            gvk_result(VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+        file << "        } break;" << std::endl;
         file << "        }" << std::endl;
         file << "    } gvk_result_scope_end;" << std::endl;
-        file << "    pCreator->mResult = gvkResult;" << std::endl;
+        file << "    return gvkResult;" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
         file << "void BasicCreator::process_dependency(const GvkStateTrackedObject* pStateTrackedObject, const VkBaseInStructure* pInfo, void* pUserData)" << std::endl;
@@ -44,7 +44,7 @@ public:
         file << "#include \"gvk-structures.hpp\"" << std::endl;
         file << std::endl;
         file << "#include <cassert>" << std::endl;
-        file << "#include <fstream>" << std::endl;
+        file << "#include <sstream>" << std::endl;
         file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::restore_point");
         file << std::endl;
@@ -56,20 +56,9 @@ public:
         file << "    assert(userData.pCreateInfo);" << std::endl;
         file << "    assert(userData.commandBuffer);" << std::endl;
         file << "    ++((CmdEnumerationUserData*)pUserData)->cmdCount;" << std::endl;
-        file << "    if (!userData.cmdsFile.is_open()) {" << std::endl;
-        file << "        auto path = userData.pCreateInfo->path / \"VkCommandBuffer\";" << std::endl;
-        file << "        if (userData.pCreateInfo->gvkRestorePoint->createFlags & (GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT | GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BIT)) {" << std::endl;
-        file << "            std::filesystem::create_directories(path);" << std::endl;
-        file << "        }" << std::endl;
-        file << "        path /= to_hex_string(userData.commandBuffer);" << std::endl;
-        file << "        if (userData.pCreateInfo->gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT) {" << std::endl;
-        file << "            userData.cmdsFile.open(path.replace_extension(\"cmds\"), std::ios::binary);" << std::endl;
-        file << "        }" << std::endl;
-        file << "        if (userData.pCreateInfo->gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BIT) {" << std::endl;
-        file << "            userData.jsonFile.open(path.replace_extension(\"cmds.json\"));" << std::endl;
-        file << "        }" << std::endl;
+        file << "    if (userData.pCreateInfo->gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT) {" << std::endl;
+        file << "        userData.cmdsFile.write((char*)&((const GvkCommandBaseStructure*)pInfo)->sType, sizeof(GvkCommandStructureType));" << std::endl;
         file << "    }" << std::endl;
-        file << "    userData.cmdsFile.write((char*)&((const GvkCommandBaseStructure*)pInfo)->sType, sizeof(GvkCommandStructureType));" << std::endl;
         file << "    switch (((const GvkCommandBaseStructure*)pInfo)->sType) {" << std::endl;
         for (const auto& commandItr : manifest.commands) {
             const auto& command = commandItr.second;
@@ -110,11 +99,14 @@ public:
         file << "        enumerateInfo.pUserData = &userData;" << std::endl;
         file << "        gvkEnumerateStateTrackedCommandBufferCmds(&stateTrackedObject, &enumerateInfo);" << std::endl;
         file << "        if (userData.cmdCount) {" << std::endl;
+        file << "            auto path = mCreateInfo.path / \"VkCommandBuffer\" / to_hex_string(userData.commandBuffer);" << std::endl;
         file << "            if (userData.pCreateInfo->gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT) {" << std::endl;
-        file << "                gvk_result(userData.cmdsFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+        file << "                auto cmds = userData.cmdsFile.str();" << std::endl;
+        file << "                gvk_result(write_resource_data(mCreateInfo, path.replace_extension(\"cmds\"), 0, cmds.size(), (const uint8_t*)cmds.data()));" << std::endl;
         file << "            }" << std::endl;
         file << "            if (userData.pCreateInfo->gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BIT) {" << std::endl;
-        file << "                gvk_result(userData.jsonFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
+        file << "                auto json = userData.jsonFile.str();" << std::endl;
+        file << "                gvk_result(write_resource_data(mCreateInfo, path.replace_extension(\"cmds.json\"), 0, json.size(), (const uint8_t*)json.data()));" << std::endl;
         file << "            }" << std::endl;
         file << "        }" << std::endl;
         file << "        gvk_result(BasicCreator::process_VkCommandBuffer(restoreInfo));" << std::endl;
@@ -0,0 +1,184 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+
+#include "gvk-restore-point/utilities.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace gvk::restore_point;
+
+static constexpr VkDeviceSize ReadSize = 16 * 1024 * 1024;
+
+static VkBool32 process_result_scope_failure(VkResult, const char*, const char*)
+{
+    // NOTE : Failures are reported per record, don't assert on corrupt records
+    return VK_TRUE;
+}
+
+enum class VerifyResult
+{
+    Verified,
+    Unverifiable,
+    Failed,
+};
+
+static VerifyResult verify_resource_data_record(const ApplyInfo& applyInfo, const std::filesystem::path& path, uint64_t* pResourceDataHash)
+{
+    // NOTE : Records without a ".hash" record can only be verified as unverifiable
+    //  when the restore point was created before ".hash" records were introduced
+    //  (its RestorePointHeader doesn't have a pageSize) or when they're empty.
+    auto hashPath = path;
+    hashPath.replace_extension("hash");
+    if (!resource_data_exists(applyInfo, hashPath)) {
+        std::shared_ptr<const ResourceDataRecord> spResourceDataRecord;
+        if (open_resource_data_record(applyInfo, path, spResourceDataRecord) != VK_SUCCESS) {
+            return VerifyResult::Failed;
+        }
+        return applyInfo.header.pageSize && spResourceDataRecord->size ? VerifyResult::Failed : VerifyResult::Unverifiable;
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        std::vector<PageHash> pageHashes;
+        gvk_result(read_resource_data_hashes(applyInfo, path, pageHashes, pResourceDataHash));
+        gvk_result(get_resource_data_hash(pageHashes) == *pResourceDataHash ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+
+        // Read runs of whole pages and verify each page's hash
+        std::vector<uint8_t> data;
+        for (size_t page_i = 0; page_i < pageHashes.size();) {
+            auto pageCount = (size_t)0;
+            auto dataOffset = pageHashes[page_i].offset;
+            auto dataSize = (VkDeviceSize)0;
+            while (page_i + pageCount < pageHashes.size() && (!dataSize || dataSize + pageHashes[page_i + pageCount].size <= ReadSize)) {
+                dataSize += pageHashes[page_i + pageCount++].size;
+            }
+            data.resize((size_t)dataSize);
+            gvk_result(read_resource_data(applyInfo, path, dataOffset, dataSize, data.data()));
+            for (; pageCount; --pageCount, ++page_i) {
+                const auto& pageHash = pageHashes[page_i];
+                gvk_result(hash_resource_data(data.data() + pageHash.offset - dataOffset, (size_t)pageHash.size) == pageHash.hash ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult == VK_SUCCESS ? VerifyResult::Verified : VerifyResult::Failed;
+}
+
+int main(int argc, const char* ppArgv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage : gvk-restore-point-verify <restore point path> [thread count]" << std::endl;
+        return 1;
+    }
+    gvk::gPfnGvkResultScopeCallback = process_result_scope_failure;
+
+    ApplyInfo applyInfo;
+    applyInfo.path = std::filesystem::u8path(ppArgv[1]);
+    if (open_restore_point(applyInfo) != VK_SUCCESS) {
+        std::cerr << "Failed to open " << applyInfo.path.string() << std::endl;
+        return 1;
+    }
+
+    // Get the key of every ".data" record, each one is verified with its ".hash"
+    //  record if it has one
+    std::vector<std::string> keys;
+    if (applyInfo.archive) {
+        for (const auto& key : applyInfo.archive->get_keys()) {
+            if (std::filesystem::path(key).extension() == ".data") {
+                keys.push_back(key);
+            }
+        }
+    } else if (std::filesystem::is_directory(applyInfo.path)) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(applyInfo.path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".data") {
+                keys.push_back(get_record_key(applyInfo.path, entry.path()));
+            }
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    if (keys.empty()) {
+        std::cerr << "No resource data records found in " << applyInfo.path.string() << std::endl;
+        return 1;
+    }
+
+    // Verify records in parallel
+    auto threadCount = 2 < argc ? (uint32_t)std::stoul(ppArgv[2]) : std::thread::hardware_concurrency();
+    threadCount = std::max(1u, std::min(threadCount, (uint32_t)keys.size()));
+    std::vector<uint64_t> resourceDataHashes(keys.size());
+    std::vector<VerifyResult> results(keys.size(), VerifyResult::Failed);
+    std::atomic_size_t keyIndex { 0 };
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(
+            [&]()
+            {
+                for (auto key_i = keyIndex++; key_i < keys.size(); key_i = keyIndex++) {
+                    results[key_i] = verify_resource_data_record(applyInfo, applyInfo.path / keys[key_i], &resourceDataHashes[key_i]);
+                }
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Report results, records with identical resource data hashes are reported as
+    //  duplicates since they could share storage
+    uint32_t failureCount = 0;
+    uint32_t unverifiableCount = 0;
+    std::unordered_map<uint64_t, uint32_t> resourceDataHashCounts;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        switch (results[i]) {
+        case VerifyResult::Verified: {
+            ++resourceDataHashCounts[resourceDataHashes[i]];
+        } break;
+        case VerifyResult::Unverifiable: {
+            ++unverifiableCount;
+        } break;
+        case VerifyResult::Failed: {
+            std::cerr << "FAILED " << keys[i] << std::endl;
+            ++failureCount;
+        } break;
+        default: {
+            assert(false && "VerifyResult is unserviced; gvk maintenance required");
+        } break;
+        }
+    }
+    uint32_t duplicateCount = 0;
+    for (const auto& itr : resourceDataHashCounts) {
+        duplicateCount += itr.second - 1;
+    }
+    auto verifiedCount = (uint32_t)keys.size() - failureCount - unverifiableCount;
+    std::cout << "Verified " << verifiedCount << " of " << keys.size() << " resource data records";
+    std::cout << " (" << unverifiableCount << " unverifiable, " << duplicateCount << " duplicates)" << std::endl;
+    return failureCount || !verifiedCount ? 1 : 0;
+}
@@ -41,6 +41,9 @@ typedef void(VKAPI_PTR* PFN_gvkInitializeThreadCallback)();
 typedef void(VKAPI_PTR* PFN_gvkProcessResourceDataCallback)(const GvkStateTrackedObject* pRestorePointObject, VkDeviceMemory stagingMemory, VkDeviceSize size, const uint8_t* pData);
 typedef void(VKAPI_PTR* PFN_gvkAllocateResoourceDataCallaback)(const GvkStateTrackedObject* pRestorePointObject, VkDeviceSize size, void** ppData);
 typedef void(VKAPI_PTR* PFN_gvkProcessRestoredObjectCallback)(const GvkStateTrackedObject* pCapturedObject, const GvkStateTrackedObject* pRestoredObject);
+typedef VkResult(VKAPI_PTR* PFN_gvkBeginRestorePointObjectCallback)(void* pUserData, const char* pKey);
+typedef VkResult(VKAPI_PTR* PFN_gvkWriteRestorePointChunkCallback)(void* pUserData, const char* pKey, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData);
+typedef VkResult(VKAPI_PTR* PFN_gvkEndRestorePointObjectCallback)(void* pUserData, const char* pKey);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 typedef void(VKAPI_PTR* PFN_gvkProcessWin32SurfaceCreateInfoCallback)(uint32_t width, uint32_t height, VkWin32SurfaceCreateInfoKHR* pWin32SurfaceCreateInfo);
 #endif
@@ -54,16 +57,43 @@ typedef enum GvkRestorePointCreateFlagBits {
     GVK_RESTORE_POINT_CREATE_BUFFER_DATA_BIT = 0x00000020,
     GVK_RESTORE_POINT_CREATE_IMAGE_DATA_BIT = 0x00000040,
     GVK_RESTORE_POINT_CREATE_IMAGE_PNG_BIT = 0x00000080,
+    GVK_RESTORE_POINT_CREATE_PACKED_ARCHIVE_BIT = 0x00000100,
+    GVK_RESTORE_POINT_CREATE_PARALLEL_OBJECT_PROCESSING_BIT = 0x00000200,
+    GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT = 0x00000400,
     GVK_RESTORE_POINT_CREATE_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
 } GvkRestorePointCreateFlagBits;
 typedef VkFlags GvkRestorePointCreateFlags;
 
 typedef enum GvkRestorePointApplyFlagBits {
     GVK_RESTORE_POINT_APPLY_SYNTHETIC_BIT = 0x00000001,
+    GVK_RESTORE_POINT_APPLY_VERIFY_BIT = 0x00000002,
     GVK_RESTORE_POINT_APPLY_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
 } GvkRestorePointApplyFlagBits;
 typedef VkFlags GvkRestorePointApplyFlags;
 
+typedef enum GvkRestorePointCompressionType {
+    GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE = 0,
+    GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4 = 1,
+    GVK_RESTORE_POINT_COMPRESSION_TYPE_MAX_ENUM = 0x7FFFFFFF
+} GvkRestorePointCompressionType;
+
+typedef enum GvkRestorePointSinkType {
+    GVK_RESTORE_POINT_SINK_TYPE_FILE = 0,
+    GVK_RESTORE_POINT_SINK_TYPE_SOCKET = 1,
+    GVK_RESTORE_POINT_SINK_TYPE_CUSTOM = 2,
+    GVK_RESTORE_POINT_SINK_TYPE_MAX_ENUM = 0x7FFFFFFF
+} GvkRestorePointSinkType;
+
+typedef struct GvkRestorePointSinkInfo {
+    GvkRestorePointSinkType type;
+    const char* pAddress;
+    VkDeviceSize queueBudget;
+    void* pUserData;
+    PFN_gvkBeginRestorePointObjectCallback pfnBeginObjectCallback;
+    PFN_gvkWriteRestorePointChunkCallback pfnWriteChunkCallback;
+    PFN_gvkEndRestorePointObjectCallback pfnEndObjectCallback;
+} GvkRestorePointSinkInfo;
+
 typedef struct GvkRestorePointCreateInfo {
     GvkRestorePointCreateFlags flags;
     const char* pPath;
@@ -72,6 +102,21 @@ typedef struct GvkRestorePointCreateInfo {
     PFN_gvkInitializeThreadCallback pfnInitializeThreadCallback;
     PFN_gvkAllocateResoourceDataCallaback pfnAllocateResourceDataCallback;
     PFN_gvkProcessResourceDataCallback pfnProcessResourceDataCallback;
+    // NOTE : Members added after pfnProcessResourceDataCallback are appended so
+    //  that applications built against earlier versions of this header remain
+    //  compatible, zero selects the default for each of them.
+    VkDeviceSize stagingMemoryBudget;
+    VkDeviceSize stagingChunkSize;
+    uint32_t inFlightTransferCount;
+    GvkRestorePointCompressionType compressionType;
+    int32_t compressionLevel;
+    VkDeviceSize compressionBlockSize;
+    // NOTE : Delta restore points only compare each page's 64 bit hash with the
+    //  base restore point's, a changed page whose hash collides with the base
+    //  page's hash isn't written and is restored with the base page's contents
+    GvkRestorePoint baseRestorePoint;
+    VkDeviceSize deltaPageSize;
+    const GvkRestorePointSinkInfo* pSinkInfo;
 } GvkRestorePointCreateInfo;
 
 typedef struct GvkRestorePointApplyInfo {
@@ -90,6 +135,12 @@ typedef struct GvkRestorePointApplyInfo {
     PFN_gvkProcessWin32SurfaceCreateInfoCallback pfnProcessWin32SurfaceCreateInfoCallback;
 #endif
     PFN_vkGetInstanceProcAddr pfnGetInstanceProcAddr;
+    // NOTE : Members added after pfnGetInstanceProcAddr are appended so that
+    //  applications built against earlier versions of this header remain
+    //  compatible, zero selects the default for each of them.
+    VkDeviceSize stagingMemoryBudget;
+    VkDeviceSize stagingChunkSize;
+    uint32_t inFlightTransferCount;
 } GvkRestorePointApplyInfo;
 
 typedef VkResult(VKAPI_PTR* PFN_gvkCreateRestorePoint)(VkInstance instance, const GvkRestorePointCreateInfo* pCreateInfo, GvkRestorePoint* pRestorePoint);
@@ -31,7 +31,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-point/copy-engine.hpp"
 #include "gvk-layer/log.hpp"
 
+#include <filesystem>
 #include <map>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 
@@ -68,6 +70,8 @@ protected:
         AccelerationStructureSerializationResources& operator=(const AccelerationStructureSerializationResources&) = delete;
     };
 
+    VkResult restore_objects();
+    static bool restore_concurrently(VkObjectType objectType);
     VkResult restore_object(const GvkStateTrackedObject& restorePointObject) override final;
     VkResult restore_object_state(const GvkStateTrackedObject& restorePointObject) override final;
     VkResult restore_object_name(const GvkStateTrackedObject& restoredObject, uint32_t dependencyCount, const GvkStateTrackedObject* pDependencies, const char* pName) override final;
@@ -136,6 +140,9 @@ protected:
     static void process_VkImage_data_upload(const CopyEngine::UploadImageInfo& uploadInfo, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData);
     VkResult process_VkImage_layouts(const GvkStateTrackedObject& restorePointObject);
 
+    // Resource data
+    VkResult read_resource_data(const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData) const;
+
     // VkPipelineBinary
     VkResult restore_VkPipelineBinaryKHR(const GvkStateTrackedObject& restorePointObject, const GvkPipelineBinaryRestoreInfoKHR& restoreInfo) override final;
     VkResult restore_VkPipelineBinaryKHR_state(const GvkStateTrackedObject& restorePointObject, const GvkPipelineBinaryRestoreInfoKHR& restoreInfo) override final;
@@ -160,6 +167,10 @@ private:
     std::map<VkDevice, VkCommandBuffer> mVkCommandBuffers;
     std::map<VkDevice, Fence> mFences;
     std::map<VkDevice, Auto<GvkDeviceRestoreInfo>> mDeviceRestoreInfos;
+    std::mutex mObjectRestorationMutex;
+    mutable std::mutex mResourceDataMutex;
+    mutable std::set<std::filesystem::path> mUnreadResourceData;
+    mutable std::set<std::filesystem::path> mUnverifiedResourceData;
     layer::Log mLog;
 };
 
@@ -0,0 +1,122 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gvk {
+namespace restore_point {
+
+/**
+Single file container for restore point records
+@note Records are appended as they're written and identified by key, the key for
+    a record is the path it would be written to relative to the restore point
+    directory (ie. "VkBuffer/0x0000000000001234.data")...an index of every
+    record is written to the end of the archive by finalize()
+@note Records may be written in chunks at arbitrary offsets (ie. resource data
+    streamed by CopyEngine), writing a record at offset 0 replaces any previously
+    written version of that record
+@note Archives opened for reading are memory mapped, get_data() returns pointers
+    directly into the mapping
+*/
+class Archive final
+{
+public:
+    static constexpr const char* FileName = "GvkRestorePoint.archive";
+
+    static VkResult create(const std::filesystem::path& path, Archive* pArchive);
+    static VkResult open(const std::filesystem::path& path, Archive* pArchive);
+    Archive() = default;
+    ~Archive();
+    void reset();
+    VkResult finalize();
+
+    VkResult write(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const void* pData);
+    bool contains(const std::string& key) const;
+    std::vector<std::string> get_keys() const;
+    uint64_t get_size(const std::string& key) const;
+    const uint8_t* get_data(const std::string& key) const;
+    VkResult read(const std::string& key, uint64_t dataOffset, uint64_t dataSize, uint8_t* pData) const;
+
+private:
+    class Entry final
+    {
+    public:
+        uint64_t dataOffset{ };
+        uint64_t offset{ };
+        uint64_t size{ };
+    };
+
+    mutable std::mutex mMutex;
+    std::filesystem::path mPath;
+    std::ofstream mFile;
+    mutable std::ifstream mReadFile;
+    uint64_t mFileSize{ };
+    std::unordered_map<std::string, std::vector<Entry>> mEntries;
+    const uint8_t* mpMappedData{ };
+    uint64_t mMappedSize{ };
+
+    Archive(const Archive&) = delete;
+    Archive& operator=(const Archive&) = delete;
+};
+
+/**
+std::istream over a contiguous range of memory (ie. an Archive record)
+*/
+class MemoryStream final
+    : public std::istream
+{
+public:
+    MemoryStream(const uint8_t* pData, size_t size);
+
+private:
+    class Buffer final
+        : public std::streambuf
+    {
+    public:
+        Buffer(const uint8_t* pData, size_t size);
+
+    protected:
+        pos_type seekoff(off_type offset, std::ios_base::seekdir seekDirection, std::ios_base::openmode openMode) override final;
+        pos_type seekpos(pos_type position, std::ios_base::openmode openMode) override final;
+    };
+
+    Buffer mBuffer;
+};
+
+} // namespace restore_point
+} // namespace gvk
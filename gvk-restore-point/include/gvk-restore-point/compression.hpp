@@ -0,0 +1,168 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "VK_LAYER_INTEL_gvk_restore_point.h"
+
+#include "asio.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace gvk {
+namespace restore_point {
+
+/**
+Header written before each block of compressed resource data
+@note Compressed resource data is a sequence of independently compressed blocks,
+    each block is preceded by a CompressedBlockHeader that identifies the range
+    of uncompressed data it contains...blocks can be located by walking headers
+    and decompressed in any order
+*/
+class CompressedBlockHeader final
+{
+public:
+    static constexpr uint64_t Magic = 0x4b4c4250524b5647; // "GVKRPBLK"
+    static constexpr VkDeviceSize DefaultBlockSize = 1024 * 1024;
+
+    uint64_t magic{ Magic };
+    uint32_t compressionType{ };
+    uint32_t compressedSize{ };
+    uint64_t dataOffset{ };
+    uint64_t dataSize{ };
+};
+
+static_assert(sizeof(CompressedBlockHeader) == 32, "CompressedBlockHeader must be tightly packed; gvk maintenance required");
+
+/**
+Callback used to read a range of a record containing resource data
+*/
+using ReadResourceDataFunction = std::function<VkResult(uint64_t offset, uint64_t size, uint8_t* pData)>;
+
+/**
+Compresses a range of resource data into CompressedBlockHeader prefixed blocks
+@param [in] compressionType The GvkRestorePointCompressionType to compress with
+@param [in] compressionLevel The compression level, higher levels search more candidate matches (0 uses the default)
+@param [in] blockSize The maximum uncompressed size of each block (0 uses CompressedBlockHeader::DefaultBlockSize)
+@param [in] dataOffset The offset of the data being compressed in the uncompressed resource data
+@param [in] dataSize The size of the data being compressed
+@param [in] pData A pointer to the data being compressed
+@param [out] compressedData The std::vector<uint8_t> to append compressed blocks to
+@return The VkResult
+    @note Blocks that don't compress are stored uncompressed
+*/
+VkResult compress_resource_data(
+    GvkRestorePointCompressionType compressionType,
+    int32_t compressionLevel,
+    VkDeviceSize blockSize,
+    VkDeviceSize dataOffset,
+    VkDeviceSize dataSize,
+    const uint8_t* pData,
+    std::vector<uint8_t>& compressedData
+);
+
+/**
+Index of the CompressedBlockHeader prefixed blocks in a record
+@note The index is built once when a record is opened by walking the record's
+    block headers, reads look up the blocks that overlap the requested range
+    without walking the record again
+*/
+class CompressedBlockIndex final
+{
+public:
+    /**
+    Creates a CompressedBlockIndex for a record containing compressed resource data
+    @param [in] read The ReadResourceDataFunction used to read the record
+    @param [in] recordSize The size of the record
+    @param [out] pCompressedBlockIndex The CompressedBlockIndex to populate
+    @return The VkResult
+    */
+    static VkResult create(const ReadResourceDataFunction& read, uint64_t recordSize, CompressedBlockIndex* pCompressedBlockIndex);
+
+    /**
+    Decompresses a range of resource data from the record this CompressedBlockIndex was created for
+    @param [in] read The ReadResourceDataFunction used to read the record
+    @param [in] dataOffset The offset in the uncompressed resource data to decompress from
+    @param [in] dataSize The size of the range to decompress
+    @param [out] pData A pointer to write decompressed data to
+    @param [in] pThreadPool An optional asio::thread_pool to decompress blocks on
+    @return The VkResult
+        @note The compressed data for all blocks overlapping the requested range is
+            read with a single call to read
+        @note Blocks entirely contained in the requested range are decompressed
+            directly into pData (ie. CopyEngine staging memory)
+        @note If pThreadPool is provided blocks are decompressed concurrently, the
+            calling thread decompresses blocks along with the asio::thread_pool so
+            it's safe to call from a task running on pThreadPool
+    */
+    VkResult decompress(const ReadResourceDataFunction& read, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData, asio::thread_pool* pThreadPool = nullptr) const;
+
+private:
+    class Block final
+    {
+    public:
+        CompressedBlockHeader header{ };
+        uint64_t recordOffset{ };
+    };
+
+    std::vector<Block> mBlocks;
+};
+
+} // namespace restore_point
+
+namespace detail {
+
+/**
+Compresses data in the LZ4 block format
+@param [in] pSrc A pointer to the data to compress
+@param [in] srcSize The size of the data to compress
+@param [in] level The compression level, higher levels search more candidate matches
+@param [out] pDst A pointer to write compressed data to, must be at least get_lz4_compress_bound(srcSize) bytes
+@return The size of the compressed data
+*/
+size_t lz4_compress(const uint8_t* pSrc, size_t srcSize, int32_t level, uint8_t* pDst);
+
+/**
+Decompresses data in the LZ4 block format
+@param [in] pSrc A pointer to the data to decompress
+@param [in] srcSize The size of the data to decompress
+@param [out] pDst A pointer to write decompressed data to
+@param [in] dstSize The size of the decompressed data
+@return Whether or not the data was decompressed successfully
+*/
+bool lz4_decompress(const uint8_t* pSrc, size_t srcSize, uint8_t* pDst, size_t dstSize);
+
+/**
+Gets the maximum size of data compressed with lz4_compress()
+@param [in] srcSize The size of the data to compress
+@return The maximum size of the compressed data
+*/
+size_t get_lz4_compress_bound(size_t srcSize);
+
+} // namespace detail
+} // namespace gvk
@@ -35,6 +35,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "asio.hpp"
 
+#include <condition_variable>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -59,6 +60,20 @@ public:
     {
         uint32_t threadCount{ };
         void(*pfnInitializeThreadCallback)(){ };
+
+        // The total number of bytes of host visible staging memory that may be
+        //  in use at once, 0 to size staging memory to the largest task.
+        VkDeviceSize stagingMemoryBudget{ };
+
+        // The number of bytes transferred per chunk, 0 to divide the staging budget
+        //  evenly between threads.
+        VkDeviceSize stagingChunkSize{ };
+
+        // The number of chunks each thread may have in flight at once, while one
+        //  chunk's data is being processed the next chunk's copy is executing.  0 or
+        //  1 to wait for each chunk before submitting the next.  Values greater than
+        //  1 enable chunking even if no staging budget or chunk size is provided.
+        uint32_t inFlightTransferCount{ };
     };
 
     struct DownloadDeviceMemoryInfo
@@ -68,6 +83,13 @@ public:
         VkMemoryAllocateInfo memoryAllocateInfo{ };
         uint32_t regionCount{ };
         const VkBufferCopy* pRegions{ };
+
+        // The current mapping of memory (if any), host visible memory is read
+        //  directly instead of being copied through staging memory.
+        GvkMappedMemoryInfo mappedMemoryInfo{ };
+
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnAllocateResourceDataCallaback)(const GvkStateTrackedObject*, VkDeviceSize, void**){ };
         void(*pfnCallback)(const DownloadDeviceMemoryInfo&, const VkBindBufferMemoryInfo&, const uint8_t*){ };
@@ -80,6 +102,8 @@ public:
         VkBufferCreateInfo bufferCreateInfo{ };
         VkDeviceSize offset{ };
         VkDeviceSize size{ };
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnCallback)(const DownloadBufferInfo&, const VkBindBufferMemoryInfo&, const uint8_t*){ };
     };
@@ -91,6 +115,8 @@ public:
         VkImageCreateInfo imageCreateInfo{ };
         VkImageSubresourceRange imageSubresourceRange{ };
         const VkImageLayout* pImageLayouts{ };
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnCallback)(const DownloadImageInfo&, const VkBindBufferMemoryInfo&, const uint8_t*){ };
     };
@@ -103,6 +129,11 @@ public:
         VkBuffer buffer{ };
         VkBufferCreateInfo bufferCreateInfo{ };
         VkDeviceAddress bufferDeviceAddress{ };
+
+        // The offset into buffer to serialize to, must be a multiple of 256.  When
+        //  downloading a batch each acceleration structure is given its own range.
+        VkDeviceSize bufferOffset{ };
+
         VkDeviceMemory memory{ };
         VkMemoryAllocateInfo memoryAllocateInfo{ };
         VkDevice device{ };
@@ -118,6 +149,13 @@ public:
         VkMemoryAllocateInfo memoryAllocateInfo{ };
         uint32_t regionCount{ };
         const VkBufferCopy* pRegions{ };
+
+        // The current mapping of memory (if any), host visible memory is written
+        //  directly instead of being copied through staging memory.
+        GvkMappedMemoryInfo mappedMemoryInfo{ };
+
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnCallback)(const UploadDeviceMemoryInfo&, const VkBindBufferMemoryInfo&, uint8_t*){ };
     };
@@ -130,6 +168,8 @@ public:
         VkBufferCreateInfo bufferCreateInfo{ };
         VkDeviceSize offset{ };
         VkDeviceSize size{ };
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnCallback)(const UploadBufferInfo&, const VkBindBufferMemoryInfo&, uint8_t*){ };
     };
@@ -143,6 +183,8 @@ public:
         VkImageSubresourceRange imageSubresourceRange{ };
         const VkImageLayout* pOldImageLayouts{ };
         const VkImageLayout* pNewImageLayouts{ };
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
         void* pUserData{ };
         void(*pfnCallback)(const UploadImageInfo&, const VkBindBufferMemoryInfo&, uint8_t*){ };
     };
@@ -196,6 +238,7 @@ public:
     void download(DownloadBufferInfo downloadInfo);
     void download(DownloadImageInfo downloadInfo);
     void download(DownloadAccelerationStructureInfo downloadInfo);
+    void download(uint32_t downloadInfoCount, const DownloadAccelerationStructureInfo* pDownloadInfos);
     void upload(UploadDeviceMemoryInfo uploadInfo);
     void upload(UploadBufferInfo uploadInfo);
     void upload(UploadImageInfo uploadInfo);
@@ -204,6 +247,7 @@ public:
     void transition_image_layouts(TransitionImageLayoutInfo transitionInfo);
     void build_acceleration_structure(BuildAcclerationStructureInfo buildInfo);
     VkResult get_acceleration_structure_serialization_size(VkAccelerationStructureKHR accelerationStructure, VkDeviceSize* pSize);
+    VkResult get_acceleration_structure_serialization_sizes(uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkDeviceSize* pSizes);
 
 private:
     class TaskResources final
@@ -216,6 +260,49 @@ private:
         VkCommandBuffer vkCommandBuffer{ };
     };
 
+    class StagingSlot final
+    {
+    public:
+        Buffer buffer;
+        DeviceMemory memory;
+    };
+
+    class StagingResources final
+    {
+    public:
+        StagingResources() = default;
+        StagingResources(StagingResources&& other);
+        StagingResources& operator=(StagingResources&& other);
+        ~StagingResources();
+        Buffer buffer;
+        DeviceMemory memory;
+
+    private:
+        CopyEngine* mpCopyEngine{ };
+        uint32_t mSlot{ };
+        friend class CopyEngine;
+        StagingResources(const StagingResources&) = delete;
+        StagingResources& operator=(const StagingResources&) = delete;
+    };
+
+    template <typename CopyType>
+    class StagingChunk final
+    {
+    public:
+        VkDeviceSize dataOffset{ };
+        VkDeviceSize dataSize{ };
+        std::vector<CopyType> copies;
+    };
+
+    class HostMapping final
+    {
+    public:
+        uint8_t* pData{ };
+        VkDeviceSize offset{ };
+        bool unmap{ };
+        bool coherent{ };
+    };
+
     class AccelerationStructureTaskResources final
     {
     public:
@@ -228,19 +315,45 @@ private:
     };
 
     void initialize_thread();
+    VkResult queue_submit(const VkSubmitInfo& submitInfo, VkFence fence);
     VkResult get_task_resources(VkDeviceSize taskSize, TaskResources* pTaskResources);
+    VkResult get_task_resources(VkDeviceSize taskSize, uint32_t inFlightIndex, TaskResources* pTaskResources);
+    VkResult create_staging_resources(VkDeviceSize size, Buffer* pBuffer, DeviceMemory* pMemory);
+    VkResult acquire_staging_resources(const TaskResources& taskResources, VkDeviceSize size, bool wait, StagingResources* pStagingResources);
+    void release_staging_resources(StagingResources* pStagingResources);
+    template <typename CopyType, typename RecordChunkFunctionType, typename ProcessChunkFunctionType>
+    VkResult stream_staging_chunks(VkDeviceSize taskSize, bool download, const std::vector<StagingChunk<CopyType>>& chunks, RecordChunkFunctionType recordChunk, ProcessChunkFunctionType processChunk);
+    VkResult map_host_visible_memory(VkDeviceMemory memory, const VkMemoryAllocateInfo& memoryAllocateInfo, const GvkMappedMemoryInfo& mappedMemoryInfo, bool download, const std::vector<VkBufferCopy>& regions, HostMapping* pHostMapping);
+    void unmap_host_visible_memory(VkDeviceMemory memory, bool download, const HostMapping& hostMapping);
+    std::vector<StagingChunk<VkBufferCopy>> get_staging_chunks(const std::vector<VkBufferCopy>& regions) const;
+    std::vector<StagingChunk<VkBufferImageCopy>> get_staging_chunks(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, const std::vector<VkImageLayout>& imageLayouts) const;
+    bool get_host_image_copy_enabled(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, const std::vector<VkImageLayout>& srcImageLayouts, const std::vector<VkImageLayout>& dstImageLayouts) const;
+    VkResult get_acceleration_structure_memory_property_flags(VkAccelerationStructureKHR accelerationStructure, VkMemoryPropertyFlags* pMemoryPropertyFlags) const;
     VkResult get_acceleration_structure_task_resources(VkDeviceSize taskSize, AccelerationStructureTaskResources* pTaskResources);
     VkResult get_acceleration_structure_task_resources(const GvkAccelerationStructureSerilizationInfoKHR& accelerationStructureSerializationInfo, AccelerationStructureTaskResources* pTaskResources);
 
     Device mDevice;
-    std::mutex mQueueMutex;
+    VkPhysicalDeviceMemoryProperties mPhysicalDeviceMemoryProperties{ };
+    bool mHostImageCopyEnabled{ };
+    std::vector<VkImageLayout> mHostImageCopySrcLayouts;
+    std::vector<VkImageLayout> mHostImageCopyDstLayouts;
     Queue mQueue;
+    std::vector<Queue> mQueues;
+    std::vector<std::mutex> mQueueMutexes;
+    std::unordered_map<std::thread::id, uint32_t> mThreadQueueIndices;
     void(*mpfnInitializeThreadCallback)() { };
     std::unique_ptr<asio::thread_pool> mupThreadPool;
     std::mutex mTaskResourcesMutex;
-    std::unordered_map<std::thread::id, TaskResources> mTaskResources;
+    std::unordered_map<std::thread::id, std::vector<TaskResources>> mTaskResources;
     std::unordered_map<std::thread::id, AccelerationStructureTaskResources> mAccelerationStructureTaskResources;
     bool mAccelerationStrcutureSerializationInfoRetrieved{ };
+    std::mutex mAccelerationStructureSerializationMutex;
+    VkDeviceSize mStagingChunkSize{ };
+    uint32_t mInFlightTransferCount{ };
+    std::mutex mStagingMutex;
+    std::condition_variable mStagingCondition;
+    std::vector<StagingSlot> mStagingSlots;
+    std::vector<uint32_t> mAvailableStagingSlots;
 
     CopyEngine(const CopyEngine&) = delete;
     CopyEngine& operator=(const CopyEngine&) = delete;
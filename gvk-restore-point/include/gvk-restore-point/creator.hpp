@@ -44,6 +44,8 @@ public:
     VkResult create_restore_point(const CreateInfo& createInfo) override final;
 
 protected:
+    VkResult process_deferred_objects();
+    static bool process_concurrently(VkObjectType objectType);
     VkResult process_VkInstance(GvkInstanceRestoreInfo& objectRestoreInfo) override final;
     VkResult process_VkPhysicalDevice(GvkPhysicalDeviceRestoreInfo& objectRestoreInfo) override final;
     VkResult process_VkDevice(GvkDeviceRestoreInfo& objectRestoreInfo) override final;
@@ -0,0 +1,147 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gvk {
+namespace restore_point {
+
+/**
+Hash of a page of resource data
+*/
+class PageHash final
+{
+public:
+    VkDeviceSize offset{ };
+    VkDeviceSize size{ };
+    uint64_t hash{ };
+};
+
+static_assert(sizeof(PageHash) == 24, "PageHash must be tightly packed; gvk maintenance required");
+
+/**
+Range of resource data stored in a delta restore point
+@note Delta restore points write a ".delta" record alongside each ".data" record
+    listing the ranges stored in the ".data" record, everything else is resolved
+    from the base restore point
+*/
+class ResourceDataRange final
+{
+public:
+    VkDeviceSize offset{ };
+    VkDeviceSize size{ };
+};
+
+static_assert(sizeof(ResourceDataRange) == 16, "ResourceDataRange must be tightly packed; gvk maintenance required");
+
+/**
+Page hashes for each resource data record written to a restore point
+@note Page hashes are computed on CopyEngine threads as resource data is written,
+    restore points created with a base restore point compare their page hashes
+    against the base's and only write the pages that changed
+@note When a record is complete its page hashes are written to a ".hash" record
+    followed by the record's resource data hash (see get_resource_data_hash()),
+    ".hash" records are used to verify resource data when it's read back
+@note Pages are compared by their 64 bit hash alone, the page data itself isn't
+    compared.  If a changed page happens to hash to the same value as the base's
+    page it won't be written, and the delta restore point will restore the base's
+    contents for that page.  The probability is roughly 2^-64 per changed page,
+    but callers that can't tolerate any chance of a stale page shouldn't create
+    delta restore points (ie. leave GvkRestorePointCreateInfo::baseRestorePoint
+    VK_NULL_HANDLE)
+*/
+class PageHashes final
+{
+public:
+    static constexpr VkDeviceSize DefaultPageSize = 64 * 1024;
+    static constexpr const char* BaseRestorePointFileName = "GvkRestorePointBase.path";
+
+    /**
+    Adds page hashes for a chunk of a record's resource data
+    @param [in] key The key of the record the page hashes belong to
+    @param [in] dataOffset The offset of the chunk, page hashes for chunks at offset 0 replace existing page hashes
+    @param [in] pageHashes The page hashes for the chunk
+    */
+    void insert(const std::string& key, VkDeviceSize dataOffset, const std::vector<PageHash>& pageHashes);
+
+    /**
+    Gets the ranges of a chunk of resource data that differ from these page hashes
+    @param [in] key The key of the record to compare against
+    @param [in] pageHashes The page hashes for the chunk being compared
+    @param [out] changedRanges The std::vector<ResourceDataRange> to populate with ranges that changed
+        @note Adjacent changed pages are merged into a single range
+    */
+    void get_changed_ranges(const std::string& key, const std::vector<PageHash>& pageHashes, std::vector<ResourceDataRange>& changedRanges) const;
+
+    /**
+    Gets the page hashes for a record's resource data
+    @param [in] key The key of the record to get page hashes for
+    @param [out] pageHashes The std::vector<PageHash> to populate
+    */
+    void get(const std::string& key, std::vector<PageHash>& pageHashes) const;
+
+private:
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, std::vector<PageHash>> mPageHashes;
+};
+
+/**
+Computes a hash of resource data
+@param [in] pData A pointer to the data to hash
+@param [in] size The size of the data to hash
+@return The hash
+*/
+uint64_t hash_resource_data(const uint8_t* pData, size_t size);
+
+/**
+Computes page hashes for a chunk of resource data
+@param [in] pageSize The size of each page, pages are aligned to pageSize in the resource data
+@param [in] dataOffset The offset of the chunk in the resource data
+@param [in] dataSize The size of the chunk
+@param [in] pData A pointer to the chunk
+@param [out] pageHashes The std::vector<PageHash> to populate
+    @note Pages that straddle chunk boundaries are hashed as partial pages
+*/
+void hash_resource_data_pages(VkDeviceSize pageSize, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData, std::vector<PageHash>& pageHashes);
+
+/**
+Computes a hash of a record's resource data from its page hashes
+@param [in] pageHashes The page hashes for the record, sorted by offset
+@return The hash
+    @note Records with identical resource data that were hashed with the same page
+        size have identical hashes
+*/
+uint64_t get_resource_data_hash(const std::vector<PageHash>& pageHashes);
+
+} // namespace restore_point
+} // namespace gvk
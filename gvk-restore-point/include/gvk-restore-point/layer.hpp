@@ -50,6 +50,7 @@ public:
     // NOTE : Defined in gvk/gvk-restore-point/source/gvk-restore-point/handles/device.cpp
     VkResult pre_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, VkResult gvkResult) override final;
     VkResult post_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, VkResult gvkResult) override final;
+    void post_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override final;
 
     ///////////////////////////////////////////////////////////////////////////////
     // NOTE : Defined in gvk/gvk-restore-point/source/gvk-restore-point/handles/device-memory.cpp
@@ -145,6 +146,8 @@ private:
     std::unordered_map<uint64_t, size_t> mDeviceAddressCreationCallIndices;
     std::mutex mLiveObjectMutex;
     std::set<GvkStateTrackedObject> mLiveObjects;
+    std::mutex mHostImageCopyMutex;
+    std::unordered_map<VkDevice, VkPhysicalDevice> mHostImageCopyPhysicalDevices;
 };
 
 } // namespace state_tracker
@@ -33,6 +33,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 
 namespace gvk {
 namespace restore_point {
@@ -46,6 +47,10 @@ public:
     bool register_object_restoration(const CapturedObject& capturedObject, const RestoredObject& restoredObject);
     void register_object_destruction(const RestoredObject& restoredObject);
     bool set_object_mapping(const CapturedObject& capturedObject, const RestoredObject& restoredObject);
+    // NOTE : Objects may be restored concurrently, so the maps returned by
+    //  get_restored_objects() and get_captured_objects() must only be accessed
+    //  while holding the lock returned by get_shared_lock().
+    std::shared_lock<std::shared_mutex> get_shared_lock() const;
     const std::map<CapturedObject, RestoredObject>& get_restored_objects() const;
     const std::map<RestoredObject, RestoredObject>& get_captured_objects() const;
     RestoredObject get_restored_object(const CapturedObject& capturedObject) const;
@@ -54,7 +59,7 @@ public:
     void clear();
 
 private:
-    mutable std::mutex mMutex;
+    mutable std::shared_mutex mMutex;
     std::map<CapturedObject, RestoredObject> mRestoredObjects;
     std::map<RestoredObject, CapturedObject> mCapturedObjects;
 };
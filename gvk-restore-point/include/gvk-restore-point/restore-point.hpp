@@ -31,17 +31,55 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-info.hpp"
 #include "gvk-command-structures.hpp"
 
+#include "gvk-restore-point/delta.hpp"
 #include "gvk-restore-point/object-map.hpp"
 
 #define VK_LAYER_INTEL_gvk_restore_point_hpp_OMIT_ENTRY_POINT_DECLARATIONS
 #include "VK_LAYER_INTEL_gvk_restore_point.hpp"
 
+#include <filesystem>
 #include <map>
 #include <set>
 
+namespace gvk {
+namespace restore_point {
+
+/**
+Record written to every restore point describing how its records were written
+@note The Applier reads the RestorePointHeader before any other record and uses
+    it to determine how to read resource data (ie. whether ".data" records are
+    made up of CompressedBlockHeader prefixed blocks) rather than inspecting the
+    records themselves
+@note Version 2 records createFlags so that a GvkDeviceMemoryRestoreInfo with a
+    dataRegionCount of 0 can be distinguished...with
+    GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT it means no data was
+    written, otherwise it means the data contains the entire allocation
+*/
+class RestorePointHeader final
+{
+public:
+    static constexpr const char* FileName = "GvkRestorePoint.header";
+    static constexpr uint64_t Magic = 0x52444850524b5647; // "GVKRPHDR"
+    static constexpr uint32_t Version = 2;
+
+    uint64_t magic{ Magic };
+    uint32_t version{ Version };
+    GvkRestorePointCreateFlags createFlags{ };
+    GvkRestorePointCompressionType compressionType{ GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE };
+    uint32_t reserved{ };
+    VkDeviceSize pageSize{ };
+};
+
+static_assert(sizeof(RestorePointHeader) == 32, "RestorePointHeader must be tightly packed; gvk maintenance required");
+
+} // namespace restore_point
+} // namespace gvk
+
 struct GvkRestorePoint_T
 {
     GvkRestorePointCreateFlags createFlags{ };
+    std::filesystem::path path;
+    gvk::restore_point::PageHashes pageHashes;
     gvk::Auto<GvkRestorePointManifest> manifest;
     gvk::restore_point::ObjectMap objectMap;
 
@@ -0,0 +1,242 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-restore-point/archive.hpp"
+#include "VK_LAYER_INTEL_gvk_restore_point.h"
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace gvk {
+namespace restore_point {
+
+/**
+Destination for restore point records
+@note Records are identified by key, the key for a record is the path it would
+    be written to relative to the restore point directory (ie.
+    "VkBuffer/0x0000000000001234.data")
+@note Each record is started with begin_object(), written with one or more calls
+    to write_chunk(), and completed with end_object()...writing a chunk at offset
+    0 replaces any previously written version of the record
+@note SinkWriters are only called from a Sink's writer thread
+*/
+class SinkWriter
+{
+public:
+    virtual ~SinkWriter() = 0;
+    virtual VkResult begin_object(const std::string& key) = 0;
+    virtual VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) = 0;
+    virtual VkResult end_object(const std::string& key) = 0;
+    virtual VkResult finalize() = 0;
+};
+
+/**
+SinkWriter that writes each record to a loose file in a restore point directory
+@note Each record's file is kept open from begin_object() to end_object()
+*/
+class DirectorySinkWriter final
+    : public SinkWriter
+{
+public:
+    DirectorySinkWriter(const std::filesystem::path& path);
+    VkResult begin_object(const std::string& key) override final;
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) override final;
+    VkResult end_object(const std::string& key) override final;
+    VkResult finalize() override final;
+
+private:
+    std::filesystem::path mPath;
+    std::unordered_map<std::string, std::ofstream> mDataFiles;
+};
+
+/**
+SinkWriter that appends each record to a packed Archive
+*/
+class ArchiveSinkWriter final
+    : public SinkWriter
+{
+public:
+    static VkResult create(const std::filesystem::path& path, std::unique_ptr<SinkWriter>* pupSinkWriter);
+    VkResult begin_object(const std::string& key) override final;
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) override final;
+    VkResult end_object(const std::string& key) override final;
+    VkResult finalize() override final;
+
+private:
+    Archive mArchive;
+};
+
+/**
+SinkWriter that streams records to a collector process through a local socket
+@note On Windows the address is the name of a named pipe (ie.
+    "\\\\.\\pipe\\gvk-restore-point"), everywhere else it's the path of a Unix
+    domain socket...the collector must be listening before the restore point is
+    created
+@note The stream starts with uint64_t magic, uint64_t version and is followed by
+    a message for each call...
+        uint32_t type, uint32_t keySize, uint64_t dataOffset, uint64_t dataSize
+        char[keySize] key, uint8_t[dataSize] data
+    ...the stream ends with a Finalize message
+*/
+class SocketSinkWriter final
+    : public SinkWriter
+{
+public:
+    static constexpr uint64_t Magic = 0x4b4e4953524b5647; // "GVKRSINK"
+    static constexpr uint64_t Version = 1;
+
+    enum MessageType : uint32_t
+    {
+        BeginObject = 1,
+        WriteChunk = 2,
+        EndObject = 3,
+        Finalize = 4,
+    };
+
+    static VkResult create(const std::string& address, std::unique_ptr<SinkWriter>* pupSinkWriter);
+    ~SocketSinkWriter();
+    VkResult begin_object(const std::string& key) override final;
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) override final;
+    VkResult end_object(const std::string& key) override final;
+    VkResult finalize() override final;
+
+private:
+    SocketSinkWriter() = default;
+    VkResult send_message(MessageType type, const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData);
+    VkResult send(const void* pData, uint64_t size);
+    void close();
+#if defined(_WIN32) || defined(_WIN64)
+    void* mPipe{ };
+#else
+    int mSocket{ -1 };
+#endif
+};
+
+/**
+SinkWriter that forwards records to application provided callbacks
+*/
+class CallbackSinkWriter final
+    : public SinkWriter
+{
+public:
+    CallbackSinkWriter(const GvkRestorePointSinkInfo& sinkInfo);
+    VkResult begin_object(const std::string& key) override final;
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) override final;
+    VkResult end_object(const std::string& key) override final;
+    VkResult finalize() override final;
+
+private:
+    GvkRestorePointSinkInfo mSinkInfo{ };
+};
+
+/**
+Queues restore point records for a SinkWriter running on a dedicated thread
+@note Calls copy their data into a queue and return immediately, calls block while
+    the queue holds more than its budget of data so that a slow SinkWriter applies
+    backpressure instead of growing without bound
+@note Record sizes are tracked as records are queued so they're available before
+    the SinkWriter has written them...records queued with retain set are also
+    kept in memory so they can be read back while the restore point is being
+    created
+@note Errors returned by the SinkWriter are reported by subsequent calls and by
+    finalize(), records queued after an error are discarded
+@note Records written on a thread between begin_batch() and end_batch() are
+    collected in a Batch rather than queued, the Batch is queued with
+    push_batch()...this allows records written concurrently to be queued in a
+    deterministic order
+*/
+class Sink final
+{
+public:
+    static constexpr VkDeviceSize DefaultQueueBudget = 256 * 1024 * 1024;
+
+    class Message final
+    {
+    public:
+        SocketSinkWriter::MessageType type{ };
+        std::string key;
+        uint64_t dataOffset{ };
+        std::vector<uint8_t> data;
+    };
+
+    class Batch final
+    {
+    public:
+        std::vector<Message> messages;
+    };
+
+    static VkResult create(std::unique_ptr<SinkWriter> upSinkWriter, VkDeviceSize queueBudget, std::shared_ptr<Sink>* pspSink);
+    ~Sink();
+    VkResult begin_object(const std::string& key);
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData, bool retain = false);
+    VkResult end_object(const std::string& key);
+    VkResult write_object(const std::string& key, uint64_t dataSize, const uint8_t* pData, bool retain = false);
+    VkResult finalize();
+
+    void begin_batch(Batch* pBatch);
+    void end_batch();
+    VkResult push_batch(Batch&& batch);
+
+    uint64_t get_size(const std::string& key) const;
+    VkResult read_retained(const std::string& key, std::vector<uint8_t>& data) const;
+
+private:
+    Sink() = default;
+    VkResult push(std::unique_lock<std::mutex>& lock, Message&& message);
+    void process_messages();
+
+    std::unique_ptr<SinkWriter> mupSinkWriter;
+    VkDeviceSize mQueueBudget{ };
+    mutable std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<Message> mMessages;
+    VkDeviceSize mQueuedSize{ };
+    bool mFinalizing{ };
+    VkResult mResult{ VK_SUCCESS };
+    std::unordered_set<std::string> mOpenObjects;
+    std::unordered_map<std::string, uint64_t> mSizes;
+    std::unordered_map<std::string, std::vector<uint8_t>> mRetainedObjects;
+    std::thread mThread;
+
+    Sink(const Sink&) = delete;
+    Sink& operator=(const Sink&) = delete;
+};
+
+} // namespace restore_point
+} // namespace gvk
@@ -31,17 +31,29 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-info.hpp"
 #include "gvk-command-structures.hpp"
 
+#include "gvk-restore-point/archive.hpp"
+#include "gvk-restore-point/compression.hpp"
+#include "gvk-restore-point/delta.hpp"
 #include "gvk-restore-point/restore-point.hpp"
+#include "gvk-restore-point/sink.hpp"
 
 #include "gvk-dispatch-table.hpp"
 #include "gvk-restore-info.hpp"
 #include "gvk-runtime.hpp"
 #include "VK_LAYER_INTEL_gvk_restore_point.h"
 
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace gvk {
@@ -60,13 +72,108 @@ public:
     VkInstance instance{ };
     GvkRestorePoint gvkRestorePoint{ };
     std::filesystem::path path;
+    GvkRestorePointSinkType sinkType{ GVK_RESTORE_POINT_SINK_TYPE_FILE };
+    std::string sinkAddress;
+    VkDeviceSize sinkQueueBudget{ };
+    GvkRestorePointSinkInfo sinkCallbacks{ };
+    std::shared_ptr<Sink> sink;
     uint32_t threadCount{ };
+    VkDeviceSize stagingMemoryBudget{ };
+    VkDeviceSize stagingChunkSize{ };
+    uint32_t inFlightTransferCount{ };
+    GvkRestorePointCompressionType compressionType{ GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE };
+    int32_t compressionLevel{ };
+    VkDeviceSize compressionBlockSize{ };
+    GvkRestorePoint baseRestorePoint{ };
+    VkDeviceSize deltaPageSize{ };
     PFN_gvkInitializeThreadCallback pfnInitializeThreadCallback{ };
     PFN_gvkAllocateResoourceDataCallaback pfnAllocateResourceDataCallback{ };
     PFN_gvkProcessResourceDataCallback pfnProcessResourceDataCallback{ };
     std::vector<const GvkCommandBaseStructure*> deviceAddressApiCallCache;
 };
 
+/**
+Loose ".data" file read by a ResourceDataRecord
+@note The file is opened once and stays open as long as the ResourceDataRecord
+    that reads from it, reads from multiple threads are serialized
+*/
+class ResourceDataFile final
+{
+public:
+    ResourceDataFile(const std::filesystem::path& path)
+        : mFile(path, std::ios::binary | std::ios::ate)
+    {
+    }
+
+    bool is_open() const
+    {
+        return mFile.is_open();
+    }
+
+    uint64_t get_size()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return (uint64_t)mFile.tellg();
+    }
+
+    VkResult read(uint64_t offset, uint64_t size, uint8_t* pData)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFile.clear();
+        mFile.seekg(offset);
+        mFile.read((char*)pData, size);
+        return mFile.good() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+private:
+    std::mutex mMutex;
+    std::ifstream mFile;
+};
+
+/**
+State read from a ".data" record the first time it's read
+@note CopyEngine reads resource data in chunks, a ResourceDataRecord holds
+    everything about a record that doesn't depend on the chunk being read so it
+    only needs to be read from the restore point once
+*/
+class ResourceDataRecord final
+{
+public:
+    ReadResourceDataFunction read;
+    uint64_t size{ };
+    bool compressed{ };
+    CompressedBlockIndex compressedBlockIndex;
+    bool delta{ };
+    std::vector<ResourceDataRange> deltaRanges;
+    std::shared_ptr<const ResourceDataRecord> base;
+};
+
+/**
+ResourceDataRecord objects for a restore point, keyed by record key
+*/
+class ResourceDataRecordCache final
+{
+public:
+    std::shared_ptr<const ResourceDataRecord> get(const std::string& key) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto itr = mResourceDataRecords.find(key);
+        return itr != mResourceDataRecords.end() ? itr->second : nullptr;
+    }
+
+    std::shared_ptr<const ResourceDataRecord> insert(const std::string& key, const std::shared_ptr<const ResourceDataRecord>& spResourceDataRecord)
+    {
+        // NOTE : If another thread inserted a ResourceDataRecord for this key first
+        //  the existing ResourceDataRecord is returned
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mResourceDataRecords.insert({ key, spResourceDataRecord }).first->second;
+    }
+
+private:
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, std::shared_ptr<const ResourceDataRecord>> mResourceDataRecords;
+};
+
 class ApplyInfo final
 {
 public:
@@ -79,7 +186,15 @@ public:
     VkInstance vkInstance{ };
     GvkRestorePoint gvkRestorePoint{ };
     uint32_t threadCount{ };
+    VkDeviceSize stagingMemoryBudget{ };
+    VkDeviceSize stagingChunkSize{ };
+    uint32_t inFlightTransferCount{ };
     std::filesystem::path path;
+    std::shared_ptr<Archive> archive;
+    RestorePointHeader header{ };
+    std::shared_ptr<ResourceDataRecordCache> resourceDataRecords;
+    std::shared_ptr<asio::thread_pool> threadPool;
+    std::shared_ptr<ApplyInfo> base;
     std::set<GvkStateTrackedObject> excludeObjects;
     std::unordered_set<VkObjectType> excludeObjectTypes;
     std::set<GvkStateTrackedObject> destroyObjects;
@@ -97,8 +212,8 @@ class CmdEnumerationUserData final
 public:
     const CreateInfo* pCreateInfo{ };
     VkCommandBuffer commandBuffer{ };
-    std::ofstream jsonFile;
-    std::ofstream cmdsFile;
+    std::ostringstream jsonFile;
+    std::ostringstream cmdsFile{ std::ios::binary };
     uint32_t cmdCount{ };
 };
 
@@ -120,24 +235,31 @@ inline ObjectType get_dependency(uint32_t dependencyCount, const GvkStateTracked
     return (ObjectType)get_restore_point_object_dependency<ObjectType>(dependencyCount, pDependencies).handle;
 }
 
+inline std::string get_record_key(const std::filesystem::path& restorePointPath, const std::filesystem::path& path)
+{
+    return path.lexically_relative(restorePointPath).generic_string();
+}
+
 template <typename RestoreInfoType>
 inline VkResult write_object_restore_info(const CreateInfo& restorePointCreateInfo, const std::string& type, const std::string& name, const RestoreInfoType& objectRestoreInfo)
 {
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : ".info" records are retained by the Sink so they can be read back
+        //  while the restore point is being created (ie. VkAccelerationStructureKHR
+        //  serialization updates previously written restore info).
+        assert(restorePointCreateInfo.sink);
         auto path = restorePointCreateInfo.path / type;
-        std::filesystem::create_directories(path);
         if (restorePointCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT) {
-            auto infoPath = (path / name).replace_extension("info");
-            std::ofstream infoFile(infoPath, std::ios::binary);
-            gvk_result(infoFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-            serialize(infoFile, objectRestoreInfo);
+            std::ostringstream infoStream(std::ios::binary);
+            serialize(infoStream, objectRestoreInfo);
+            auto info = infoStream.str();
+            auto infoKey = get_record_key(restorePointCreateInfo.path, (path / name).replace_extension("info"));
+            gvk_result(restorePointCreateInfo.sink->write_object(infoKey, info.size(), (const uint8_t*)info.data(), true));
         }
         if (restorePointCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BIT) {
-            auto jsonPath = (path / name).replace_extension("json");
-            std::ofstream jsonFile(jsonPath);
-            gvk_result(jsonFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-            auto printerFlags = gvk::Printer::Default & ~gvk::Printer::EnumValue;
-            jsonFile << to_string(objectRestoreInfo, printerFlags) << std::endl;
+            auto json = to_string(objectRestoreInfo, gvk::Printer::Default & ~gvk::Printer::EnumValue) + "\n";
+            auto jsonKey = get_record_key(restorePointCreateInfo.path, (path / name).replace_extension("json"));
+            gvk_result(restorePointCreateInfo.sink->write_object(jsonKey, json.size(), (const uint8_t*)json.data()));
         }
     } gvk_result_scope_end;
     return gvkResult;
@@ -155,20 +277,480 @@ inline VkResult read_object_restore_info(const std::filesystem::path& path, cons
     return gvkResult;
 }
 
-inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureType)
+template <typename RestoreInfoType>
+inline VkResult read_object_restore_info(const Archive* pArchive, const std::filesystem::path& path, const std::string& type, const std::string& name, Auto<RestoreInfoType>& restoreInfo)
 {
-    // TODO : Make this function more generic...in its current state it's only safe
-    //  if its safe to use detail::destroy_pnext_copy()
-    while (pNext) {
-        while (pNext->pNext && structureType.count(pNext->pNext->sType)) {
-            auto pRemove = pNext->pNext;
-            pNext->pNext = pRemove->pNext;
-            pRemove->pNext = nullptr;
-            detail::destroy_pnext_copy(pRemove, nullptr);
+    if (!pArchive) {
+        return read_object_restore_info(path, type, name, restoreInfo);
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto key = get_record_key(path, (path / type / name).replace_extension("info"));
+        gvk_result(pArchive->contains(key) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        auto size = pArchive->get_size(key);
+        auto pData = pArchive->get_data(key);
+        std::vector<uint8_t> data;
+        if (!pData) {
+            data.resize((size_t)size);
+            gvk_result(pArchive->read(key, 0, size, data.data()));
+            pData = data.data();
         }
-        pNext = pNext->pNext;
+        MemoryStream infoStream(pData, (size_t)size);
+        deserialize(infoStream, nullptr, restoreInfo);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+template <typename RestoreInfoType>
+inline VkResult read_object_restore_info(const CreateInfo& restorePointCreateInfo, const std::string& type, const std::string& name, Auto<RestoreInfoType>& restoreInfo)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        assert(restorePointCreateInfo.sink);
+        auto key = get_record_key(restorePointCreateInfo.path, (restorePointCreateInfo.path / type / name).replace_extension("info"));
+        std::vector<uint8_t> data;
+        gvk_result(restorePointCreateInfo.sink->read_retained(key, data));
+        MemoryStream infoStream(data.data(), data.size());
+        deserialize(infoStream, nullptr, restoreInfo);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+template <typename RestoreInfoType>
+inline VkResult read_object_restore_info(const ApplyInfo& restorePointApplyInfo, const std::string& type, const std::string& name, Auto<RestoreInfoType>& restoreInfo)
+{
+    return read_object_restore_info(restorePointApplyInfo.archive.get(), restorePointApplyInfo.path, type, name, restoreInfo);
+}
+
+inline VkResult write_resource_data(const CreateInfo& restorePointCreateInfo, const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData)
+{
+    // NOTE : Resource data is written in chunks, the first chunk starts the record
+    //  and subsequent chunks are written in place at their offsets.
+    assert(restorePointCreateInfo.sink);
+    return restorePointCreateInfo.sink->write_chunk(get_record_key(restorePointCreateInfo.path, path), dataOffset, dataSize, pData);
+}
+
+inline VkResult end_resource_data(const CreateInfo& restorePointCreateInfo, const std::filesystem::path& path)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        assert(restorePointCreateInfo.sink);
+        auto key = get_record_key(restorePointCreateInfo.path, path);
+        auto deltaPath = path;
+        deltaPath.replace_extension("delta");
+        gvk_result(restorePointCreateInfo.sink->end_object(key));
+        gvk_result(restorePointCreateInfo.sink->end_object(get_record_key(restorePointCreateInfo.path, deltaPath)));
+
+        // NOTE : The ".hash" record is written from the page hashes computed as each
+        //  chunk was written, it's followed by the record's resource data hash.
+        std::vector<PageHash> pageHashes;
+        restorePointCreateInfo.gvkRestorePoint->pageHashes.get(key, pageHashes);
+        if (!pageHashes.empty()) {
+            auto resourceDataHash = get_resource_data_hash(pageHashes);
+            std::vector<uint8_t> hashRecord(pageHashes.size() * sizeof(PageHash) + sizeof(resourceDataHash));
+            memcpy(hashRecord.data(), pageHashes.data(), pageHashes.size() * sizeof(PageHash));
+            memcpy(hashRecord.data() + pageHashes.size() * sizeof(PageHash), &resourceDataHash, sizeof(resourceDataHash));
+            auto hashPath = path;
+            hashPath.replace_extension("hash");
+            gvk_result(restorePointCreateInfo.sink->write_object(get_record_key(restorePointCreateInfo.path, hashPath), hashRecord.size(), hashRecord.data()));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkDeviceSize get_record_size(const CreateInfo& restorePointCreateInfo, const std::filesystem::path& path)
+{
+    assert(restorePointCreateInfo.sink);
+    return restorePointCreateInfo.sink->get_size(get_record_key(restorePointCreateInfo.path, path));
+}
+
+inline VkResult write_compressed_resource_data(const CreateInfo& restorePointCreateInfo, const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData)
+{
+    if (restorePointCreateInfo.compressionType == GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE) {
+        return write_resource_data(restorePointCreateInfo, path, dataOffset, dataSize, pData);
     }
-    return pNext;
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Compressed blocks are appended to the record in the order they're
+        //  written.  CopyEngine processes a resource's chunks in order on a single
+        //  thread, so the first chunk starts the record and the rest are appended.
+        std::vector<uint8_t> compressedData;
+        gvk_result(compress_resource_data(
+            restorePointCreateInfo.compressionType,
+            restorePointCreateInfo.compressionLevel,
+            restorePointCreateInfo.compressionBlockSize,
+            dataOffset,
+            dataSize,
+            pData,
+            compressedData
+        ));
+        auto recordOffset = dataOffset ? get_record_size(restorePointCreateInfo, path) : 0;
+        gvk_result(write_resource_data(restorePointCreateInfo, path, recordOffset, compressedData.size(), compressedData.data()));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult write_resource_data_chunk(const CreateInfo& restorePointCreateInfo, const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // Hash each page of the chunk so this restore point can be used as a base
+        auto key = get_record_key(restorePointCreateInfo.path, path);
+        auto pageSize = restorePointCreateInfo.deltaPageSize ? restorePointCreateInfo.deltaPageSize : PageHashes::DefaultPageSize;
+        std::vector<PageHash> pageHashes;
+        hash_resource_data_pages(pageSize, dataOffset, dataSize, pData, pageHashes);
+        restorePointCreateInfo.gvkRestorePoint->pageHashes.insert(key, dataOffset, pageHashes);
+        if (!restorePointCreateInfo.baseRestorePoint) {
+            gvk_result(write_compressed_resource_data(restorePointCreateInfo, path, dataOffset, dataSize, pData));
+            gvk_result_scope_break(VK_SUCCESS);
+        }
+
+        // NOTE : When creating a delta restore point only pages that differ from the
+        //  base restore point are written.  The ranges that are written are appended
+        //  to a ".delta" record so the Applier can resolve everything else from the
+        //  base.  Both records are started when the first chunk is written.
+        auto deltaPath = path;
+        deltaPath.replace_extension("delta");
+        if (!dataOffset) {
+            gvk_result(write_compressed_resource_data(restorePointCreateInfo, path, 0, 0, nullptr));
+            gvk_result(write_resource_data(restorePointCreateInfo, deltaPath, 0, 0, nullptr));
+        }
+        std::vector<ResourceDataRange> changedRanges;
+        restorePointCreateInfo.baseRestorePoint->pageHashes.get_changed_ranges(key, pageHashes, changedRanges);
+        for (const auto& changedRange : changedRanges) {
+            gvk_result(write_compressed_resource_data(restorePointCreateInfo, path, changedRange.offset, changedRange.size, pData + changedRange.offset - dataOffset));
+        }
+        if (!changedRanges.empty()) {
+            auto deltaOffset = get_record_size(restorePointCreateInfo, deltaPath);
+            auto deltaSize = changedRanges.size() * sizeof(ResourceDataRange);
+            gvk_result(write_resource_data(restorePointCreateInfo, deltaPath, deltaOffset, deltaSize, (const uint8_t*)changedRanges.data()));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline bool resource_data_exists(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path)
+{
+    if (restorePointApplyInfo.archive) {
+        return restorePointApplyInfo.archive->contains(get_record_key(restorePointApplyInfo.path, path));
+    }
+    return std::filesystem::exists(path);
+}
+
+inline std::unique_ptr<std::istream> open_resource_data(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path)
+{
+    if (restorePointApplyInfo.archive) {
+        const auto& archive = *restorePointApplyInfo.archive;
+        auto key = get_record_key(restorePointApplyInfo.path, path);
+        if (archive.contains(key)) {
+            auto size = archive.get_size(key);
+            auto pData = archive.get_data(key);
+            if (pData) {
+                return std::make_unique<MemoryStream>(pData, (size_t)size);
+            }
+            std::string data((size_t)size, '\0');
+            if (archive.read(key, 0, size, (uint8_t*)data.data()) == VK_SUCCESS) {
+                return std::make_unique<std::istringstream>(data, std::ios::binary);
+            }
+        }
+        return nullptr;
+    }
+    auto upFile = std::make_unique<std::ifstream>(path, std::ios::binary);
+    if (!upFile->is_open()) {
+        upFile.reset();
+    }
+    return upFile;
+}
+
+inline VkResult open_resource_data_record(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path, std::shared_ptr<const ResourceDataRecord>& spResourceDataRecord)
+{
+    auto key = get_record_key(restorePointApplyInfo.path, path);
+    if (restorePointApplyInfo.resourceDataRecords) {
+        spResourceDataRecord = restorePointApplyInfo.resourceDataRecords->get(key);
+        if (spResourceDataRecord) {
+            return VK_SUCCESS;
+        }
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : When applying from an Archive resource data is copied directly from
+        //  the mapped archive into the destination (ie. CopyEngine staging memory)
+        auto spNewResourceDataRecord = std::make_shared<ResourceDataRecord>();
+        if (restorePointApplyInfo.archive) {
+            auto spArchive = restorePointApplyInfo.archive;
+            spNewResourceDataRecord->size = spArchive->get_size(key);
+            spNewResourceDataRecord->read = [spArchive, key](uint64_t offset, uint64_t size, uint8_t* pReadData)
+            {
+                return spArchive->read(key, offset, size, pReadData);
+            };
+        } else {
+            auto spDataFile = std::make_shared<ResourceDataFile>(path);
+            gvk_result(spDataFile->is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            spNewResourceDataRecord->size = spDataFile->get_size();
+            spNewResourceDataRecord->read = [spDataFile](uint64_t offset, uint64_t size, uint8_t* pReadData)
+            {
+                return spDataFile->read(offset, size, pReadData);
+            };
+        }
+
+        // Records in restore points created with a GvkRestorePointCompressionType
+        //  other than NONE are made up of CompressedBlockHeader prefixed blocks, the
+        //  blocks are indexed once here and looked up for each chunk that's read
+        if (restorePointApplyInfo.header.compressionType != GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE) {
+            spNewResourceDataRecord->compressed = true;
+            gvk_result(CompressedBlockIndex::create(spNewResourceDataRecord->read, spNewResourceDataRecord->size, &spNewResourceDataRecord->compressedBlockIndex));
+        }
+
+        // NOTE : Delta restore points write a ".delta" record alongside each ".data"
+        //  record listing the ranges stored in the ".data" record.  The ranges are
+        //  read and sorted, and the base restore point's record is opened, once here
+        //  rather than for each chunk that's read.
+        if (restorePointApplyInfo.base) {
+            auto deltaPath = path;
+            deltaPath.replace_extension("delta");
+            auto upDeltaFile = open_resource_data(restorePointApplyInfo, deltaPath);
+            if (upDeltaFile) {
+                std::string deltaRecord((std::istreambuf_iterator<char>(*upDeltaFile)), std::istreambuf_iterator<char>());
+                gvk_result(!(deltaRecord.size() % sizeof(ResourceDataRange)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                auto& deltaRanges = spNewResourceDataRecord->deltaRanges;
+                deltaRanges.resize(deltaRecord.size() / sizeof(ResourceDataRange));
+                memcpy(deltaRanges.data(), deltaRecord.data(), deltaRecord.size());
+                std::sort(deltaRanges.begin(), deltaRanges.end(), [](const ResourceDataRange& lhs, const ResourceDataRange& rhs) { return lhs.offset < rhs.offset; });
+                spNewResourceDataRecord->delta = true;
+                const auto& baseApplyInfo = *restorePointApplyInfo.base;
+                auto basePath = baseApplyInfo.path / path.lexically_relative(restorePointApplyInfo.path);
+                if (resource_data_exists(baseApplyInfo, basePath)) {
+                    gvk_result(open_resource_data_record(baseApplyInfo, basePath, spNewResourceDataRecord->base));
+                }
+            }
+        }
+        spResourceDataRecord = spNewResourceDataRecord;
+        if (restorePointApplyInfo.resourceDataRecords) {
+            spResourceDataRecord = restorePointApplyInfo.resourceDataRecords->insert(key, spResourceDataRecord);
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult read_resource_data(const ApplyInfo& restorePointApplyInfo, const ResourceDataRecord& resourceDataRecord, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData)
+{
+    auto read_record = [&](VkDeviceSize offset, VkDeviceSize size)
+    {
+        auto pReadData = pData + offset - dataOffset;
+        if (resourceDataRecord.compressed) {
+            return resourceDataRecord.compressedBlockIndex.decompress(resourceDataRecord.read, offset, size, pReadData, restorePointApplyInfo.threadPool.get());
+        }
+        return resourceDataRecord.read(offset, size, pReadData);
+    };
+    if (!resourceDataRecord.delta) {
+        return read_record(dataOffset, dataSize);
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Ranges that aren't listed in the ".delta" record are read from the
+        //  base restore point, which may itself be a delta restore point.  If the
+        //  base restore point doesn't have the record there's nothing to restore
+        //  those ranges from, so the read fails rather than leaving the destination
+        //  with whatever it contained.
+        assert(restorePointApplyInfo.base);
+        auto read_base = [&](VkDeviceSize offset, VkDeviceSize size)
+        {
+            if (!size) {
+                return VK_SUCCESS;
+            }
+            if (!resourceDataRecord.base) {
+                return VK_ERROR_INITIALIZATION_FAILED;
+            }
+            return read_resource_data(*restorePointApplyInfo.base, *resourceDataRecord.base, offset, size, pData + offset - dataOffset);
+        };
+        const auto& deltaRanges = resourceDataRecord.deltaRanges;
+        auto dataEnd = dataOffset + dataSize;
+        auto offset = dataOffset;
+        auto itr = std::partition_point(deltaRanges.begin(), deltaRanges.end(), [&](const ResourceDataRange& range) { return range.offset + range.size <= dataOffset; });
+        for (; itr != deltaRanges.end() && itr->offset < dataEnd; ++itr) {
+            auto begin = std::max(offset, itr->offset);
+            auto end = std::min(dataEnd, itr->offset + itr->size);
+            if (begin < end) {
+                gvk_result(read_base(offset, begin - offset));
+                gvk_result(read_record(begin, end - begin));
+                offset = end;
+            }
+        }
+        gvk_result(read_base(offset, dataEnd - offset));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult read_resource_data(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        std::shared_ptr<const ResourceDataRecord> spResourceDataRecord;
+        gvk_result(open_resource_data_record(restorePointApplyInfo, path, spResourceDataRecord));
+        gvk_result(read_resource_data(restorePointApplyInfo, *spResourceDataRecord, dataOffset, dataSize, pData));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult read_resource_data_hashes(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path, std::vector<PageHash>& pageHashes, uint64_t* pResourceDataHash)
+{
+    assert(pResourceDataHash);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto hashPath = path;
+        hashPath.replace_extension("hash");
+        auto upHashFile = open_resource_data(restorePointApplyInfo, hashPath);
+        gvk_result(upHashFile ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        std::string hashRecord((std::istreambuf_iterator<char>(*upHashFile)), std::istreambuf_iterator<char>());
+        gvk_result(sizeof(uint64_t) <= hashRecord.size() && !((hashRecord.size() - sizeof(uint64_t)) % sizeof(PageHash)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        pageHashes.resize((hashRecord.size() - sizeof(uint64_t)) / sizeof(PageHash));
+        memcpy(pageHashes.data(), hashRecord.data(), pageHashes.size() * sizeof(PageHash));
+        memcpy(pResourceDataHash, hashRecord.data() + pageHashes.size() * sizeof(PageHash), sizeof(uint64_t));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult verify_resource_data(const ApplyInfo& restorePointApplyInfo, const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData)
+{
+    // NOTE : Restore points created before ".hash" records were introduced don't
+    //  have a pageSize in their RestorePointHeader and can't be verified.  Every
+    //  other restore point writes a ".hash" record for each record with data.
+    auto hashPath = path;
+    hashPath.replace_extension("hash");
+    auto upHashFile = open_resource_data(restorePointApplyInfo, hashPath);
+    if (!upHashFile) {
+        return restorePointApplyInfo.header.pageSize && dataSize ? VK_ERROR_INITIALIZATION_FAILED : VK_SUCCESS;
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        upHashFile->seekg(0, std::ios::end);
+        auto recordSize = (uint64_t)upHashFile->tellg();
+        gvk_result(sizeof(uint64_t) <= recordSize && !((recordSize - sizeof(uint64_t)) % sizeof(PageHash)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        auto pageCount = (recordSize - sizeof(uint64_t)) / sizeof(PageHash);
+        auto read_page_hash = [&](uint64_t pageIndex, PageHash& pageHash)
+        {
+            upHashFile->seekg(pageIndex * sizeof(PageHash));
+            return upHashFile->read((char*)&pageHash, sizeof(pageHash)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
+        };
+
+        // Page hashes are sorted by offset, find the first page that ends after
+        //  dataOffset without reading the entire ".hash" record for every chunk
+        uint64_t pageIndex = 0;
+        for (auto count = pageCount; count;) {
+            PageHash pageHash{ };
+            auto step = count / 2;
+            gvk_result(read_page_hash(pageIndex + step, pageHash));
+            if (pageHash.offset + pageHash.size <= dataOffset) {
+                pageIndex += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+
+        // NOTE : Pages that straddle chunks are verified with the chunk that contains
+        //  their first byte, the remainder of the page is read from the restore point
+        auto dataEnd = dataOffset + dataSize;
+        std::vector<uint8_t> pageData;
+        for (; pageIndex < pageCount; ++pageIndex) {
+            PageHash pageHash{ };
+            gvk_result(read_page_hash(pageIndex, pageHash));
+            if (dataEnd <= pageHash.offset) {
+                break;
+            }
+            if (pageHash.offset < dataOffset) {
+                continue;
+            }
+            auto pPageData = pData + pageHash.offset - dataOffset;
+            if (dataEnd < pageHash.offset + pageHash.size) {
+                pageData.resize((size_t)pageHash.size);
+                gvk_result(read_resource_data(restorePointApplyInfo, path, pageHash.offset, pageHash.size, pageData.data()));
+                pPageData = pageData.data();
+            }
+            if (hash_resource_data(pPageData, (size_t)pageHash.size) != pageHash.hash) {
+                gvk_result_scope_break(VK_ERROR_INITIALIZATION_FAILED);
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult read_restore_point_header(ApplyInfo& restorePointApplyInfo)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Restore points created before the RestorePointHeader was introduced
+        //  don't have one, they were written without compression and without any of
+        //  the GvkRestorePointCreateFlags that change how records are interpreted
+        restorePointApplyInfo.header = { };
+        auto upHeaderFile = open_resource_data(restorePointApplyInfo, restorePointApplyInfo.path / RestorePointHeader::FileName);
+        if (!upHeaderFile) {
+            restorePointApplyInfo.header.magic = 0;
+            restorePointApplyInfo.header.version = 0;
+            gvk_result_scope_break(VK_SUCCESS);
+        }
+        auto& header = restorePointApplyInfo.header;
+        gvk_result(upHeaderFile->read((char*)&header, sizeof(header)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(header.magic == RestorePointHeader::Magic ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(header.version <= RestorePointHeader::Version ? VK_SUCCESS : VK_ERROR_INCOMPATIBLE_DRIVER);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult open_base_restore_points(ApplyInfo& restorePointApplyInfo)
+{
+    // NOTE : Delta restore points write a record with the path to their base
+    //  restore point, follow the chain until a restore point without a base is
+    //  found.  MaxDepth guards against restore points that reference each other.
+    static constexpr uint32_t MaxDepth = 1024;
+    gvk_result_scope_begin(VK_SUCCESS) {
+        auto pApplyInfo = &restorePointApplyInfo;
+        for (uint32_t depth = 0; depth < MaxDepth; ++depth) {
+            auto upBaseFile = open_resource_data(*pApplyInfo, pApplyInfo->path / PageHashes::BaseRestorePointFileName);
+            if (!upBaseFile) {
+                gvk_result_scope_break(VK_SUCCESS);
+            }
+            std::string basePath((std::istreambuf_iterator<char>(*upBaseFile)), std::istreambuf_iterator<char>());
+            pApplyInfo->base = std::make_shared<ApplyInfo>();
+            pApplyInfo = pApplyInfo->base.get();
+            pApplyInfo->path = std::filesystem::u8path(basePath);
+            auto archivePath = pApplyInfo->path / Archive::FileName;
+            if (std::filesystem::is_regular_file(archivePath)) {
+                pApplyInfo->archive = std::make_shared<Archive>();
+                gvk_result(Archive::open(archivePath, pApplyInfo->archive.get()));
+            }
+            gvk_result(read_restore_point_header(*pApplyInfo));
+            pApplyInfo->resourceDataRecords = std::make_shared<ResourceDataRecordCache>();
+        }
+        gvk_result(VK_ERROR_INITIALIZATION_FAILED);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+inline VkResult open_restore_point(ApplyInfo& restorePointApplyInfo)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // If the restore point was created with GVK_RESTORE_POINT_CREATE_PACKED_ARCHIVE_BIT
+        //  all records are read from the mapped Archive instead of loose files.
+        auto archivePath = restorePointApplyInfo.path / Archive::FileName;
+        if (!restorePointApplyInfo.archive && std::filesystem::is_regular_file(archivePath)) {
+            restorePointApplyInfo.archive = std::make_shared<Archive>();
+            gvk_result(Archive::open(archivePath, restorePointApplyInfo.archive.get()));
+        }
+        gvk_result(read_restore_point_header(restorePointApplyInfo));
+        restorePointApplyInfo.resourceDataRecords = std::make_shared<ResourceDataRecordCache>();
+
+        // If the restore point is a delta restore point, open its chain of bases so
+        //  unchanged resource data can be read from them.
+        gvk_result(open_base_restore_points(restorePointApplyInfo));
+
+        // NOTE : Compressed blocks are decompressed on an asio::thread_pool shared by
+        //  every restore point in the chain, it's only created if a restore point in
+        //  the chain was created with compression and more than one thread was
+        //  requested.
+        auto compressed = false;
+        for (auto pApplyInfo = &restorePointApplyInfo; pApplyInfo; pApplyInfo = pApplyInfo->base.get()) {
+            compressed |= pApplyInfo->header.compressionType != GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE;
+        }
+        if (compressed && restorePointApplyInfo.threadCount != 1) {
+            auto spThreadPool = restorePointApplyInfo.threadCount ?
+                std::make_shared<asio::thread_pool>(restorePointApplyInfo.threadCount) :
+                std::make_shared<asio::thread_pool>();
+            for (auto pApplyInfo = &restorePointApplyInfo; pApplyInfo; pApplyInfo = pApplyInfo->base.get()) {
+                pApplyInfo->threadPool = spThreadPool;
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
 }
 
 } // namespace restore_point
@@ -35,7 +35,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-point/generated/update-structure-handles.hpp"
 #include "VK_LAYER_INTEL_gvk_state_tracker.hpp"
 
-#include <fstream>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <thread>
 #include <vector>
 
 namespace gvk {
@@ -48,9 +52,12 @@ VkResult Applier::apply_restore_point(const ApplyInfo& applyInfo)
     mLog << "Entered gvk::restore_point::Applier::apply_restore_point()" << layer::Log::Flush;
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         mApplyInfo = applyInfo;
-        std::ifstream infoFile(mApplyInfo.path / "GvkRestorePointManifest.info", std::ios::binary);
-        gvk_result(infoFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-        deserialize(infoFile, nullptr, mApplyInfo.gvkRestorePoint->manifest);
+
+        // Open the restore point's Archive (if it was created with
+        //  GVK_RESTORE_POINT_CREATE_PACKED_ARCHIVE_BIT), read its RestorePointHeader,
+        //  and open its chain of base restore points (if it's a delta restore point).
+        gvk_result(open_restore_point(mApplyInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, { }, "GvkRestorePointManifest", mApplyInfo.gvkRestorePoint->manifest));
         const auto& manifest = mApplyInfo.gvkRestorePoint->manifest;
 
         // Get the application dispatch table.  Its useful for VkPhysicalDevice calls
@@ -102,7 +109,7 @@ VkResult Applier::apply_restore_point(const ApplyInfo& applyInfo)
                     gvk_result(mApplyInfo.dispatchTable.gvkDeviceWaitIdle((VkDevice)object.handle));
                 }
                 Auto<GvkDeviceRestoreInfo> restoreInfo;
-                gvk_result(read_object_restore_info(mApplyInfo.path, "VkDevice", to_hex_string(object.handle), restoreInfo));
+                gvk_result(read_object_restore_info(mApplyInfo, "VkDevice", to_hex_string(object.handle), restoreInfo));
                 mDeviceRestoreInfos[(VkDevice)object.handle] = restoreInfo;
             } break;
             case VK_OBJECT_TYPE_DEVICE_MEMORY: {
@@ -162,12 +169,7 @@ VkResult Applier::apply_restore_point(const ApplyInfo& applyInfo)
         }
 
         // Restore objects
-        for (uint32_t i = 0; i < manifest->objectCount; ++i) {
-            const auto& object = manifest->pObjects[i];
-            if (!mApplyInfo.excluded(object)) {
-                gvk_result(restore_object(object));
-            }
-        }
+        gvk_result(restore_objects());
 
         // Restore object states
         for (uint32_t i = 0; i < manifest->objectCount; ++i) {
@@ -244,7 +246,12 @@ VkResult Applier::apply_restore_point(const ApplyInfo& applyInfo)
             }
         }
 
-        // Make sure all transfers are complete before moving on to the next steps
+        // Make sure all transfers are complete before moving on to the next steps,
+        //  uploads run on the CopyEngine's threads and host visible memory may be
+        //  mapped by an upload so they must finish before mappings are restored.
+        for (auto& copyEngine : mCopyEngines) {
+            copyEngine.second.wait();
+        }
         for (auto itr : mDeviceRestoreInfos) {
             gvk_result(mApplyInfo.dispatchTable.gvkDeviceWaitIdle(itr.first));
         }
@@ -295,6 +302,29 @@ VkResult Applier::apply_restore_point(const ApplyInfo& applyInfo)
         mApplyInfo.gvkRestorePoint->objectDestructionSubmitted.clear();
         mApplyInfo.gvkRestorePoint->createdObjects.clear();
     } gvk_result_scope_end;
+
+    // Wait for in flight uploads and report any resource data that couldn't be
+    //  read.  If GVK_RESTORE_POINT_APPLY_VERIFY_BIT is set also report any resource
+    //  data that didn't match the hashes recorded when the restore point was
+    //  created.
+    for (auto& copyEngine : mCopyEngines) {
+        copyEngine.second.wait();
+    }
+    std::unique_lock<std::mutex> resourceDataLock(mResourceDataMutex);
+    for (const auto& path : mUnreadResourceData) {
+        mLog << VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        mLog << "Failed to read resource data " << path.string() << layer::Log::Flush;
+    }
+    for (const auto& path : mUnverifiedResourceData) {
+        mLog << VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        mLog << "Resource data failed verification " << path.string() << layer::Log::Flush;
+    }
+    if ((!mUnreadResourceData.empty() || !mUnverifiedResourceData.empty()) && gvkResult == VK_SUCCESS) {
+        gvkResult = VK_ERROR_INITIALIZATION_FAILED;
+    }
+    mUnreadResourceData.clear();
+    mUnverifiedResourceData.clear();
+    resourceDataLock.unlock();
     mResult = gvkResult;
     mLog << VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
     mLog << "Leaving gvk::restore_point::Applier::apply_restore_point() " << gvk::to_string(mResult, Printer::Default & ~Printer::EnumValue) << layer::Log::Flush;
@@ -316,17 +346,209 @@ void Applier::register_restored_object_destruction(const GvkStateTrackedObject&
     mApplyInfo.gvkRestorePoint->objectMap.register_object_destruction(restoredObject);
 }
 
+VkResult Applier::read_resource_data(const std::filesystem::path& path, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData) const
+{
+    // NOTE : This is called on CopyEngine threads, if GVK_RESTORE_POINT_APPLY_VERIFY_BIT
+    //  is set each chunk is verified while it's still in cache.  Failures are
+    //  collected and reported when apply_restore_point() completes.
+    auto vkResult = restore_point::read_resource_data(mApplyInfo, path, dataOffset, dataSize, pData);
+    if (vkResult != VK_SUCCESS) {
+        std::lock_guard<std::mutex> lock(mResourceDataMutex);
+        mUnreadResourceData.insert(path);
+    } else if (mApplyInfo.flags & GVK_RESTORE_POINT_APPLY_VERIFY_BIT) {
+        if (restore_point::verify_resource_data(mApplyInfo, path, dataOffset, dataSize, pData) != VK_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mResourceDataMutex);
+            mUnverifiedResourceData.insert(path);
+        }
+    }
+    return vkResult;
+}
+
 GvkStateTrackedObject Applier::get_restored_object(const GvkStateTrackedObject& restorePointObject)
 {
     return mApplyInfo.gvkRestorePoint->objectMap.get_restored_object(restorePointObject);
 }
 
+VkResult Applier::restore_objects()
+{
+    gvk_result_scope_begin(VK_SUCCESS) {
+        const auto& manifest = mApplyInfo.gvkRestorePoint->manifest;
+
+        // Build a graph of the objects that need to be restored.  Each node tracks
+        //  the number of its dependencies that haven't been restored yet and the
+        //  nodes that are waiting on it.  Objects that have already been restored
+        //  don't need their dependencies read since restore_object() will skip them.
+        //  The restore infos read here are kept for restore_object().
+        struct Node
+        {
+            GvkStateTrackedObject object{ };
+            uint32_t dependencyCount{ };
+            std::vector<size_t> dependents;
+        };
+        std::vector<Node> nodes;
+        std::map<GvkStateTrackedObject, size_t> nodeIndices;
+        std::vector<size_t> unreadNodes;
+        auto get_node_index = [&](const GvkStateTrackedObject& object)
+        {
+            auto inserted = nodeIndices.insert({ object, nodes.size() });
+            if (inserted.second) {
+                nodes.emplace_back();
+                nodes.back().object = object;
+                if (!is_valid(mApplyInfo.gvkRestorePoint->objectMap.get_restored_object(object))) {
+                    unreadNodes.push_back(inserted.first->second);
+                }
+            }
+            return inserted.first->second;
+        };
+        for (uint32_t i = 0; i < manifest->objectCount; ++i) {
+            const auto& object = manifest->pObjects[i];
+            if (!mApplyInfo.excluded(object)) {
+                get_node_index(object);
+            }
+        }
+        std::vector<GvkStateTrackedObject> dependencies;
+        while (!unreadNodes.empty()) {
+            auto nodeIndex = unreadNodes.back();
+            unreadNodes.pop_back();
+            dependencies.clear();
+            gvk_result(read_object_dependencies(nodes[nodeIndex].object, dependencies));
+            for (const auto& dependency : dependencies) {
+                auto dependencyIndex = get_node_index(dependency);
+                nodes[dependencyIndex].dependents.push_back(nodeIndex);
+                ++nodes[nodeIndex].dependencyCount;
+            }
+        }
+
+        // NOTE : When GVK_RESTORE_POINT_APPLY_SYNTHETIC_BIT is set the restoration
+        //  calls are being recorded, so they're kept on this thread in a
+        //  deterministic order.  Otherwise objects that are safe to create
+        //  concurrently (see restore_concurrently()) are handed off to a thread pool
+        //  as soon as their dependencies have been restored.  Everything else is
+        //  restored on this thread in dependency order while the pool is working.
+        std::unique_ptr<asio::thread_pool> upThreadPool;
+        if (!(mApplyInfo.flags & GVK_RESTORE_POINT_APPLY_SYNTHETIC_BIT)) {
+            switch (mApplyInfo.threadCount) {
+            case 0: { upThreadPool = std::make_unique<asio::thread_pool>(); } break;
+            case 1: break;
+            default: { upThreadPool = std::make_unique<asio::thread_pool>(mApplyInfo.threadCount); } break;
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable conditionVariable;
+        std::deque<size_t> readyNodes;
+        std::set<std::thread::id> initializedThreads;
+        size_t inFlightCount = 0;
+        VkResult concurrentResult = VK_SUCCESS;
+        auto complete_node = [&](size_t nodeIndex)
+        {
+            for (auto dependentIndex : nodes[nodeIndex].dependents) {
+                if (!--nodes[dependentIndex].dependencyCount) {
+                    readyNodes.push_back(dependentIndex);
+                }
+            }
+        };
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (!nodes[i].dependencyCount) {
+                readyNodes.push_back(i);
+            }
+        }
+
+        // NOTE : Ready nodes are always dispatched to the thread pool before the next
+        //  node is restored on this thread so the pool is kept as busy as possible.
+        VkResult result = VK_SUCCESS;
+        std::deque<size_t> serialNodes;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (result == VK_SUCCESS && concurrentResult == VK_SUCCESS) {
+            while (!readyNodes.empty()) {
+                auto nodeIndex = readyNodes.front();
+                readyNodes.pop_front();
+                if (upThreadPool && restore_concurrently(nodes[nodeIndex].object.type)) {
+                    ++inFlightCount;
+                    asio::post(*upThreadPool, [&, nodeIndex]()
+                    {
+                        std::unique_lock<std::mutex> taskLock(mutex);
+                        if (initializedThreads.insert(std::this_thread::get_id()).second && mApplyInfo.pfnInitializeThreadCallback) {
+                            taskLock.unlock();
+                            mApplyInfo.pfnInitializeThreadCallback();
+                            taskLock.lock();
+                        }
+                        taskLock.unlock();
+                        auto taskResult = restore_object(nodes[nodeIndex].object);
+                        taskLock.lock();
+                        if (taskResult != VK_SUCCESS && concurrentResult == VK_SUCCESS) {
+                            concurrentResult = taskResult;
+                        }
+                        complete_node(nodeIndex);
+                        --inFlightCount;
+                        conditionVariable.notify_one();
+                    });
+                } else {
+                    serialNodes.push_back(nodeIndex);
+                }
+            }
+            if (!serialNodes.empty()) {
+                auto nodeIndex = serialNodes.front();
+                serialNodes.pop_front();
+                lock.unlock();
+                result = restore_object(nodes[nodeIndex].object);
+                lock.lock();
+                complete_node(nodeIndex);
+            } else if (inFlightCount) {
+                conditionVariable.wait(lock);
+            } else {
+                break;
+            }
+        }
+        conditionVariable.wait(lock, [&]() { return !inFlightCount; });
+        lock.unlock();
+        if (upThreadPool) {
+            upThreadPool->join();
+        }
+        gvk_result(result);
+        gvk_result(concurrentResult);
+
+        // NOTE : Any objects left over are part of a dependency cycle, restore_object()
+        //  guards against restoring an object more than once so they can be restored
+        //  recursively in manifest order.
+        for (uint32_t i = 0; i < manifest->objectCount; ++i) {
+            const auto& object = manifest->pObjects[i];
+            if (!mApplyInfo.excluded(object)) {
+                gvk_result(restore_object(object));
+            }
+        }
+    } gvk_result_scope_end;
+    clear_read_restore_infos();
+    return gvkResult;
+}
+
+bool Applier::restore_concurrently(VkObjectType objectType)
+{
+    // NOTE : Objects of these types are created from a VkDevice without any
+    //  externally synchronized parent and aren't touched by any of the specialized
+    //  restoration logic in the Applier.  Pipeline creation dominates restoration
+    //  time and drivers are able to compile pipelines in parallel.
+    switch (objectType) {
+    case VK_OBJECT_TYPE_BUFFER_VIEW:
+    case VK_OBJECT_TYPE_IMAGE_VIEW:
+    case VK_OBJECT_TYPE_PIPELINE:
+    case VK_OBJECT_TYPE_SAMPLER:
+    case VK_OBJECT_TYPE_SHADER_EXT:
+    case VK_OBJECT_TYPE_SHADER_MODULE: return true;
+    default: return false;
+    }
+}
+
 VkResult Applier::restore_object(const GvkStateTrackedObject& restorePointObject)
 {
     gvk_result_scope_begin(VK_SUCCESS) {
-        if (!is_valid(mApplyInfo.gvkRestorePoint->objectMap.get_restored_object(restorePointObject)) &&
-            mApplyInfo.gvkRestorePoint->objectRestorationSubmitted.insert(restorePointObject).second) {
-            gvk_result(BasicApplier::restore_object(restorePointObject));
+        if (!is_valid(mApplyInfo.gvkRestorePoint->objectMap.get_restored_object(restorePointObject))) {
+            std::unique_lock<std::mutex> lock(mObjectRestorationMutex);
+            auto submitted = mApplyInfo.gvkRestorePoint->objectRestorationSubmitted.insert(restorePointObject).second;
+            lock.unlock();
+            if (submitted) {
+                gvk_result(BasicApplier::restore_object(restorePointObject));
+            }
         }
     } gvk_result_scope_end;
     return gvkResult;
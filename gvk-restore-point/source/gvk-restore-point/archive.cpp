@@ -0,0 +1,419 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-restore-point/archive.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace gvk {
+namespace restore_point {
+
+// NOTE : Archive layout...
+//  Header  : uint64_t magic, uint64_t version
+//  Records : Record data, appended in the order they're written
+//  Index   : For each key...
+//              uint64_t keySize, char[keySize] key, uint64_t entryCount
+//              For each entry...uint64_t dataOffset, uint64_t offset, uint64_t size
+//  Footer  : uint64_t indexOffset, uint64_t keyCount, uint64_t magic
+static constexpr uint64_t ArchiveMagic = 0x43524150524b5647; // "GVKRPARC"
+static constexpr uint64_t ArchiveVersion = 1;
+static constexpr uint64_t ArchiveHeaderSize = 2 * sizeof(uint64_t);
+static constexpr uint64_t ArchiveFooterSize = 3 * sizeof(uint64_t);
+static constexpr uint64_t MinIndexKeySize = 2 * sizeof(uint64_t);
+static constexpr uint64_t IndexEntrySize = 3 * sizeof(uint64_t);
+
+template <typename T>
+static void write_value(std::ofstream& file, const T& value)
+{
+    file.write((const char*)&value, sizeof(value));
+}
+
+template <typename T>
+static bool read_value(const uint8_t* pData, uint64_t size, uint64_t* pOffset, T* pValue)
+{
+    assert(pOffset);
+    assert(pValue);
+    if (size < *pOffset + sizeof(T)) {
+        return false;
+    }
+    memcpy(pValue, pData + *pOffset, sizeof(T));
+    *pOffset += sizeof(T);
+    return true;
+}
+
+static const uint8_t* map_file(const std::filesystem::path& path, uint64_t* pSize)
+{
+    assert(pSize);
+    const uint8_t* pMappedData = nullptr;
+#if defined(_WIN32) || defined(_WIN64)
+    auto fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize{ };
+        if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart) {
+            auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle) {
+                pMappedData = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+                *pSize = pMappedData ? (uint64_t)fileSize.QuadPart : 0;
+                CloseHandle(mappingHandle);
+            }
+        }
+        CloseHandle(fileHandle);
+    }
+#else
+    auto fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor != -1) {
+        struct stat fileStatus { };
+        if (!fstat(fileDescriptor, &fileStatus) && fileStatus.st_size) {
+            auto pMapping = mmap(nullptr, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            if (pMapping != MAP_FAILED) {
+                pMappedData = (const uint8_t*)pMapping;
+                *pSize = (uint64_t)fileStatus.st_size;
+            }
+        }
+        close(fileDescriptor);
+    }
+#endif
+    return pMappedData;
+}
+
+static void unmap_file(const uint8_t* pMappedData, uint64_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)size;
+    UnmapViewOfFile(pMappedData);
+#else
+    munmap((void*)pMappedData, (size_t)size);
+#endif
+}
+
+VkResult Archive::create(const std::filesystem::path& path, Archive* pArchive)
+{
+    assert(pArchive);
+    pArchive->reset();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pArchive->mPath = path;
+        pArchive->mFile.open(path, std::ios::binary);
+        gvk_result(pArchive->mFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        write_value(pArchive->mFile, ArchiveMagic);
+        write_value(pArchive->mFile, ArchiveVersion);
+        pArchive->mFileSize = ArchiveHeaderSize;
+    } gvk_result_scope_end;
+    if (gvkResult != VK_SUCCESS) {
+        pArchive->reset();
+    }
+    return gvkResult;
+}
+
+VkResult Archive::open(const std::filesystem::path& path, Archive* pArchive)
+{
+    assert(pArchive);
+    pArchive->reset();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pArchive->mPath = path;
+        pArchive->mpMappedData = map_file(path, &pArchive->mMappedSize);
+        gvk_result(pArchive->mpMappedData ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        const auto* pData = pArchive->mpMappedData;
+        auto size = pArchive->mMappedSize;
+        gvk_result(ArchiveHeaderSize + ArchiveFooterSize <= size ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+
+        // Validate the header and footer
+        uint64_t offset = 0;
+        uint64_t magic = 0;
+        uint64_t version = 0;
+        read_value(pData, size, &offset, &magic);
+        read_value(pData, size, &offset, &version);
+        gvk_result(magic == ArchiveMagic && version == ArchiveVersion ? VK_SUCCESS : VK_ERROR_INCOMPATIBLE_DRIVER);
+        offset = size - ArchiveFooterSize;
+        uint64_t indexOffset = 0;
+        uint64_t keyCount = 0;
+        read_value(pData, size, &offset, &indexOffset);
+        read_value(pData, size, &offset, &keyCount);
+        read_value(pData, size, &offset, &magic);
+        gvk_result(magic == ArchiveMagic ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(ArchiveHeaderSize <= indexOffset && indexOffset <= size - ArchiveFooterSize ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+
+        // Read the index, entries are sorted by dataOffset so reads can walk them
+        //  in order
+        // NOTE : Counts read from the index are bounded by the number of bytes left
+        //  in the index before anything is allocated for them, a corrupt or
+        //  truncated archive shouldn't be able to request an arbitrary allocation
+        offset = indexOffset;
+        auto indexSize = size - ArchiveFooterSize;
+        gvk_result(keyCount <= (indexSize - offset) / MinIndexKeySize ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        pArchive->mEntries.reserve((size_t)keyCount);
+        for (uint64_t key_i = 0; key_i < keyCount; ++key_i) {
+            uint64_t keySize = 0;
+            gvk_result(read_value(pData, indexSize, &offset, &keySize) && keySize <= indexSize - offset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            std::string key((const char*)pData + offset, (size_t)keySize);
+            offset += keySize;
+            uint64_t entryCount = 0;
+            gvk_result(read_value(pData, indexSize, &offset, &entryCount) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            gvk_result(entryCount <= (indexSize - offset) / IndexEntrySize ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            auto& entries = pArchive->mEntries[key];
+            entries.resize((size_t)entryCount);
+            for (auto& entry : entries) {
+                gvk_result(read_value(pData, indexSize, &offset, &entry.dataOffset) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                gvk_result(read_value(pData, indexSize, &offset, &entry.offset) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                gvk_result(read_value(pData, indexSize, &offset, &entry.size) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                gvk_result(entry.offset <= indexOffset && entry.size <= indexOffset - entry.offset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                gvk_result(entry.size <= UINT64_MAX - entry.dataOffset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            }
+            std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.dataOffset < rhs.dataOffset; });
+        }
+    } gvk_result_scope_end;
+    if (gvkResult != VK_SUCCESS) {
+        pArchive->reset();
+    }
+    return gvkResult;
+}
+
+Archive::~Archive()
+{
+    reset();
+}
+
+void Archive::reset()
+{
+    if (mFile.is_open()) {
+        finalize();
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mpMappedData) {
+        unmap_file(mpMappedData, mMappedSize);
+    }
+    mReadFile.close();
+    mPath.clear();
+    mFileSize = 0;
+    mEntries.clear();
+    mpMappedData = nullptr;
+    mMappedSize = 0;
+}
+
+VkResult Archive::finalize()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        gvk_result(mFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        auto indexOffset = mFileSize;
+        for (const auto& itr : mEntries) {
+            write_value(mFile, (uint64_t)itr.first.size());
+            mFile.write(itr.first.data(), itr.first.size());
+            write_value(mFile, (uint64_t)itr.second.size());
+            for (const auto& entry : itr.second) {
+                write_value(mFile, entry.dataOffset);
+                write_value(mFile, entry.offset);
+                write_value(mFile, entry.size);
+            }
+        }
+        write_value(mFile, indexOffset);
+        write_value(mFile, (uint64_t)mEntries.size());
+        write_value(mFile, ArchiveMagic);
+        mFile.close();
+        gvk_result(mFile.good() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+    } gvk_result_scope_end;
+    mFile.close();
+    return gvkResult;
+}
+
+VkResult Archive::write(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const void* pData)
+{
+    assert(!key.empty());
+    assert(pData || !dataSize);
+    std::lock_guard<std::mutex> lock(mMutex);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        gvk_result(mFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        auto& entries = mEntries[key];
+        if (!dataOffset) {
+            entries.clear();
+        }
+        Entry entry{ };
+        entry.dataOffset = dataOffset;
+        entry.offset = mFileSize;
+        entry.size = dataSize;
+        entries.push_back(entry);
+        mFile.write((const char*)pData, dataSize);
+        mFileSize += dataSize;
+        gvk_result(mFile.good() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+bool Archive::contains(const std::string& key) const
+{
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (!mpMappedData) {
+        lock.lock();
+    }
+    return mEntries.count(key);
+}
+
+std::vector<std::string> Archive::get_keys() const
+{
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (!mpMappedData) {
+        lock.lock();
+    }
+    std::vector<std::string> keys;
+    keys.reserve(mEntries.size());
+    for (const auto& itr : mEntries) {
+        keys.push_back(itr.first);
+    }
+    return keys;
+}
+
+uint64_t Archive::get_size(const std::string& key) const
+{
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (!mpMappedData) {
+        lock.lock();
+    }
+    uint64_t size = 0;
+    auto itr = mEntries.find(key);
+    if (itr != mEntries.end()) {
+        for (const auto& entry : itr->second) {
+            size = std::max(size, entry.dataOffset + entry.size);
+        }
+    }
+    return size;
+}
+
+const uint8_t* Archive::get_data(const std::string& key) const
+{
+    // NOTE : Only records that were written contiguously can be accessed directly,
+    //  records that were interleaved with other records when they were written
+    //  need to be gathered with read()
+    const uint8_t* pData = nullptr;
+    if (mpMappedData) {
+        auto itr = mEntries.find(key);
+        if (itr != mEntries.end() && !itr->second.empty() && !itr->second.front().dataOffset) {
+            const auto& entries = itr->second;
+            auto contiguous = true;
+            for (size_t i = 1; contiguous && i < entries.size(); ++i) {
+                contiguous = entries[i].dataOffset == entries[i - 1].dataOffset + entries[i - 1].size && entries[i].offset == entries[i - 1].offset + entries[i - 1].size;
+            }
+            pData = contiguous ? mpMappedData + entries.front().offset : nullptr;
+        }
+    }
+    return pData;
+}
+
+VkResult Archive::read(const std::string& key, uint64_t dataOffset, uint64_t dataSize, uint8_t* pData) const
+{
+    assert(pData || !dataSize);
+    std::unique_lock<std::mutex> lock(mMutex, std::defer_lock);
+    if (!mpMappedData) {
+        lock.lock();
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto itr = mEntries.find(key);
+        gvk_result(itr != mEntries.end() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+
+        // NOTE : Archives that are still being written aren't mapped, flush what's
+        //  been written so far and read it back with a separate std::ifstream...the
+        //  std::ifstream is opened on the first read() and kept open until reset()
+        if (!mpMappedData) {
+            const_cast<std::ofstream&>(mFile).flush();
+            if (!mReadFile.is_open()) {
+                mReadFile.open(mPath, std::ios::binary);
+                gvk_result(mReadFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            }
+            mReadFile.clear();
+        }
+
+        // Copy the portion of each entry that overlaps the requested range
+        for (const auto& entry : itr->second) {
+            auto begin = std::max(dataOffset, entry.dataOffset);
+            auto end = std::min(dataOffset + dataSize, entry.dataOffset + entry.size);
+            if (begin < end) {
+                auto offset = entry.offset + begin - entry.dataOffset;
+                if (mpMappedData) {
+                    memcpy(pData + begin - dataOffset, mpMappedData + offset, (size_t)(end - begin));
+                } else {
+                    mReadFile.seekg(offset);
+                    mReadFile.read((char*)pData + begin - dataOffset, end - begin);
+                    gvk_result(mReadFile.good() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+                }
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+MemoryStream::MemoryStream(const uint8_t* pData, size_t size)
+    : std::istream(nullptr)
+    , mBuffer(pData, size)
+{
+    rdbuf(&mBuffer);
+}
+
+MemoryStream::Buffer::Buffer(const uint8_t* pData, size_t size)
+{
+    auto pBegin = (char*)pData;
+    setg(pBegin, pBegin, pBegin + size);
+}
+
+MemoryStream::Buffer::pos_type MemoryStream::Buffer::seekoff(off_type offset, std::ios_base::seekdir seekDirection, std::ios_base::openmode openMode)
+{
+    (void)openMode;
+    char* pPosition = nullptr;
+    switch (seekDirection) {
+    case std::ios_base::beg: pPosition = eback() + offset; break;
+    case std::ios_base::cur: pPosition = gptr() + offset; break;
+    case std::ios_base::end: pPosition = egptr() + offset; break;
+    default: break;
+    }
+    if (!pPosition || pPosition < eback() || egptr() < pPosition) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), pPosition, egptr());
+    return pos_type(pPosition - eback());
+}
+
+MemoryStream::Buffer::pos_type MemoryStream::Buffer::seekpos(pos_type position, std::ios_base::openmode openMode)
+{
+    return seekoff(off_type(position), std::ios_base::beg, openMode);
+}
+
+} // namespace restore_point
+} // namespace gvk
@@ -0,0 +1,418 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-restore-point/compression.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace gvk {
+namespace detail {
+
+// NOTE : LZ4 block format constants, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+static constexpr size_t Lz4MinMatch = 4;
+static constexpr size_t Lz4LastLiterals = 5;
+static constexpr size_t Lz4MfLimit = 12;
+static constexpr size_t Lz4MaxDistance = 65535;
+static constexpr uint32_t Lz4HashBits = 16;
+static constexpr int32_t Lz4MaxLevel = 12;
+
+static uint32_t read_u32(const uint8_t* pData)
+{
+    uint32_t value = 0;
+    memcpy(&value, pData, sizeof(value));
+    return value;
+}
+
+static uint32_t lz4_hash(uint32_t value)
+{
+    return (value * 2654435761u) >> (32 - Lz4HashBits);
+}
+
+static uint8_t* write_lz4_length(size_t length, uint8_t* pDst)
+{
+    for (; 255 <= length; length -= 255) {
+        *pDst++ = 255;
+    }
+    *pDst++ = (uint8_t)length;
+    return pDst;
+}
+
+static uint8_t* write_lz4_sequence(const uint8_t* pLiterals, size_t literalCount, size_t matchOffset, size_t matchLength, uint8_t* pDst)
+{
+    auto pToken = pDst++;
+    *pToken = (uint8_t)(std::min<size_t>(literalCount, 15) << 4);
+    if (15 <= literalCount) {
+        pDst = write_lz4_length(literalCount - 15, pDst);
+    }
+    if (literalCount) {
+        memcpy(pDst, pLiterals, literalCount);
+        pDst += literalCount;
+    }
+    if (matchLength) {
+        *pDst++ = (uint8_t)(matchOffset & 0xff);
+        *pDst++ = (uint8_t)(matchOffset >> 8);
+        matchLength -= Lz4MinMatch;
+        *pToken |= (uint8_t)std::min<size_t>(matchLength, 15);
+        if (15 <= matchLength) {
+            pDst = write_lz4_length(matchLength - 15, pDst);
+        }
+    }
+    return pDst;
+}
+
+size_t lz4_compress(const uint8_t* pSrc, size_t srcSize, int32_t level, uint8_t* pDst)
+{
+    assert(pSrc || !srcSize);
+    assert(pDst);
+    auto pDstBegin = pDst;
+    size_t anchor = 0;
+    if (Lz4MfLimit < srcSize) {
+        // NOTE : hashTable holds the most recent position + 1 for each hash, chainTable
+        //  holds the distance from each position (within the window) to the previous
+        //  position with the same hash.  Higher levels walk further down the chain.
+        level = std::clamp(level, 1, Lz4MaxLevel);
+        auto maxAttempts = 1u << (level - 1);
+        std::vector<uint32_t> hashTable(1 << Lz4HashBits);
+        std::vector<uint16_t> chainTable(Lz4MaxDistance + 1);
+        auto insert = [&](size_t position)
+        {
+            auto& head = hashTable[lz4_hash(read_u32(pSrc + position))];
+            auto distance = head ? position - (head - 1) : 0;
+            chainTable[position & Lz4MaxDistance] = (uint16_t)(distance <= Lz4MaxDistance ? distance : 0);
+            head = (uint32_t)(position + 1);
+        };
+
+        auto matchLimit = srcSize - Lz4LastLiterals;
+        size_t position = 0;
+        while (position + Lz4MfLimit <= srcSize) {
+            // Find the longest match for the current position
+            size_t matchLength = 0;
+            size_t matchPosition = 0;
+            auto head = hashTable[lz4_hash(read_u32(pSrc + position))];
+            auto candidate = head ? head - 1 : position;
+            for (uint32_t attempt_i = 0; attempt_i < maxAttempts && candidate < position && position - candidate <= Lz4MaxDistance; ++attempt_i) {
+                if (read_u32(pSrc + candidate) == read_u32(pSrc + position)) {
+                    auto length = Lz4MinMatch;
+                    while (position + length < matchLimit && pSrc[candidate + length] == pSrc[position + length]) {
+                        ++length;
+                    }
+                    if (matchLength < length) {
+                        matchLength = length;
+                        matchPosition = candidate;
+                    }
+                }
+                auto distance = chainTable[candidate & Lz4MaxDistance];
+                if (!distance || candidate < distance) {
+                    break;
+                }
+                candidate -= distance;
+            }
+            insert(position);
+
+            // Emit a sequence for the match, or move on to the next position
+            if (matchLength < Lz4MinMatch) {
+                ++position;
+            } else {
+                pDst = write_lz4_sequence(pSrc + anchor, position - anchor, position - matchPosition, matchLength, pDst);
+                auto matchEnd = position + matchLength;
+                auto insertEnd = std::min(matchEnd, srcSize - Lz4MinMatch + 1);
+                for (++position; position < insertEnd && 1 < level; ++position) {
+                    insert(position);
+                }
+                position = matchEnd;
+                anchor = position;
+            }
+        }
+    }
+    pDst = write_lz4_sequence(pSrc + anchor, srcSize - anchor, 0, 0, pDst);
+    return (size_t)(pDst - pDstBegin);
+}
+
+static bool read_lz4_length(const uint8_t* pSrc, size_t srcSize, size_t* pSrcOffset, size_t* pLength)
+{
+    uint8_t value = 255;
+    while (value == 255) {
+        if (srcSize <= *pSrcOffset) {
+            return false;
+        }
+        value = pSrc[(*pSrcOffset)++];
+        *pLength += value;
+    }
+    return true;
+}
+
+bool lz4_decompress(const uint8_t* pSrc, size_t srcSize, uint8_t* pDst, size_t dstSize)
+{
+    assert(pSrc || !srcSize);
+    assert(pDst || !dstSize);
+    size_t srcOffset = 0;
+    size_t dstOffset = 0;
+    while (srcOffset < srcSize) {
+        // Copy literals
+        auto token = pSrc[srcOffset++];
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !read_lz4_length(pSrc, srcSize, &srcOffset, &literalCount)) {
+            return false;
+        }
+        if (srcSize - srcOffset < literalCount || dstSize - dstOffset < literalCount) {
+            return false;
+        }
+        if (literalCount) {
+            memcpy(pDst + dstOffset, pSrc + srcOffset, literalCount);
+        }
+        srcOffset += literalCount;
+        dstOffset += literalCount;
+
+        // The last sequence only contains literals
+        if (srcOffset == srcSize) {
+            break;
+        }
+
+        // Copy match, matches may overlap the data they're copied to
+        if (srcSize - srcOffset < 2) {
+            return false;
+        }
+        size_t matchOffset = pSrc[srcOffset] | (pSrc[srcOffset + 1] << 8);
+        srcOffset += 2;
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !read_lz4_length(pSrc, srcSize, &srcOffset, &matchLength)) {
+            return false;
+        }
+        matchLength += Lz4MinMatch;
+        if (!matchOffset || dstOffset < matchOffset || dstSize - dstOffset < matchLength) {
+            return false;
+        }
+        auto pMatch = pDst + dstOffset - matchOffset;
+        if (matchLength <= matchOffset) {
+            memcpy(pDst + dstOffset, pMatch, matchLength);
+        } else {
+            for (size_t i = 0; i < matchLength; ++i) {
+                pDst[dstOffset + i] = pMatch[i];
+            }
+        }
+        dstOffset += matchLength;
+    }
+    return dstOffset == dstSize;
+}
+
+size_t get_lz4_compress_bound(size_t srcSize)
+{
+    return srcSize + srcSize / 255 + 16;
+}
+
+} // namespace detail
+
+namespace restore_point {
+
+VkResult compress_resource_data(
+    GvkRestorePointCompressionType compressionType,
+    int32_t compressionLevel,
+    VkDeviceSize blockSize,
+    VkDeviceSize dataOffset,
+    VkDeviceSize dataSize,
+    const uint8_t* pData,
+    std::vector<uint8_t>& compressedData
+)
+{
+    assert(pData || !dataSize);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        gvk_result(compressionType == GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE || compressionType == GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4 ? VK_SUCCESS : VK_ERROR_FORMAT_NOT_SUPPORTED);
+        blockSize = blockSize ? std::min<VkDeviceSize>(blockSize, std::numeric_limits<uint32_t>::max() / 2) : CompressedBlockHeader::DefaultBlockSize;
+        for (VkDeviceSize blockOffset = 0; blockOffset < dataSize; blockOffset += blockSize) {
+            CompressedBlockHeader header{ };
+            header.compressionType = compressionType;
+            header.dataOffset = dataOffset + blockOffset;
+            header.dataSize = std::min(blockSize, dataSize - blockOffset);
+            auto headerOffset = compressedData.size();
+            auto blockDataOffset = headerOffset + sizeof(CompressedBlockHeader);
+            auto pBlockData = pData + blockOffset;
+            if (compressionType == GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4) {
+                compressedData.resize(blockDataOffset + detail::get_lz4_compress_bound((size_t)header.dataSize));
+                header.compressedSize = (uint32_t)detail::lz4_compress(pBlockData, (size_t)header.dataSize, compressionLevel, compressedData.data() + blockDataOffset);
+            }
+
+            // Store blocks that don't compress as is
+            if (header.compressionType == GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE || header.dataSize <= header.compressedSize) {
+                header.compressionType = GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE;
+                header.compressedSize = (uint32_t)header.dataSize;
+                compressedData.resize(blockDataOffset + (size_t)header.dataSize);
+                memcpy(compressedData.data() + blockDataOffset, pBlockData, (size_t)header.dataSize);
+            }
+            compressedData.resize(blockDataOffset + header.compressedSize);
+            memcpy(compressedData.data() + headerOffset, &header, sizeof(header));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+static VkResult decompress_block(const CompressedBlockHeader& header, const uint8_t* pCompressedData, uint8_t* pData)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        switch (header.compressionType) {
+        case GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE: {
+            gvk_result(header.compressedSize == header.dataSize ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            memcpy(pData, pCompressedData, (size_t)header.dataSize);
+        } break;
+        case GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4: {
+            gvk_result(detail::lz4_decompress(pCompressedData, header.compressedSize, pData, (size_t)header.dataSize) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        } break;
+        default: {
+            gvk_result(VK_ERROR_FORMAT_NOT_SUPPORTED);
+        } break;
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult CompressedBlockIndex::create(const ReadResourceDataFunction& read, uint64_t recordSize, CompressedBlockIndex* pCompressedBlockIndex)
+{
+    assert(pCompressedBlockIndex);
+    pCompressedBlockIndex->mBlocks.clear();
+    gvk_result_scope_begin(VK_SUCCESS) {
+        uint64_t recordOffset = 0;
+        while (recordOffset < recordSize) {
+            Block block{ };
+            gvk_result(sizeof(block.header) <= recordSize - recordOffset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            gvk_result(read(recordOffset, sizeof(block.header), (uint8_t*)&block.header));
+            gvk_result(block.header.magic == CompressedBlockHeader::Magic ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            recordOffset += sizeof(block.header);
+            gvk_result(block.header.compressedSize <= recordSize - recordOffset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            gvk_result(block.header.dataSize <= std::numeric_limits<uint64_t>::max() - block.header.dataOffset ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            block.recordOffset = recordOffset;
+            pCompressedBlockIndex->mBlocks.push_back(block);
+            recordOffset += block.header.compressedSize;
+        }
+
+        // NOTE : Blocks are written in the order resource data is downloaded so
+        //  they're normally already sorted, a stable sort keeps blocks at the same
+        //  offset in the order they were written
+        auto& blocks = pCompressedBlockIndex->mBlocks;
+        std::stable_sort(blocks.begin(), blocks.end(), [](const Block& lhs, const Block& rhs) { return lhs.header.dataOffset < rhs.header.dataOffset; });
+    } gvk_result_scope_end;
+    if (gvkResult != VK_SUCCESS) {
+        pCompressedBlockIndex->mBlocks.clear();
+    }
+    return gvkResult;
+}
+
+VkResult CompressedBlockIndex::decompress(const ReadResourceDataFunction& read, VkDeviceSize dataOffset, VkDeviceSize dataSize, uint8_t* pData, asio::thread_pool* pThreadPool) const
+{
+    assert(pData || !dataSize);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // Find the blocks that overlap the requested range
+        auto dataEnd = dataOffset + dataSize;
+        auto itr = std::partition_point(mBlocks.begin(), mBlocks.end(), [&](const Block& block) { return block.header.dataOffset + block.header.dataSize <= dataOffset; });
+        auto end = itr;
+        uint64_t recordBegin = std::numeric_limits<uint64_t>::max();
+        uint64_t recordEnd = 0;
+        for (; end != mBlocks.end() && end->header.dataOffset < dataEnd; ++end) {
+            recordBegin = std::min(recordBegin, end->recordOffset);
+            recordEnd = std::max(recordEnd, end->recordOffset + end->header.compressedSize);
+        }
+        if (itr == end) {
+            gvk_result_scope_break(VK_SUCCESS);
+        }
+
+        // NOTE : Blocks overlapping a range are usually adjacent in the record, so
+        //  their compressed data is read in one call
+        std::vector<uint8_t> compressedData((size_t)(recordEnd - recordBegin));
+        gvk_result(read(recordBegin, compressedData.size(), compressedData.data()));
+        auto decompress_block_range = [&, pBlocks = &*itr](size_t block_i)
+        {
+            const auto& header = pBlocks[block_i].header;
+            const auto* pCompressedData = compressedData.data() + pBlocks[block_i].recordOffset - recordBegin;
+            auto blockEnd = header.dataOffset + header.dataSize;
+            if (dataOffset <= header.dataOffset && blockEnd <= dataEnd) {
+                return decompress_block(header, pCompressedData, pData + header.dataOffset - dataOffset);
+            }
+            std::vector<uint8_t> blockData((size_t)header.dataSize);
+            auto result = decompress_block(header, pCompressedData, blockData.data());
+            if (result == VK_SUCCESS) {
+                auto begin = std::max(dataOffset, header.dataOffset);
+                auto end = std::min(dataEnd, blockEnd);
+                memcpy(pData + begin - dataOffset, blockData.data() + begin - header.dataOffset, (size_t)(end - begin));
+            }
+            return result;
+        };
+        auto blockCount = (size_t)(end - itr);
+        if (!pThreadPool || blockCount == 1) {
+            for (size_t block_i = 0; block_i < blockCount; ++block_i) {
+                gvk_result(decompress_block_range(block_i));
+            }
+            gvk_result_scope_break(VK_SUCCESS);
+        }
+
+        // NOTE : Blocks are claimed from a shared counter by the calling thread and
+        //  by tasks posted to pThreadPool.  The calling thread only waits on blocks
+        //  that have been claimed by a running task, so this doesn't deadlock when
+        //  it's called from a task on pThreadPool.  Tasks that start after every
+        //  block has been claimed only touch the shared state.
+        struct SharedState
+        {
+            std::mutex mutex;
+            std::condition_variable conditionVariable;
+            std::atomic_size_t nextBlockIndex{ };
+            size_t completedBlockCount{ };
+            VkResult result{ VK_SUCCESS };
+            std::function<VkResult(size_t)> decompress;
+        };
+        auto spSharedState = std::make_shared<SharedState>();
+        spSharedState->decompress = decompress_block_range;
+        auto process_blocks = [blockCount](const std::shared_ptr<SharedState>& spState)
+        {
+            for (auto block_i = spState->nextBlockIndex++; block_i < blockCount; block_i = spState->nextBlockIndex++) {
+                auto result = spState->decompress(block_i);
+                std::lock_guard<std::mutex> lock(spState->mutex);
+                if (result != VK_SUCCESS && spState->result == VK_SUCCESS) {
+                    spState->result = result;
+                }
+                if (++spState->completedBlockCount == blockCount) {
+                    spState->conditionVariable.notify_one();
+                }
+            }
+        };
+        auto taskCount = std::min<size_t>(blockCount - 1, std::max(1u, std::thread::hardware_concurrency()));
+        for (size_t task_i = 0; task_i < taskCount; ++task_i) {
+            asio::post(*pThreadPool, [spSharedState, process_blocks]() { process_blocks(spSharedState); });
+        }
+        process_blocks(spSharedState);
+        std::unique_lock<std::mutex> lock(spSharedState->mutex);
+        spSharedState->conditionVariable.wait(lock, [&]() { return spSharedState->completedBlockCount == blockCount; });
+        gvk_result(spSharedState->result);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+} // namespace restore_point
+} // namespace gvk
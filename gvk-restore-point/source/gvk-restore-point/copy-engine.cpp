@@ -33,6 +33,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "stb/stb_image_write.h"
 
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <utility>
 
@@ -52,20 +54,72 @@ VkResult CopyEngine::create(const gvk::Device& device, const CreateInfo* pCreate
     case 1: break;
     default: { pCopyEngine->mupThreadPool = std::make_unique<asio::thread_pool>(pCreateInfo->threadCount); } break;
     }
+    pCopyEngine->mInFlightTransferCount = std::max(pCreateInfo->inFlightTransferCount, 1u);
+    if (pCreateInfo->stagingMemoryBudget || pCreateInfo->stagingChunkSize || 1 < pCopyEngine->mInFlightTransferCount) {
+        // NOTE : When pipelining without a staging budget or chunk size, chunks
+        //  default to 64MB...every thread gets enough staging slots to keep all of
+        //  its chunks in flight.
+        auto threadCount = std::max(pCreateInfo->threadCount ? pCreateInfo->threadCount : std::thread::hardware_concurrency(), 1u);
+        auto stagingChunkSize = pCreateInfo->stagingChunkSize;
+        if (!stagingChunkSize) {
+            stagingChunkSize = pCreateInfo->stagingMemoryBudget ? pCreateInfo->stagingMemoryBudget / (threadCount * pCopyEngine->mInFlightTransferCount) : 64 * 1024 * 1024;
+        }
+        auto stagingMemoryBudget = pCreateInfo->stagingMemoryBudget ? pCreateInfo->stagingMemoryBudget : stagingChunkSize * threadCount * pCopyEngine->mInFlightTransferCount;
+        pCopyEngine->mStagingChunkSize = std::max(stagingChunkSize, (VkDeviceSize)1);
+        auto stagingSlotCount = (uint32_t)std::max(stagingMemoryBudget / pCopyEngine->mStagingChunkSize, (VkDeviceSize)1);
+        pCopyEngine->mStagingSlots.resize(stagingSlotCount);
+        pCopyEngine->mAvailableStagingSlots.reserve(stagingSlotCount);
+        for (uint32_t i = 0; i < stagingSlotCount; ++i) {
+            pCopyEngine->mAvailableStagingSlots.push_back(stagingSlotCount - i - 1);
+        }
+    }
     uint32_t queueFamilyPropertyCount = 0;
     const auto& physicalDevice = device.get<PhysicalDevice>();
     physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyPropertyCount, nullptr);
     std::vector<VkQueueFamilyProperties> queueFamilyProperties(queueFamilyPropertyCount);
     physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyPropertyCount, queueFamilyProperties.data());
+    physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceMemoryProperties(physicalDevice, &pCopyEngine->mPhysicalDeviceMemoryProperties);
+    const QueueFamily* pQueueFamily = nullptr;
     for (const auto& queueFamily : device.get<QueueFamilies>()) {
         assert(queueFamily.index < queueFamilyProperties.size());
         auto queueFlags = queueFamilyProperties[queueFamily.index].queueFlags;
-        for (const auto& queue : queueFamily.queues) {
-            if (queueFlags == VK_QUEUE_TRANSFER_BIT || (!pCopyEngine->mQueue && (queueFlags & (VK_QUEUE_COMPUTE_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_TRANSFER_BIT)))) {
-                pCopyEngine->mQueue = queue;
+        if (!queueFamily.queues.empty()) {
+            if (queueFlags == VK_QUEUE_TRANSFER_BIT || (!pQueueFamily && (queueFlags & (VK_QUEUE_COMPUTE_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_TRANSFER_BIT)))) {
+                pQueueFamily = &queueFamily;
             }
         }
     }
+
+    // NOTE : Every VkQueue in the selected family is used.  Worker threads are
+    //  given an affinity to a VkQueue when they first submit, see queue_submit().
+    //  VkQueues from other families aren't used since resources are typically
+    //  VK_SHARING_MODE_EXCLUSIVE and the CopyEngine doesn't know which family
+    //  currently owns them, so there's nothing to release ownership from.
+    if (pQueueFamily) {
+        pCopyEngine->mQueues = pQueueFamily->queues;
+        pCopyEngine->mQueueMutexes = std::vector<std::mutex>(pCopyEngine->mQueues.size());
+        pCopyEngine->mQueue = pCopyEngine->mQueues.back();
+    }
+
+    // NOTE : VK_EXT_host_image_copy is enabled by the restore point layer when
+    //  it's available, see Layer::pre_vkCreateDevice().  VkImages created with
+    //  VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT are copied on the host when all of
+    //  their VkImageLayouts support it.
+    const VkDeviceCreateInfo& deviceCreateInfo = device.get<VkDeviceCreateInfo>();
+    auto pHostImageCopyFeatures = get_pnext<VkPhysicalDeviceHostImageCopyFeaturesEXT>(deviceCreateInfo);
+    const auto& dispatchTable = device.get<DispatchTable>();
+    if (pHostImageCopyFeatures && pHostImageCopyFeatures->hostImageCopy && dispatchTable.gvkCopyImageToMemoryEXT && dispatchTable.gvkCopyMemoryToImageEXT && dispatchTable.gvkTransitionImageLayoutEXT) {
+        auto hostImageCopyProperties = get_default<VkPhysicalDeviceHostImageCopyPropertiesEXT>();
+        auto physicalDeviceProperties = get_default<VkPhysicalDeviceProperties2>();
+        physicalDeviceProperties.pNext = &hostImageCopyProperties;
+        physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceProperties2(physicalDevice, &physicalDeviceProperties);
+        pCopyEngine->mHostImageCopySrcLayouts.resize(hostImageCopyProperties.copySrcLayoutCount);
+        pCopyEngine->mHostImageCopyDstLayouts.resize(hostImageCopyProperties.copyDstLayoutCount);
+        hostImageCopyProperties.pCopySrcLayouts = pCopyEngine->mHostImageCopySrcLayouts.data();
+        hostImageCopyProperties.pCopyDstLayouts = pCopyEngine->mHostImageCopyDstLayouts.data();
+        physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceProperties2(physicalDevice, &physicalDeviceProperties);
+        pCopyEngine->mHostImageCopyEnabled = true;
+    }
     return VK_SUCCESS;
 }
 
@@ -78,12 +132,23 @@ CopyEngine& CopyEngine::operator=(CopyEngine&& other)
 {
     if (this != &other) {
         mDevice = std::move(other.mDevice);
+        mPhysicalDeviceMemoryProperties = std::move(other.mPhysicalDeviceMemoryProperties);
+        mHostImageCopyEnabled = std::move(other.mHostImageCopyEnabled);
+        mHostImageCopySrcLayouts = std::move(other.mHostImageCopySrcLayouts);
+        mHostImageCopyDstLayouts = std::move(other.mHostImageCopyDstLayouts);
         mQueue = std::move(other.mQueue);
+        mQueues = std::move(other.mQueues);
+        mQueueMutexes = std::move(other.mQueueMutexes);
+        mThreadQueueIndices = std::move(other.mThreadQueueIndices);
         mpfnInitializeThreadCallback = std::move(other.mpfnInitializeThreadCallback);
         mupThreadPool = std::move(other.mupThreadPool);
         mTaskResources = std::move(other.mTaskResources);
         mAccelerationStructureTaskResources = std::move(other.mAccelerationStructureTaskResources);
         mAccelerationStrcutureSerializationInfoRetrieved = std::move(other.mAccelerationStrcutureSerializationInfoRetrieved);
+        mStagingChunkSize = std::move(other.mStagingChunkSize);
+        mInFlightTransferCount = std::move(other.mInFlightTransferCount);
+        mStagingSlots = std::move(other.mStagingSlots);
+        mAvailableStagingSlots = std::move(other.mAvailableStagingSlots);
     }
     return *this;
 }
@@ -97,9 +162,20 @@ void CopyEngine::reset()
 {
     wait();
     mDevice.reset();
+    mPhysicalDeviceMemoryProperties = { };
+    mHostImageCopyEnabled = false;
+    mHostImageCopySrcLayouts.clear();
+    mHostImageCopyDstLayouts.clear();
     mQueue.reset();
+    mQueues.clear();
+    mQueueMutexes.clear();
+    mThreadQueueIndices.clear();
     mupThreadPool.reset();
     mTaskResources.clear();
+    mStagingChunkSize = 0;
+    mInFlightTransferCount = 0;
+    mStagingSlots.clear();
+    mAvailableStagingSlots.clear();
 }
 
 void CopyEngine::wait()
@@ -141,10 +217,39 @@ void CopyEngine::download(DownloadDeviceMemoryInfo downloadInfo)
                 copyRegion.dstOffset = totalSize;
                 totalSize += copyRegion.size;
             }
+            downloadInfo.regionCount = (uint32_t)copyRegions.size();
+            downloadInfo.pRegions = copyRegions.data();
 
-            // Get TaskResources
-            TaskResources taskResources { };
-            gvk_result(get_task_resources(totalSize, &taskResources));
+            // If the memory is host visible read it through a mapping, chunks are
+            //  the same as they would be when copying through staging memory.  Chunks
+            //  with a single copy point directly into the mapping, otherwise copies
+            //  are gathered into host memory.  There's no staging memory so the
+            //  VkBindBufferMemoryInfo provided to the callback is empty.
+            HostMapping hostMapping{ };
+            gvk_result(map_host_visible_memory(downloadInfo.memory, downloadInfo.memoryAllocateInfo, downloadInfo.mappedMemoryInfo, true, copyRegions, &hostMapping));
+            if (hostMapping.pData) {
+                auto chunks = get_staging_chunks(copyRegions);
+                std::vector<uint8_t> chunkData;
+                for (const auto& chunk : chunks) {
+                    if (chunk.dataSize) {
+                        const uint8_t* pData = nullptr;
+                        if (chunk.copies.size() == 1) {
+                            pData = hostMapping.pData + chunk.copies[0].srcOffset - hostMapping.offset;
+                        } else {
+                            chunkData.resize((size_t)chunk.dataSize);
+                            for (const auto& copy : chunk.copies) {
+                                memcpy(chunkData.data() + copy.dstOffset, hostMapping.pData + copy.srcOffset - hostMapping.offset, (size_t)copy.size);
+                            }
+                            pData = chunkData.data();
+                        }
+                        downloadInfo.dataOffset = chunk.dataOffset;
+                        downloadInfo.dataSize = chunk.dataSize;
+                        downloadInfo.pfnCallback(downloadInfo, get_default<VkBindBufferMemoryInfo>(), pData);
+                    }
+                }
+                unmap_host_visible_memory(downloadInfo.memory, true, hostMapping);
+                gvk_result_scope_break(VK_SUCCESS);
+            }
 
             // Create Buffer and bind to target VkDeviceMemory
             auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
@@ -155,40 +260,24 @@ void CopyEngine::download(DownloadDeviceMemoryInfo downloadInfo)
             const auto& dispatchTable = mDevice.get<DispatchTable>();
             gvk_result(dispatchTable.gvkBindBufferMemory(mDevice, buffer, downloadInfo.memory, 0));
 
-            // Begin CommandBuffer
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
-
             // Copy
-            dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, buffer, taskResources.buffer, (uint32_t)copyRegions.size(), copyRegions.data());
-
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
-
-            // Submit CommandBuffer
+            auto chunks = get_staging_chunks(copyRegions);
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
-            }
+                const auto& chunk = chunks[chunk_i];
+                dispatchTable.gvkCmdCopyBuffer(vkCommandBuffer, buffer, stagingBuffer, (uint32_t)chunk.copies.size(), chunk.copies.data());
+            };
 
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+            // Fire callback
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, const uint8_t* pData)
+            {
+                downloadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                downloadInfo.dataSize = chunks[chunk_i].dataSize;
+                downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
+            };
 
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(dispatchTable.gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            downloadInfo.regionCount = (uint32_t)copyRegions.size();
-            downloadInfo.pRegions = copyRegions.data();
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
-            downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
-            dispatchTable.gvkUnmapMemory(mDevice, taskResources.memory);
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : totalSize, true, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
@@ -210,45 +299,27 @@ void CopyEngine::download(DownloadBufferInfo downloadInfo)
     auto downloadBuffer = [=]() mutable
     {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            // Get TaskResources
-            TaskResources taskResources { };
-            gvk_result(get_task_resources(bufferCreateInfo.size, &taskResources));
-
-            // Begin CommandBuffer
-            const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
-
             // Copy
             auto bufferCopy = get_default<VkBufferCopy>();
             bufferCopy.size = bufferCreateInfo.size;
-            dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, downloadInfo.buffer, taskResources.buffer, 1, &bufferCopy);
-
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
-
-            // Submit CommandBuffer
+            auto chunks = get_staging_chunks({ bufferCopy });
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
-            }
+                const auto& chunk = chunks[chunk_i];
+                dispatchTable.gvkCmdCopyBuffer(vkCommandBuffer, downloadInfo.buffer, stagingBuffer, (uint32_t)chunk.copies.size(), chunk.copies.data());
+            };
 
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+            // Fire callback
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, const uint8_t* pData)
+            {
+                downloadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                downloadInfo.dataSize = chunks[chunk_i].dataSize;
+                downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
+            };
 
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(dispatchTable.gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
-            downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
-            dispatchTable.gvkUnmapMemory(mDevice, taskResources.memory);
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : bufferCreateInfo.size, true, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
@@ -273,17 +344,43 @@ void CopyEngine::download(DownloadImageInfo downloadInfo)
     auto downloadImage = [=]() mutable
     {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            // Get TaskResources
-            TaskResources taskResources { };
-            gvk_result(get_task_resources(get_image_data_size(imageCreateInfo, imageSubresourceRange), &taskResources));
-
-            // Begin CommandBuffer
+            downloadInfo.pImageLayouts = imageLayouts.data();
             const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
+            auto chunks = get_staging_chunks(imageCreateInfo, imageSubresourceRange, imageLayouts);
+
+            // If the Image supports host copies in its current layouts, copy each chunk
+            //  directly into host memory on this thread.  No barriers are recorded so
+            //  Image layouts are left unchanged.  There's no staging memory so the
+            //  VkBindBufferMemoryInfo provided to the callback is empty.
+            if (get_host_image_copy_enabled(imageCreateInfo, imageSubresourceRange, imageLayouts, { })) {
+                std::vector<uint8_t> chunkData;
+                for (const auto& chunk : chunks) {
+                    if (chunk.dataSize) {
+                        chunkData.assign((size_t)chunk.dataSize, 0);
+                        for (const auto& copy : chunk.copies) {
+                            auto imageToMemoryCopy = get_default<VkImageToMemoryCopyEXT>();
+                            imageToMemoryCopy.pHostPointer = chunkData.data() + copy.bufferOffset;
+                            imageToMemoryCopy.memoryRowLength = copy.bufferRowLength;
+                            imageToMemoryCopy.memoryImageHeight = copy.bufferImageHeight;
+                            imageToMemoryCopy.imageSubresource = copy.imageSubresource;
+                            imageToMemoryCopy.imageOffset = copy.imageOffset;
+                            imageToMemoryCopy.imageExtent = copy.imageExtent;
+                            auto copyImageToMemoryInfo = get_default<VkCopyImageToMemoryInfoEXT>();
+                            copyImageToMemoryInfo.srcImage = downloadInfo.image;
+                            copyImageToMemoryInfo.srcImageLayout = imageLayouts[copy.imageSubresource.baseArrayLayer * imageCreateInfo.mipLevels + copy.imageSubresource.mipLevel];
+                            copyImageToMemoryInfo.regionCount = 1;
+                            copyImageToMemoryInfo.pRegions = &imageToMemoryCopy;
+                            gvk_result(dispatchTable.gvkCopyImageToMemoryEXT(mDevice, &copyImageToMemoryInfo));
+                        }
+                        downloadInfo.dataOffset = chunk.dataOffset;
+                        downloadInfo.dataSize = chunk.dataSize;
+                        downloadInfo.pfnCallback(downloadInfo, get_default<VkBindBufferMemoryInfo>(), chunkData.data());
+                    }
+                }
+                gvk_result_scope_break(VK_SUCCESS);
+            }
 
-            // Transition Image layouts to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+            // Prepare barriers to transition Image layouts to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
             std::vector<VkImageMemoryBarrier> imageMemoryBarriers;
             imageMemoryBarriers.reserve(imageSubresourceCount);
             for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
@@ -307,92 +404,71 @@ void CopyEngine::download(DownloadImageInfo downloadInfo)
                     }
                 }
             }
-            dispatchTable.gvkCmdPipelineBarrier(
-                taskResources.vkCommandBuffer,
-                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                0,
-                0, nullptr,
-                0, nullptr,
-                (uint32_t)imageMemoryBarriers.size(),
-                imageMemoryBarriers.data()
-            );
 
-            // Copy
-            VkDeviceSize bufferOffset = 0;
-            std::vector<VkBufferImageCopy> bufferImageCopies;
-            bufferImageCopies.reserve(imageSubresourceCount);
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (imageLayouts[subresource]) {
-                        auto bufferImageCopy = get_default<VkBufferImageCopy>();
-                        bufferImageCopy.bufferOffset = bufferOffset;
-                        bufferImageCopy.imageSubresource.aspectMask = get_image_aspect_flags(imageCreateInfo.format) & ~VK_IMAGE_ASPECT_STENCIL_BIT;
-                        bufferImageCopy.imageSubresource.mipLevel = mipLevel;
-                        bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
-                        bufferImageCopy.imageSubresource.layerCount = 1;
-                        bufferImageCopy.imageExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                        bufferImageCopies.push_back(bufferImageCopy);
-                    }
-                    auto arrayLayerSubresourceRange = imageSubresourceRange;
-                    arrayLayerSubresourceRange.baseMipLevel = mipLevel;
-                    arrayLayerSubresourceRange.levelCount = 1;
-                    arrayLayerSubresourceRange.baseArrayLayer = arrayLayer;
-                    arrayLayerSubresourceRange.layerCount = 1;
-                    bufferOffset += get_image_data_size(imageCreateInfo, arrayLayerSubresourceRange);
+            // Record each chunk, the first chunk transitions Image layouts to
+            //  VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL and the last chunk transitions them
+            //  back.  Chunks execute in submission order on this thread's VkQueue so
+            //  the barriers recorded in the first and last chunks cover every chunk's
+            //  copy.
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
+            {
+                const auto& chunk = chunks[chunk_i];
+
+                // Transition Image layouts to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+                if (!chunk_i) {
+                    dispatchTable.gvkCmdPipelineBarrier(
+                        vkCommandBuffer,
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                        0,
+                        0, nullptr,
+                        0, nullptr,
+                        (uint32_t)imageMemoryBarriers.size(),
+                        imageMemoryBarriers.data()
+                    );
                 }
-            }
-            dispatchTable.gvkCmdCopyImageToBuffer(
-                taskResources.vkCommandBuffer,
-                downloadInfo.image,
-                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                taskResources.buffer,
-                (uint32_t)bufferImageCopies.size(),
-                bufferImageCopies.data()
-            );
 
-            // Transition Image layouts back
-            for (auto& imageMemoryBarrier : imageMemoryBarriers) {
-                std::swap(imageMemoryBarrier.srcAccessMask, imageMemoryBarrier.dstAccessMask);
-                std::swap(imageMemoryBarrier.oldLayout, imageMemoryBarrier.newLayout);
-            }
-            dispatchTable.gvkCmdPipelineBarrier(
-                taskResources.vkCommandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                0,
-                0, nullptr,
-                0, nullptr,
-                (uint32_t)imageMemoryBarriers.size(),
-                imageMemoryBarriers.data()
-            );
+                // Copy
+                if (!chunk.copies.empty()) {
+                    dispatchTable.gvkCmdCopyImageToBuffer(
+                        vkCommandBuffer,
+                        downloadInfo.image,
+                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        stagingBuffer,
+                        (uint32_t)chunk.copies.size(),
+                        chunk.copies.data()
+                    );
+                }
 
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
+                // Transition Image layouts back
+                if (chunk_i == chunks.size() - 1) {
+                    for (auto& imageMemoryBarrier : imageMemoryBarriers) {
+                        std::swap(imageMemoryBarrier.srcAccessMask, imageMemoryBarrier.dstAccessMask);
+                        std::swap(imageMemoryBarrier.oldLayout, imageMemoryBarrier.newLayout);
+                    }
+                    dispatchTable.gvkCmdPipelineBarrier(
+                        vkCommandBuffer,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                        0,
+                        0, nullptr,
+                        0, nullptr,
+                        (uint32_t)imageMemoryBarriers.size(),
+                        imageMemoryBarriers.data()
+                    );
+                }
+            };
 
-            // Submit CommandBuffer
+            // Fire callback
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, const uint8_t* pData)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
-            }
-
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+                downloadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                downloadInfo.dataSize = chunks[chunk_i].dataSize;
+                downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
+            };
 
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(dispatchTable.gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            downloadInfo.pImageLayouts = imageLayouts.data();
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
-            downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
-            dispatchTable.gvkUnmapMemory(mDevice, taskResources.memory);
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : get_image_data_size(imageCreateInfo, imageSubresourceRange), true, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
@@ -539,8 +615,7 @@ void CopyEngine::download_to_host_mapped_memory(DownloadDeviceMemoryInfo downloa
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
             // Hold this thread's execution until transfer is complete
@@ -548,6 +623,8 @@ void CopyEngine::download_to_host_mapped_memory(DownloadDeviceMemoryInfo downloa
             gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
 
             // TODO : Documentation
+            downloadInfo.dataOffset = 0;
+            downloadInfo.dataSize = copyRegions.back().dstOffset + copyRegions.back().size;
             auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
             bindBufferMemoryInfo.buffer = taskResources.buffer;
             bindBufferMemoryInfo.memory = taskResources.memory;
@@ -564,93 +641,116 @@ void CopyEngine::download_to_host_mapped_memory(DownloadDeviceMemoryInfo downloa
 }
 
 void CopyEngine::download(DownloadAccelerationStructureInfo downloadInfo)
+{
+    download(1, &downloadInfo);
+}
+
+void CopyEngine::download(uint32_t downloadInfoCount, const DownloadAccelerationStructureInfo* pDownloadInfos)
 {
     assert(mDevice);
     assert(mQueue);
-    assert(downloadInfo.accelerationStructure);
-    assert(downloadInfo.buffer);
-    assert(downloadInfo.memory);
-    assert(downloadInfo.device);
-    assert(downloadInfo.pfnCallback);
-    auto downloadAccelerationStructureEx = [=]() mutable
+    assert(!downloadInfoCount || pDownloadInfos);
+    if (!downloadInfoCount) {
+        return;
+    }
+    std::vector<DownloadAccelerationStructureInfo> downloadInfos(pDownloadInfos, pDownloadInfos + downloadInfoCount);
+    for (const auto& downloadInfo : downloadInfos) {
+        (void)downloadInfo;
+        assert(downloadInfo.accelerationStructure);
+        assert(downloadInfo.buffer);
+        assert(downloadInfo.buffer == downloadInfos[0].buffer);
+        assert(downloadInfo.memory);
+        assert(downloadInfo.device);
+        assert(downloadInfo.pfnCallback);
+    }
+    auto downloadAccelerationStructuresEx = [=]() mutable
     {
         // TODO : Need to handle host allocated acceleration structures
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+            // NOTE : Each acceleration structure is serialized to its own range of the
+            //  serialization buffer, the ranges are copied to staging memory in place.
+            VkDeviceSize taskSize = 0;
+            std::vector<VkBufferCopy> bufferCopies;
+            bufferCopies.reserve(downloadInfos.size());
+            for (const auto& downloadInfo : downloadInfos) {
+                auto bufferCopy = get_default<VkBufferCopy>();
+                bufferCopy.srcOffset = downloadInfo.bufferOffset;
+                bufferCopy.dstOffset = downloadInfo.bufferOffset;
+                bufferCopy.size = downloadInfo.accelerationStructureSerializedSize;
+                bufferCopies.push_back(bufferCopy);
+                taskSize = std::max(taskSize, bufferCopy.dstOffset + bufferCopy.size);
+            }
+
             // Get TaskResources
             TaskResources taskResources{ };
-            gvk_result(get_task_resources(downloadInfo.accelerationStructureSerializedSize, &taskResources));
-
-            // Begin CommandBuffer
+            gvk_result(get_task_resources(taskSize, &taskResources));
             const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
-
-            // Copy VkAccelerationStructureKHR -> VkBuffer
-            auto accelerationStructureCopy = get_default<VkCopyAccelerationStructureToMemoryInfoKHR>();
-            accelerationStructureCopy.src = downloadInfo.accelerationStructure;
-            accelerationStructureCopy.dst.deviceAddress = downloadInfo.bufferDeviceAddress;
-            accelerationStructureCopy.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_SERIALIZE_KHR;
-            dispatchTable.gvkCmdCopyAccelerationStructureToMemoryKHR(taskResources.vkCommandBuffer, &accelerationStructureCopy);
 
-            // TODO : Barrier?
+            // NOTE : The serialization buffer is shared by every batch so the GPU work
+            //  for a batch is serialized with the GPU work for other batches.  Mapping
+            //  the staging memory and firing callbacks happens outside of the lock.
+            {
+                std::lock_guard<std::mutex> serializationLock(mAccelerationStructureSerializationMutex);
 
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
+                // Begin CommandBuffer
+                auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+                commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+                gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
 
-            // Submit CommandBuffer
-            {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
-            }
+                // Copy VkAccelerationStructureKHR -> VkBuffer
+                for (const auto& downloadInfo : downloadInfos) {
+                    auto accelerationStructureCopy = get_default<VkCopyAccelerationStructureToMemoryInfoKHR>();
+                    accelerationStructureCopy.src = downloadInfo.accelerationStructure;
+                    accelerationStructureCopy.dst.deviceAddress = downloadInfo.bufferDeviceAddress + downloadInfo.bufferOffset;
+                    accelerationStructureCopy.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_SERIALIZE_KHR;
+                    dispatchTable.gvkCmdCopyAccelerationStructureToMemoryKHR(taskResources.vkCommandBuffer, &accelerationStructureCopy);
+                }
 
-            // Hold this thread's execution until the transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+                // Make serialized data available to the transfer
+                auto memoryBarrier = get_default<VkMemoryBarrier>();
+                memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                auto srcStageMask = VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+                auto dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+                dispatchTable.gvkCmdPipelineBarrier(taskResources.vkCommandBuffer, srcStageMask, dstStageMask, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
 
-            // Begin CommandBuffer
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
+                // Copy VkBuffer -> staging VkBuffer
+                dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, downloadInfos[0].buffer, taskResources.buffer, (uint32_t)bufferCopies.size(), bufferCopies.data());
 
-            // TODO : Documentation
-            auto bufferCopy = get_default<VkBufferCopy>();
-            bufferCopy.size = downloadInfo.accelerationStructureSerializedSize;
-            dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, downloadInfo.buffer, taskResources.buffer, 1, &bufferCopy);
+                // End CommandBuffer
+                gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
 
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
+                // Submit CommandBuffer
+                {
+                    auto submitInfo = get_default<VkSubmitInfo>();
+                    submitInfo.commandBufferCount = 1;
+                    submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
+                    gvk_result(queue_submit(submitInfo, taskResources.fence));
+                }
 
-            // Submit CommandBuffer
-            {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                // Hold this thread's execution until the transfer is complete
+                gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
+                gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
             }
 
-            // Hold this thread's execution until the transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
-
-            // Map data, fire callback, unmap data
+            // Map data, fire callbacks, unmap data
             uint8_t* pData = nullptr;
             gvk_result(dispatchTable.gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
             auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
             bindBufferMemoryInfo.buffer = taskResources.buffer;
             bindBufferMemoryInfo.memory = taskResources.memory;
-            downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData);
+            for (const auto& downloadInfo : downloadInfos) {
+                downloadInfo.pfnCallback(downloadInfo, bindBufferMemoryInfo, pData + downloadInfo.bufferOffset);
+            }
             dispatchTable.gvkUnmapMemory(mDevice, taskResources.memory);
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
     };
     if (mupThreadPool) {
-        asio::post(*mupThreadPool, [downloadAccelerationStructureEx]() mutable { downloadAccelerationStructureEx(); });
+        asio::post(*mupThreadPool, [downloadAccelerationStructuresEx]() mutable { downloadAccelerationStructuresEx(); });
     } else {
-        downloadAccelerationStructureEx();
+        downloadAccelerationStructuresEx();
     }
 }
 
@@ -669,24 +769,47 @@ void CopyEngine::upload(UploadDeviceMemoryInfo uploadInfo)
         copyRegion.size = uploadInfo.memoryAllocateInfo.allocationSize;
         copyRegions.push_back(copyRegion);
     }
-    auto uploadDeviceMemory = [=]() mutable
+    auto uploadMemory = [=]() mutable
     {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            // Get TaskResources
-            TaskResources taskResources{ };
-            // TODO : Handle regions
-            gvk_result(get_task_resources(memoryAllocateInfo.allocationSize, &taskResources));
-
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(mDevice.get<DispatchTable>().gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
+            // Calculate total size and set dstOffsets
+            VkDeviceSize totalSize = 0;
+            for (auto& copyRegion : copyRegions) {
+                copyRegion.dstOffset = totalSize;
+                totalSize += copyRegion.size;
+            }
             uploadInfo.regionCount = (uint32_t)copyRegions.size();
             uploadInfo.pRegions = copyRegions.data();
-            uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
-            mDevice.get<DispatchTable>().gvkUnmapMemory(mDevice, taskResources.memory);
+
+            // If the memory is host visible write it through a mapping, chunks are
+            //  the same as they would be when copying through staging memory.  Chunks
+            //  with a single copy are written directly into the mapping, otherwise the
+            //  chunk is written into host memory and scattered.  The Applier waits on
+            //  the CopyEngine before restoring the memory's mapping so the two never
+            //  overlap.
+            HostMapping hostMapping{ };
+            gvk_result(map_host_visible_memory(uploadInfo.memory, uploadInfo.memoryAllocateInfo, uploadInfo.mappedMemoryInfo, false, copyRegions, &hostMapping));
+            if (hostMapping.pData) {
+                auto chunks = get_staging_chunks(copyRegions);
+                std::vector<uint8_t> chunkData;
+                for (const auto& chunk : chunks) {
+                    if (chunk.dataSize) {
+                        uploadInfo.dataOffset = chunk.dataOffset;
+                        uploadInfo.dataSize = chunk.dataSize;
+                        if (chunk.copies.size() == 1) {
+                            uploadInfo.pfnCallback(uploadInfo, get_default<VkBindBufferMemoryInfo>(), hostMapping.pData + chunk.copies[0].srcOffset - hostMapping.offset);
+                        } else {
+                            chunkData.resize((size_t)chunk.dataSize);
+                            uploadInfo.pfnCallback(uploadInfo, get_default<VkBindBufferMemoryInfo>(), chunkData.data());
+                            for (const auto& copy : chunk.copies) {
+                                memcpy(hostMapping.pData + copy.srcOffset - hostMapping.offset, chunkData.data() + copy.dstOffset, (size_t)copy.size);
+                            }
+                        }
+                    }
+                }
+                unmap_host_visible_memory(uploadInfo.memory, false, hostMapping);
+                gvk_result_scope_break(VK_SUCCESS);
+            }
 
             // Create dst Buffer and bind it to dst VkDeviceMemory
             auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
@@ -694,42 +817,40 @@ void CopyEngine::upload(UploadDeviceMemoryInfo uploadInfo)
             bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             Buffer dstBuffer;
             gvk_result(Buffer::create(mDevice, &bufferCreateInfo, (VkAllocationCallbacks*)nullptr, &dstBuffer));
-            gvk_result(mDevice.get<DispatchTable>().gvkBindBufferMemory(mDevice, dstBuffer, uploadInfo.memory, 0));
-
-            // Begin CommandBuffer
             const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
+            gvk_result(dispatchTable.gvkBindBufferMemory(mDevice, dstBuffer, uploadInfo.memory, 0));
 
-            // Copy
-            auto bufferCopy = get_default<VkBufferCopy>();
-            bufferCopy.size = memoryAllocateInfo.allocationSize;
-            dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, taskResources.buffer, dstBuffer, 1, &bufferCopy);
-
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
-
-            // Submit CommandBuffer
+            // Fire callback
+            auto chunks = get_staging_chunks(copyRegions);
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                uploadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                uploadInfo.dataSize = chunks[chunk_i].dataSize;
+                uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
+            };
+
+            // Copy
+            for (auto& chunk : chunks) {
+                for (auto& copy : chunk.copies) {
+                    std::swap(copy.srcOffset, copy.dstOffset);
+                }
             }
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
+            {
+                const auto& chunk = chunks[chunk_i];
+                dispatchTable.gvkCmdCopyBuffer(vkCommandBuffer, stagingBuffer, dstBuffer, (uint32_t)chunk.copies.size(), chunk.copies.data());
+            };
 
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : totalSize, false, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
     };
     if (mupThreadPool) {
-        asio::post(*mupThreadPool, [uploadDeviceMemory]() mutable { uploadDeviceMemory(); });
+        asio::post(*mupThreadPool, [uploadMemory]() mutable { uploadMemory(); });
     } else {
-        uploadDeviceMemory();
+        uploadMemory();
     }
 }
 
@@ -743,45 +864,32 @@ void CopyEngine::upload(UploadBufferInfo uploadInfo)
     auto uploadBuffer = [=]() mutable
     {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            // Get TaskResources
-            TaskResources taskResources{ };
-            gvk_result(get_task_resources(bufferCreateInfo.size, &taskResources));
-
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(mDevice.get<DispatchTable>().gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
-            uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
-            mDevice.get<DispatchTable>().gvkUnmapMemory(mDevice, taskResources.memory);
-
-            // Begin CommandBuffer
-            const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
-
-            // Copy
+            // Fire callback
             auto bufferCopy = get_default<VkBufferCopy>();
             bufferCopy.size = bufferCreateInfo.size;
-            dispatchTable.gvkCmdCopyBuffer(taskResources.vkCommandBuffer, taskResources.buffer, uploadInfo.buffer, 1, &bufferCopy);
-
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
-
-            // Submit CommandBuffer
+            auto chunks = get_staging_chunks({ bufferCopy });
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                uploadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                uploadInfo.dataSize = chunks[chunk_i].dataSize;
+                uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
+            };
+
+            // Copy
+            for (auto& chunk : chunks) {
+                for (auto& copy : chunk.copies) {
+                    std::swap(copy.srcOffset, copy.dstOffset);
+                }
             }
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
+            {
+                const auto& chunk = chunks[chunk_i];
+                dispatchTable.gvkCmdCopyBuffer(vkCommandBuffer, stagingBuffer, uploadInfo.buffer, (uint32_t)chunk.copies.size(), chunk.copies.data());
+            };
 
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : bufferCreateInfo.size, false, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
@@ -807,148 +915,168 @@ void CopyEngine::upload(UploadImageInfo uploadInfo)
     auto uploadBuffer = [=]() mutable
     {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            // Get TaskResources
-            TaskResources taskResources{ };
-            gvk_result(get_task_resources(get_image_data_size(imageCreateInfo, imageSubresourceRange), &taskResources));
-
-            // Map data, fire callback, unmap data
-            uint8_t* pData = nullptr;
-            gvk_result(mDevice.get<DispatchTable>().gvkMapMemory(mDevice, taskResources.memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
-            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
-            bindBufferMemoryInfo.buffer = taskResources.buffer;
-            bindBufferMemoryInfo.memory = taskResources.memory;
-            uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
-            mDevice.get<DispatchTable>().gvkUnmapMemory(mDevice, taskResources.memory);
-
-            // Begin CommandBuffer
+            // Fire callback
+            uploadInfo.pOldImageLayouts = oldImageLayouts.data();
+            uploadInfo.pNewImageLayouts = newImageLayouts.data();
+            auto chunks = get_staging_chunks(imageCreateInfo, imageSubresourceRange, newImageLayouts);
+            auto processChunk = [&](size_t chunk_i, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
+            {
+                uploadInfo.dataOffset = chunks[chunk_i].dataOffset;
+                uploadInfo.dataSize = chunks[chunk_i].dataSize;
+                uploadInfo.pfnCallback(uploadInfo, bindBufferMemoryInfo, pData);
+            };
+
+            // If the Image supports host copies, transition Image layouts directly to
+            //  their new layouts on the host then copy each chunk from host memory on
+            //  this thread.  There's no staging memory so the VkBindBufferMemoryInfo
+            //  provided to the callback is empty.
             const auto& dispatchTable = mDevice.get<DispatchTable>();
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
-
-            // Transition Image layouts to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-            std::vector<VkImageMemoryBarrier> imageMemoryBarriers;
-            imageMemoryBarriers.reserve(imageSubresourceCount);
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (newImageLayouts[subresource]) {
-                        auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
-                        imageMemoryBarrier.srcAccessMask = 0;
-                        imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                        imageMemoryBarrier.oldLayout = oldImageLayouts[subresource];
-                        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                        imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                        imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                        imageMemoryBarrier.image = uploadInfo.image;
-                        imageMemoryBarrier.subresourceRange = imageSubresourceRange;
-                        imageMemoryBarrier.subresourceRange.baseMipLevel = mipLevel;
-                        imageMemoryBarrier.subresourceRange.levelCount = 1;
-                        imageMemoryBarrier.subresourceRange.baseArrayLayer = arrayLayer;
-                        imageMemoryBarrier.subresourceRange.layerCount = 1;
-                        imageMemoryBarriers.push_back(imageMemoryBarrier);
+            if (get_host_image_copy_enabled(imageCreateInfo, imageSubresourceRange, oldImageLayouts, newImageLayouts)) {
+                std::vector<VkHostImageLayoutTransitionInfoEXT> hostImageLayoutTransitionInfos;
+                hostImageLayoutTransitionInfos.reserve(imageSubresourceCount);
+                for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+                    for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+                        auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
+                        if (newImageLayouts[subresource]) {
+                            auto hostImageLayoutTransitionInfo = get_default<VkHostImageLayoutTransitionInfoEXT>();
+                            hostImageLayoutTransitionInfo.image = uploadInfo.image;
+                            hostImageLayoutTransitionInfo.oldLayout = oldImageLayouts[subresource];
+                            hostImageLayoutTransitionInfo.newLayout = newImageLayouts[subresource];
+                            hostImageLayoutTransitionInfo.subresourceRange = imageSubresourceRange;
+                            hostImageLayoutTransitionInfo.subresourceRange.baseMipLevel = mipLevel;
+                            hostImageLayoutTransitionInfo.subresourceRange.levelCount = 1;
+                            hostImageLayoutTransitionInfo.subresourceRange.baseArrayLayer = arrayLayer;
+                            hostImageLayoutTransitionInfo.subresourceRange.layerCount = 1;
+                            hostImageLayoutTransitionInfos.push_back(hostImageLayoutTransitionInfo);
+                        }
                     }
                 }
-            }
-            dispatchTable.gvkCmdPipelineBarrier(
-                taskResources.vkCommandBuffer,
-                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                0,
-                0, nullptr,
-                0, nullptr,
-                (uint32_t)imageMemoryBarriers.size(),
-                imageMemoryBarriers.data()
-            );
-
-            // Copy
-            VkDeviceSize bufferOffset = 0;
-            std::vector<VkBufferImageCopy> bufferImageCopies;
-            bufferImageCopies.reserve(imageSubresourceCount);
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (newImageLayouts[subresource]) {
-                        auto bufferImageCopy = get_default<VkBufferImageCopy>();
-                        bufferImageCopy.bufferOffset = bufferOffset;
-                        bufferImageCopy.imageSubresource.aspectMask = get_image_aspect_flags(imageCreateInfo.format) & ~VK_IMAGE_ASPECT_STENCIL_BIT;
-                        bufferImageCopy.imageSubresource.mipLevel = mipLevel;
-                        bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
-                        bufferImageCopy.imageSubresource.layerCount = 1;
-                        bufferImageCopy.imageExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                        bufferImageCopies.push_back(bufferImageCopy);
-                    }
-                    auto arrayLayerSubresourceRange = imageSubresourceRange;
-                    arrayLayerSubresourceRange.baseMipLevel = mipLevel;
-                    arrayLayerSubresourceRange.levelCount = 1;
-                    arrayLayerSubresourceRange.baseArrayLayer = arrayLayer;
-                    arrayLayerSubresourceRange.layerCount = 1;
-                    bufferOffset += get_image_data_size(imageCreateInfo, arrayLayerSubresourceRange);
+                if (!hostImageLayoutTransitionInfos.empty()) {
+                    gvk_result(dispatchTable.gvkTransitionImageLayoutEXT(mDevice, (uint32_t)hostImageLayoutTransitionInfos.size(), hostImageLayoutTransitionInfos.data()));
                 }
-            }
-
-            // TODO : We kinda don't want to be here if we have no copies to perform...
-            //  Need layout transition and transfer logic to be modular.
-            if (!bufferImageCopies.empty()) {
-                dispatchTable.gvkCmdCopyBufferToImage(
-                    taskResources.vkCommandBuffer,
-                    taskResources.buffer,
-                    uploadInfo.image,
-                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                    (uint32_t)bufferImageCopies.size(),
-                    bufferImageCopies.data()
-                );
-            }
-
-            // Transition Image layouts back
-            imageMemoryBarriers.clear();
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (newImageLayouts[subresource]) {
-                        auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
-                        imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                        imageMemoryBarrier.dstAccessMask = 0;
-                        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                        imageMemoryBarrier.newLayout = newImageLayouts[subresource];
-                        imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                        imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                        imageMemoryBarrier.image = uploadInfo.image;
-                        imageMemoryBarrier.subresourceRange = imageSubresourceRange;
-                        imageMemoryBarrier.subresourceRange.baseMipLevel = mipLevel;
-                        imageMemoryBarrier.subresourceRange.levelCount = 1;
-                        imageMemoryBarrier.subresourceRange.baseArrayLayer = arrayLayer;
-                        imageMemoryBarrier.subresourceRange.layerCount = 1;
-                        imageMemoryBarriers.push_back(imageMemoryBarrier);
+                std::vector<uint8_t> chunkData;
+                for (size_t chunk_i = 0; chunk_i < chunks.size(); ++chunk_i) {
+                    const auto& chunk = chunks[chunk_i];
+                    if (chunk.dataSize) {
+                        chunkData.assign((size_t)chunk.dataSize, 0);
+                        processChunk(chunk_i, get_default<VkBindBufferMemoryInfo>(), chunkData.data());
+                        for (const auto& copy : chunk.copies) {
+                            auto memoryToImageCopy = get_default<VkMemoryToImageCopyEXT>();
+                            memoryToImageCopy.pHostPointer = chunkData.data() + copy.bufferOffset;
+                            memoryToImageCopy.memoryRowLength = copy.bufferRowLength;
+                            memoryToImageCopy.memoryImageHeight = copy.bufferImageHeight;
+                            memoryToImageCopy.imageSubresource = copy.imageSubresource;
+                            memoryToImageCopy.imageOffset = copy.imageOffset;
+                            memoryToImageCopy.imageExtent = copy.imageExtent;
+                            auto copyMemoryToImageInfo = get_default<VkCopyMemoryToImageInfoEXT>();
+                            copyMemoryToImageInfo.dstImage = uploadInfo.image;
+                            copyMemoryToImageInfo.dstImageLayout = newImageLayouts[copy.imageSubresource.baseArrayLayer * imageCreateInfo.mipLevels + copy.imageSubresource.mipLevel];
+                            copyMemoryToImageInfo.regionCount = 1;
+                            copyMemoryToImageInfo.pRegions = &memoryToImageCopy;
+                            gvk_result(dispatchTable.gvkCopyMemoryToImageEXT(mDevice, &copyMemoryToImageInfo));
+                        }
                     }
                 }
-            }
-            dispatchTable.gvkCmdPipelineBarrier(
-                taskResources.vkCommandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT,
-                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                0,
-                0, nullptr,
-                0, nullptr,
-                (uint32_t)imageMemoryBarriers.size(),
-                imageMemoryBarriers.data()
-            );
-
-            // End CommandBuffer
-            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
+                gvk_result_scope_break(VK_SUCCESS);
+            }
 
-            // Submit CommandBuffer
+            // Record each chunk, the first chunk transitions Image layouts to
+            //  VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL and the last chunk transitions them
+            //  to their new layouts.  Chunks execute in submission order on this
+            //  thread's VkQueue so the barriers recorded in the first and last chunks
+            //  cover every chunk's copy.
+            auto recordChunk = [&](size_t chunk_i, VkCommandBuffer vkCommandBuffer, VkBuffer stagingBuffer)
             {
-                auto submitInfo = get_default<VkSubmitInfo>();
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
-            }
+                const auto& chunk = chunks[chunk_i];
+
+                // Transition Image layouts to VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+                std::vector<VkImageMemoryBarrier> imageMemoryBarriers;
+                if (!chunk_i) {
+                    imageMemoryBarriers.reserve(imageSubresourceCount);
+                    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+                        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+                            auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
+                            if (newImageLayouts[subresource]) {
+                                auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
+                                imageMemoryBarrier.srcAccessMask = 0;
+                                imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                                imageMemoryBarrier.oldLayout = oldImageLayouts[subresource];
+                                imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                                imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                                imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                                imageMemoryBarrier.image = uploadInfo.image;
+                                imageMemoryBarrier.subresourceRange = imageSubresourceRange;
+                                imageMemoryBarrier.subresourceRange.baseMipLevel = mipLevel;
+                                imageMemoryBarrier.subresourceRange.levelCount = 1;
+                                imageMemoryBarrier.subresourceRange.baseArrayLayer = arrayLayer;
+                                imageMemoryBarrier.subresourceRange.layerCount = 1;
+                                imageMemoryBarriers.push_back(imageMemoryBarrier);
+                            }
+                        }
+                    }
+                    dispatchTable.gvkCmdPipelineBarrier(
+                        vkCommandBuffer,
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                        0,
+                        0, nullptr,
+                        0, nullptr,
+                        (uint32_t)imageMemoryBarriers.size(),
+                        imageMemoryBarriers.data()
+                    );
+                }
 
-            // Hold this thread's execution until transfer is complete
-            gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
-            gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
+                // Copy
+                if (!chunk.copies.empty()) {
+                    dispatchTable.gvkCmdCopyBufferToImage(
+                        vkCommandBuffer,
+                        stagingBuffer,
+                        uploadInfo.image,
+                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        (uint32_t)chunk.copies.size(),
+                        chunk.copies.data()
+                    );
+                }
+
+                // Transition Image layouts to their new layouts
+                if (chunk_i == chunks.size() - 1) {
+                    imageMemoryBarriers.clear();
+                    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+                        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+                            auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
+                            if (newImageLayouts[subresource]) {
+                                auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
+                                imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                                imageMemoryBarrier.dstAccessMask = 0;
+                                imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                                imageMemoryBarrier.newLayout = newImageLayouts[subresource];
+                                imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                                imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                                imageMemoryBarrier.image = uploadInfo.image;
+                                imageMemoryBarrier.subresourceRange = imageSubresourceRange;
+                                imageMemoryBarrier.subresourceRange.baseMipLevel = mipLevel;
+                                imageMemoryBarrier.subresourceRange.levelCount = 1;
+                                imageMemoryBarrier.subresourceRange.baseArrayLayer = arrayLayer;
+                                imageMemoryBarrier.subresourceRange.layerCount = 1;
+                                imageMemoryBarriers.push_back(imageMemoryBarrier);
+                            }
+                        }
+                    }
+                    dispatchTable.gvkCmdPipelineBarrier(
+                        vkCommandBuffer,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT,
+                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                        0,
+                        0, nullptr,
+                        0, nullptr,
+                        (uint32_t)imageMemoryBarriers.size(),
+                        imageMemoryBarriers.data()
+                    );
+                }
+            };
+
+            // Stream each chunk through staging memory
+            gvk_result(stream_staging_chunks(mStagingChunkSize ? 0 : get_image_data_size(imageCreateInfo, imageSubresourceRange), false, chunks, recordChunk, processChunk));
         } gvk_result_scope_end;
         // TODO : Report errors
         assert(gvkResult == VK_SUCCESS);
@@ -1018,8 +1146,7 @@ void CopyEngine::upload(UploadAccelerationStructureInfo uploadInfo)
                     auto submitInfo = get_default<VkSubmitInfo>();
                     submitInfo.commandBufferCount = 1;
                     submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                    std::lock_guard<std::mutex> lock(mQueueMutex);
-                    gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                    gvk_result(queue_submit(submitInfo, taskResources.fence));
                 }
 
                 // Hold this thread's execution until transfer is complete
@@ -1087,8 +1214,7 @@ void CopyEngine::upload_ex(UploadAccelerationStructureInfo uploadInfo)
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
             // Hold this thread's execution until the transfer is complete
@@ -1113,8 +1239,7 @@ void CopyEngine::upload_ex(UploadAccelerationStructureInfo uploadInfo)
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
             // Hold this thread's execution until the transfer is complete
@@ -1198,8 +1323,7 @@ void CopyEngine::transition_image_layouts(TransitionImageLayoutInfo transitionIn
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
             // Hold this thread's execution until transfer is complete
@@ -1256,8 +1380,7 @@ void CopyEngine::build_acceleration_structure(BuildAcclerationStructureInfo buil
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
             // Hold this thread's execution until task is complete
@@ -1274,9 +1397,9 @@ void CopyEngine::build_acceleration_structure(BuildAcclerationStructureInfo buil
     }
 }
 
-VkResult CopyEngine::get_acceleration_structure_serialization_size(VkAccelerationStructureKHR accelerationStructure, VkDeviceSize* pSize)
+VkResult CopyEngine::get_acceleration_structure_memory_property_flags(VkAccelerationStructureKHR accelerationStructure, VkMemoryPropertyFlags* pMemoryPropertyFlags) const
 {
-    assert(pSize);
+    assert(pMemoryPropertyFlags);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         // TODO : Documentation
         GvkStateTrackedObject stateTrackedAccelerationStructure{ };
@@ -1324,32 +1447,69 @@ VkResult CopyEngine::get_acceleration_structure_serialization_size(VkAcceleratio
         gvkGetStateTrackedObjectAllocateInfo(&stateTrackedDeviceMemory, &memoryAllocateInfoType, (VkBaseOutStructure*)&memoryAllocateInfo);
         gvk_result(memoryAllocateInfoType == get_stype<VkMemoryAllocateInfo>() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
         gvk_result(memoryAllocateInfo.sType == get_stype<VkMemoryAllocateInfo>() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(memoryAllocateInfo.memoryTypeIndex < mPhysicalDeviceMemoryProperties.memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        *pMemoryPropertyFlags = mPhysicalDeviceMemoryProperties.memoryTypes[memoryAllocateInfo.memoryTypeIndex].propertyFlags;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
 
-        // TODO : Documentation
-        const auto& physicalDevice = mDevice.get<PhysicalDevice>();
-        VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties{ };
-        physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceMemoryProperties(physicalDevice, &physicalDeviceMemoryProperties);
+VkResult CopyEngine::get_acceleration_structure_serialization_size(VkAccelerationStructureKHR accelerationStructure, VkDeviceSize* pSize)
+{
+    return get_acceleration_structure_serialization_sizes(1, &accelerationStructure, pSize);
+}
 
-        // TODO : Documentation
-        const auto& dispatchTable = mDevice.get<DispatchTable>();
+VkResult CopyEngine::get_acceleration_structure_serialization_sizes(uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkDeviceSize* pSizes)
+{
+    assert(!accelerationStructureCount || pAccelerationStructures);
+    assert(!accelerationStructureCount || pSizes);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        // NOTE : Acceleration structures backed by device local memory are queried
+        //  on the device, the rest are queried on the host.  Each group is queried
+        //  with a single call so the device side only costs one submission.
+        std::vector<uint32_t> deviceIndices;
+        std::vector<VkAccelerationStructureKHR> deviceAccelerationStructures;
+        std::vector<uint32_t> hostIndices;
+        std::vector<VkAccelerationStructureKHR> hostAccelerationStructures;
+        for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
+            pSizes[i] = 0;
+            VkMemoryPropertyFlags memoryPropertyFlags = 0;
+            gvk_result(get_acceleration_structure_memory_property_flags(pAccelerationStructures[i], &memoryPropertyFlags));
+            if (memoryPropertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+                deviceIndices.push_back(i);
+                deviceAccelerationStructures.push_back(pAccelerationStructures[i]);
+            } else if (memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+                hostIndices.push_back(i);
+                hostAccelerationStructures.push_back(pAccelerationStructures[i]);
+            }
+        }
 
-        // TODO : Documentation
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
         auto queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR;
-        gvk_result(memoryAllocateInfo.memoryTypeIndex < physicalDeviceMemoryProperties.memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-        auto memoryTypePropertyFlags = physicalDeviceMemoryProperties.memoryTypes[memoryAllocateInfo.memoryTypeIndex].propertyFlags;
-        if (memoryTypePropertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+        std::vector<VkDeviceSize> sizes;
+        if (!deviceAccelerationStructures.empty()) {
             // Get TaskResources
             AccelerationStructureTaskResources taskResources{ };
             gvk_result(get_acceleration_structure_task_resources(0, &taskResources));
 
+            // NOTE : The TaskResources QueryPool only holds a single query, a QueryPool
+            //  sized for this call is created so every query is in one submission.
+            auto queryCount = (uint32_t)deviceAccelerationStructures.size();
+            QueryPool queryPool = taskResources.queryPool;
+            if (1 < queryCount) {
+                auto queryPoolCreateInfo = get_default<VkQueryPoolCreateInfo>();
+                queryPoolCreateInfo.queryType = queryType;
+                queryPoolCreateInfo.queryCount = queryCount;
+                gvk_result(QueryPool::create(mDevice, &queryPoolCreateInfo, nullptr, &queryPool));
+            }
+
             // Begin CommandBuffer
             auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
             commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
             gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources.vkCommandBuffer, &commandBufferBeginInfo));
 
-            // TODO : Documentation
-            dispatchTable.gvkCmdResetQueryPool(taskResources.vkCommandBuffer, taskResources.queryPool, 0, 1);
-            dispatchTable.gvkCmdWriteAccelerationStructuresPropertiesKHR(taskResources.vkCommandBuffer, 1, &accelerationStructure, queryType, taskResources.queryPool, 0);
+            // Reset and write queries
+            dispatchTable.gvkCmdResetQueryPool(taskResources.vkCommandBuffer, queryPool, 0, queryCount);
+            dispatchTable.gvkCmdWriteAccelerationStructuresPropertiesKHR(taskResources.vkCommandBuffer, queryCount, deviceAccelerationStructures.data(), queryType, queryPool, 0);
 
             // End CommandBuffer
             gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources.vkCommandBuffer));
@@ -1359,28 +1519,63 @@ VkResult CopyEngine::get_acceleration_structure_serialization_size(VkAcceleratio
                 auto submitInfo = get_default<VkSubmitInfo>();
                 submitInfo.commandBufferCount = 1;
                 submitInfo.pCommandBuffers = &taskResources.vkCommandBuffer;
-                std::lock_guard<std::mutex> lock(mQueueMutex);
-                gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, taskResources.fence));
+                gvk_result(queue_submit(submitInfo, taskResources.fence));
             }
 
-            // Hold this thread's execution until the query is complete
+            // Hold this thread's execution until the queries are complete
             gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources.fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
             gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources.fence.get<VkFence>()));
 
-            // TODO : Documentation
+            // Read query results
+            sizes.resize(queryCount);
             auto queryResultFlags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT;
-            gvk_result(dispatchTable.gvkGetQueryPoolResults(mDevice, taskResources.queryPool, 0, 1, sizeof(*pSize), pSize, sizeof(*pSize), queryResultFlags));
-        } else if (memoryTypePropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
-            gvk_result(dispatchTable.gvkWriteAccelerationStructuresPropertiesKHR(mDevice, 1, &accelerationStructure, queryType, sizeof(*pSize), &pSize, sizeof(*pSize)));
+            gvk_result(dispatchTable.gvkGetQueryPoolResults(mDevice, queryPool, 0, queryCount, sizes.size() * sizeof(VkDeviceSize), sizes.data(), sizeof(VkDeviceSize), queryResultFlags));
+            for (size_t i = 0; i < deviceIndices.size(); ++i) {
+                pSizes[deviceIndices[i]] = sizes[i];
+            }
+        }
+        if (!hostAccelerationStructures.empty()) {
+            sizes.resize(hostAccelerationStructures.size());
+            gvk_result(dispatchTable.gvkWriteAccelerationStructuresPropertiesKHR(mDevice, (uint32_t)hostAccelerationStructures.size(), hostAccelerationStructures.data(), queryType, sizes.size() * sizeof(VkDeviceSize), sizes.data(), sizeof(VkDeviceSize)));
+            for (size_t i = 0; i < hostIndices.size(); ++i) {
+                pSizes[hostIndices[i]] = sizes[i];
+            }
         }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
+VkResult CopyEngine::queue_submit(const VkSubmitInfo& submitInfo, VkFence fence)
+{
+    assert(mDevice);
+    assert(!mQueues.empty());
+    assert(mQueues.size() == mQueueMutexes.size());
+
+    // NOTE : Threads are assigned VkQueues round robin the first time they submit
+    //  and keep submitting to the same VkQueue.  This keeps work from any given
+    //  thread in submission order while spreading threads across VkQueues...each
+    //  VkQueue has its own lock so threads only contend with threads that share
+    //  their VkQueue.
+    std::unique_lock<std::mutex> lock(mTaskResourcesMutex);
+    auto threadQueueIndexItr = mThreadQueueIndices.find(std::this_thread::get_id());
+    if (threadQueueIndexItr == mThreadQueueIndices.end()) {
+        auto queueIndex = (uint32_t)(mThreadQueueIndices.size() % mQueues.size());
+        threadQueueIndexItr = mThreadQueueIndices.insert({ std::this_thread::get_id(), queueIndex }).first;
+    }
+    auto queueIndex = threadQueueIndexItr->second;
+    lock.unlock();
+    std::lock_guard<std::mutex> queueLock(mQueueMutexes[queueIndex]);
+    return mDevice.get<DispatchTable>().gvkQueueSubmit(mQueues[queueIndex], 1, &submitInfo, fence);
+}
+
 VkResult CopyEngine::get_task_resources(VkDeviceSize taskSize, TaskResources* pTaskResources)
+{
+    return get_task_resources(taskSize, 0, pTaskResources);
+}
+
+VkResult CopyEngine::get_task_resources(VkDeviceSize taskSize, uint32_t inFlightIndex, TaskResources* pTaskResources)
 {
     assert(mDevice);
-    assert(taskSize);
     assert(pTaskResources);
     std::unique_lock<std::mutex> lock(mTaskResourcesMutex);
     auto taskResourcesItr = mTaskResources.find(std::this_thread::get_id());
@@ -1391,57 +1586,31 @@ VkResult CopyEngine::get_task_resources(VkDeviceSize taskSize, TaskResources* pT
         }
     }
     lock.unlock();
+    if (taskResourcesItr->second.size() <= inFlightIndex) {
+        taskResourcesItr->second.resize(inFlightIndex + 1);
+    }
+    auto& taskResources = taskResourcesItr->second[inFlightIndex];
     gvk_result_scope_begin(VK_SUCCESS) {
-        // HACK : Getting both the application and layer dispatch tables
+        // HACK : Getting the layer dispatch table
         const auto& layerDeviceDispatchTableItr = layer::Registry::get().VkDeviceDispatchTables.find(layer::get_dispatch_key(mDevice.get<VkDevice>()));
         assert(layerDeviceDispatchTableItr != layer::Registry::get().VkDeviceDispatchTables.end() && "Failed to get gvk::layer::Registry VkDevice gvk::DispatchTable; are the Vulkan SDK, runtime, and layers configured correctly?");
         const auto& layerDeviceDispatchTable = layerDeviceDispatchTableItr->second;
-        const auto& layerInstanceDispatchTableItr = layer::Registry::get().VkInstanceDispatchTables.find(layer::get_dispatch_key(mDevice.get<PhysicalDevice>().get<VkInstance>()));
-        assert(layerInstanceDispatchTableItr != layer::Registry::get().VkInstanceDispatchTables.end() && "Failed to get gvk::layer::Registry VkInstance gvk::DispatchTable; are the Vulkan SDK, runtime, and layers configured correctly?");
-        const auto& layerInstanceDispatchTable = layerInstanceDispatchTableItr->second;
-
-        if (!taskResourcesItr->second.buffer || taskResourcesItr->second.buffer.get<VkBufferCreateInfo>().size < taskSize) {
-            auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
-            bufferCreateInfo.size = taskSize;
-            bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-            gvk_result(Buffer::create(mDevice, &bufferCreateInfo, (VkAllocationCallbacks*)nullptr, &taskResourcesItr->second.buffer));
-
-            // HACK : TODO : Documentation
-            VkBuffer proxyBuffer = VK_NULL_HANDLE;
-            gvk_result(layerDeviceDispatchTable.gvkCreateBuffer(mDevice, &bufferCreateInfo, nullptr, &proxyBuffer));
-            VkMemoryRequirements memoryRequirements{ };
-            layerDeviceDispatchTable.gvkGetBufferMemoryRequirements(mDevice, proxyBuffer, &memoryRequirements);
-            VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties{ };
-            VkPhysicalDevice stateTrackerPhysicalDevice = VK_NULL_HANDLE;
-            gvkGetStateTrackerPhysicalDevice(mDevice.get<PhysicalDevice>().get<VkInstance>(), mDevice.get<PhysicalDevice>(), &stateTrackerPhysicalDevice);
-            auto physicalDevice = stateTrackerPhysicalDevice ? stateTrackerPhysicalDevice : mDevice.get<PhysicalDevice>().get<VkPhysicalDevice>();
-            layerInstanceDispatchTable.gvkGetPhysicalDeviceMemoryProperties(physicalDevice, &physicalDeviceMemoryProperties);
-            layerDeviceDispatchTable.gvkDestroyBuffer(mDevice, proxyBuffer, nullptr);
 
-            // TODO : Documentation
-            auto memoryAllocateInfo = get_default<VkMemoryAllocateInfo>();
-            memoryAllocateInfo.allocationSize = memoryRequirements.size;
-            uint32_t memoryTypeCount = 0;
-            auto memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-            get_compatible_memory_type_indices(&physicalDeviceMemoryProperties, memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
-            gvk_result(memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-            memoryTypeCount = 1;
-            get_compatible_memory_type_indices(&physicalDeviceMemoryProperties, memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, &memoryAllocateInfo.memoryTypeIndex);
-            gvk_result(DeviceMemory::allocate(mDevice, &memoryAllocateInfo, nullptr, &taskResourcesItr->second.memory));
-            gvk_result(mDevice.get<DispatchTable>().gvkBindBufferMemory(mDevice, taskResourcesItr->second.buffer, taskResourcesItr->second.memory, 0));
+        if (taskSize && (!taskResources.buffer || taskResources.buffer.get<VkBufferCreateInfo>().size < taskSize)) {
+            gvk_result(create_staging_resources(taskSize, &taskResources.buffer, &taskResources.memory));
         }
-        if (!taskResourcesItr->second.fence) {
-            gvk_result(Fence::create(mDevice, &get_default<VkFenceCreateInfo>(), nullptr, &taskResourcesItr->second.fence));
+        if (!taskResources.fence) {
+            gvk_result(Fence::create(mDevice, &get_default<VkFenceCreateInfo>(), nullptr, &taskResources.fence));
         }
-        if (!taskResourcesItr->second.vkCommandBuffer) {
+        if (!taskResources.vkCommandBuffer) {
             auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
             commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
             commandPoolCreateInfo.queueFamilyIndex = mQueue.get<VkDeviceQueueCreateInfo>().queueFamilyIndex;
-            gvk_result(CommandPool::create(mDevice, &commandPoolCreateInfo, nullptr, &taskResourcesItr->second.commandPool));
+            gvk_result(CommandPool::create(mDevice, &commandPoolCreateInfo, nullptr, &taskResources.commandPool));
             auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
-            commandBufferAllocateInfo.commandPool = taskResourcesItr->second.commandPool;
+            commandBufferAllocateInfo.commandPool = taskResources.commandPool;
             commandBufferAllocateInfo.commandBufferCount = 1;
-            gvk_result(mDevice.get<DispatchTable>().gvkAllocateCommandBuffers(mDevice, &commandBufferAllocateInfo, &taskResourcesItr->second.vkCommandBuffer));
+            gvk_result(mDevice.get<DispatchTable>().gvkAllocateCommandBuffers(mDevice, &commandBufferAllocateInfo, &taskResources.vkCommandBuffer));
 
             // HACK : If the dispatch table is live (ie. not synthetic) the vkCommandBuffer
             //  needs to have its dispatch table set to the VkDevice dispatch table.
@@ -1452,14 +1621,526 @@ VkResult CopyEngine::get_task_resources(VkDeviceSize taskSize, TaskResources* pT
             DispatchTable::load_device_entry_points(mDevice, &applicationDispatchTable);
             if (mDevice.get<DispatchTable>().gvkAllocateCommandBuffers == applicationDispatchTable.gvkAllocateCommandBuffers ||
                 mDevice.get<DispatchTable>().gvkAllocateCommandBuffers == layerDeviceDispatchTable.gvkAllocateCommandBuffers) {
-                *(void**)taskResourcesItr->second.vkCommandBuffer = *(void**)mDevice.get<VkDevice>();
+                *(void**)taskResources.vkCommandBuffer = *(void**)mDevice.get<VkDevice>();
             }
         }
-        *pTaskResources = taskResourcesItr->second;
+        *pTaskResources = taskResources;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult CopyEngine::create_staging_resources(VkDeviceSize size, Buffer* pBuffer, DeviceMemory* pMemory)
+{
+    assert(mDevice);
+    assert(size);
+    assert(pBuffer);
+    assert(pMemory);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // HACK : Getting both the application and layer dispatch tables
+        const auto& layerDeviceDispatchTableItr = layer::Registry::get().VkDeviceDispatchTables.find(layer::get_dispatch_key(mDevice.get<VkDevice>()));
+        assert(layerDeviceDispatchTableItr != layer::Registry::get().VkDeviceDispatchTables.end() && "Failed to get gvk::layer::Registry VkDevice gvk::DispatchTable; are the Vulkan SDK, runtime, and layers configured correctly?");
+        const auto& layerDeviceDispatchTable = layerDeviceDispatchTableItr->second;
+        const auto& layerInstanceDispatchTableItr = layer::Registry::get().VkInstanceDispatchTables.find(layer::get_dispatch_key(mDevice.get<PhysicalDevice>().get<VkInstance>()));
+        assert(layerInstanceDispatchTableItr != layer::Registry::get().VkInstanceDispatchTables.end() && "Failed to get gvk::layer::Registry VkInstance gvk::DispatchTable; are the Vulkan SDK, runtime, and layers configured correctly?");
+        const auto& layerInstanceDispatchTable = layerInstanceDispatchTableItr->second;
+
+        auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+        bufferCreateInfo.size = size;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        gvk_result(Buffer::create(mDevice, &bufferCreateInfo, (VkAllocationCallbacks*)nullptr, pBuffer));
+
+        // HACK : TODO : Documentation
+        VkBuffer proxyBuffer = VK_NULL_HANDLE;
+        gvk_result(layerDeviceDispatchTable.gvkCreateBuffer(mDevice, &bufferCreateInfo, nullptr, &proxyBuffer));
+        VkMemoryRequirements memoryRequirements{ };
+        layerDeviceDispatchTable.gvkGetBufferMemoryRequirements(mDevice, proxyBuffer, &memoryRequirements);
+        VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties{ };
+        VkPhysicalDevice stateTrackerPhysicalDevice = VK_NULL_HANDLE;
+        gvkGetStateTrackerPhysicalDevice(mDevice.get<PhysicalDevice>().get<VkInstance>(), mDevice.get<PhysicalDevice>(), &stateTrackerPhysicalDevice);
+        auto physicalDevice = stateTrackerPhysicalDevice ? stateTrackerPhysicalDevice : mDevice.get<PhysicalDevice>().get<VkPhysicalDevice>();
+        layerInstanceDispatchTable.gvkGetPhysicalDeviceMemoryProperties(physicalDevice, &physicalDeviceMemoryProperties);
+        layerDeviceDispatchTable.gvkDestroyBuffer(mDevice, proxyBuffer, nullptr);
+
+        // TODO : Documentation
+        auto memoryAllocateInfo = get_default<VkMemoryAllocateInfo>();
+        memoryAllocateInfo.allocationSize = memoryRequirements.size;
+        uint32_t memoryTypeCount = 0;
+        auto memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        get_compatible_memory_type_indices(&physicalDeviceMemoryProperties, memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
+        gvk_result(memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        memoryTypeCount = 1;
+        get_compatible_memory_type_indices(&physicalDeviceMemoryProperties, memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, &memoryAllocateInfo.memoryTypeIndex);
+        gvk_result(DeviceMemory::allocate(mDevice, &memoryAllocateInfo, nullptr, pMemory));
+        gvk_result(mDevice.get<DispatchTable>().gvkBindBufferMemory(mDevice, *pBuffer, *pMemory, 0));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+CopyEngine::StagingResources::StagingResources(StagingResources&& other)
+{
+    *this = std::move(other);
+}
+
+CopyEngine::StagingResources& CopyEngine::StagingResources::operator=(StagingResources&& other)
+{
+    if (this != &other) {
+        if (mpCopyEngine) {
+            mpCopyEngine->release_staging_resources(this);
+        }
+        buffer = std::move(other.buffer);
+        memory = std::move(other.memory);
+        mpCopyEngine = other.mpCopyEngine;
+        mSlot = other.mSlot;
+        other.mpCopyEngine = nullptr;
+    }
+    return *this;
+}
+
+CopyEngine::StagingResources::~StagingResources()
+{
+    if (mpCopyEngine) {
+        mpCopyEngine->release_staging_resources(this);
+    }
+}
+
+VkResult CopyEngine::acquire_staging_resources(const TaskResources& taskResources, VkDeviceSize size, bool wait, StagingResources* pStagingResources)
+{
+    assert(size);
+    assert(pStagingResources);
+    assert(!pStagingResources->mpCopyEngine);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        if (!mStagingChunkSize) {
+            // Without a staging budget every task streams through its thread's
+            //  TaskResources, which are sized to the largest task seen so far
+            pStagingResources->buffer = taskResources.buffer;
+            pStagingResources->memory = taskResources.memory;
+        } else if (mStagingChunkSize < size) {
+            // Chunks that can't be split (ie. a single row of a very large image)
+            //  get dedicated staging resources that are released with the chunk
+            gvk_result(create_staging_resources(size, &pStagingResources->buffer, &pStagingResources->memory));
+        } else {
+            // Wait for a staging slot to become available, staging slots are created
+            //  the first time they're acquired.  If the caller can't wait, return
+            //  VK_NOT_READY when no staging slots are available.
+            std::unique_lock<std::mutex> lock(mStagingMutex);
+            if (!wait && mAvailableStagingSlots.empty()) {
+                gvk_result_scope_break(VK_NOT_READY);
+            }
+            mStagingCondition.wait(lock, [&]() { return !mAvailableStagingSlots.empty(); });
+            pStagingResources->mpCopyEngine = this;
+            pStagingResources->mSlot = mAvailableStagingSlots.back();
+            mAvailableStagingSlots.pop_back();
+            lock.unlock();
+            auto& stagingSlot = mStagingSlots[pStagingResources->mSlot];
+            if (!stagingSlot.buffer) {
+                gvk_result(create_staging_resources(mStagingChunkSize, &stagingSlot.buffer, &stagingSlot.memory));
+            }
+            pStagingResources->buffer = stagingSlot.buffer;
+            pStagingResources->memory = stagingSlot.memory;
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void CopyEngine::release_staging_resources(StagingResources* pStagingResources)
+{
+    assert(pStagingResources);
+    assert(pStagingResources->mpCopyEngine == this);
+    pStagingResources->buffer.reset();
+    pStagingResources->memory.reset();
+    pStagingResources->mpCopyEngine = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mStagingMutex);
+        mAvailableStagingSlots.push_back(pStagingResources->mSlot);
+    }
+    mStagingCondition.notify_one();
+}
+
+template <typename CopyType, typename RecordChunkFunctionType, typename ProcessChunkFunctionType>
+VkResult CopyEngine::stream_staging_chunks(VkDeviceSize taskSize, bool download, const std::vector<StagingChunk<CopyType>>& chunks, RecordChunkFunctionType recordChunk, ProcessChunkFunctionType processChunk)
+{
+    // NOTE : Each chunk is assigned one of this thread's in flight slots in round
+    //  robin order.  Before a slot is reused, the chunk previously submitted from
+    //  it is retired; for downloads this is when its data is processed.  So while
+    //  one chunk's data is being processed, the chunks submitted after it are
+    //  executing.  Chunks are always retired in submission order, so callbacks
+    //  fire in the same order they would without pipelining.
+    assert(mDevice);
+    assert(!chunks.empty());
+    assert(mStagingChunkSize || mInFlightTransferCount <= 1);
+    const auto& dispatchTable = mDevice.get<DispatchTable>();
+    auto inFlightCount = (uint32_t)std::min((size_t)std::max(mInFlightTransferCount, 1u), chunks.size());
+    std::vector<TaskResources> taskResources(inFlightCount);
+    std::vector<StagingResources> stagingResources(inFlightCount);
+    std::vector<size_t> inFlightChunks(inFlightCount, chunks.size());
+    uint32_t inFlightChunkCount = 0;
+
+    // Map data, fire callback, unmap data
+    auto process = [&](uint32_t slot, size_t chunk_i)
+    {
+        gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+            uint8_t* pData = nullptr;
+            gvk_result(dispatchTable.gvkMapMemory(mDevice, stagingResources[slot].memory, 0, VK_WHOLE_SIZE, 0, (void**)&pData));
+            auto bindBufferMemoryInfo = get_default<VkBindBufferMemoryInfo>();
+            bindBufferMemoryInfo.buffer = stagingResources[slot].buffer;
+            bindBufferMemoryInfo.memory = stagingResources[slot].memory;
+            processChunk(chunk_i, bindBufferMemoryInfo, pData);
+            dispatchTable.gvkUnmapMemory(mDevice, stagingResources[slot].memory);
+        } gvk_result_scope_end;
+        return gvkResult;
+    };
+
+    // Hold this thread's execution until the chunk in flight in the given slot is
+    //  complete, then process its data (for downloads) and release its staging
+    //  resources
+    auto retire = [&](uint32_t slot)
+    {
+        gvk_result_scope_begin(VK_SUCCESS) {
+            auto chunk_i = inFlightChunks[slot];
+            if (chunk_i < chunks.size()) {
+                gvk_result(dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources[slot].fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
+                gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &taskResources[slot].fence.get<VkFence>()));
+                inFlightChunks[slot] = chunks.size();
+                --inFlightChunkCount;
+                if (download && chunks[chunk_i].dataSize) {
+                    gvk_result(process(slot, chunk_i));
+                }
+                stagingResources[slot] = StagingResources();
+            }
+        } gvk_result_scope_end;
+        return gvkResult;
+    };
+
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // Get TaskResources for each slot, only the first slot's TaskResources are
+        //  used for staging when there's no staging budget
+        for (uint32_t slot = 0; slot < inFlightCount; ++slot) {
+            gvk_result(get_task_resources(slot ? 0 : taskSize, slot, &taskResources[slot]));
+        }
+
+        for (size_t chunk_i = 0; chunk_i < chunks.size(); ++chunk_i) {
+            // Retire the chunk previously submitted from this chunk's slot
+            auto slot = (uint32_t)(chunk_i % inFlightCount);
+            gvk_result(retire(slot));
+
+            // Acquire staging resources...this thread only blocks waiting for staging
+            //  resources when it isn't holding any, otherwise its in flight chunks are
+            //  retired (oldest first) until staging resources are available.  This
+            //  keeps threads from deadlocking on each other's staging slots.
+            const auto& chunk = chunks[chunk_i];
+            if (chunk.dataSize) {
+                auto acquireResult = VK_NOT_READY;
+                for (auto retire_i = chunk_i + 1; acquireResult == VK_NOT_READY; ++retire_i) {
+                    acquireResult = acquire_staging_resources(taskResources[slot], chunk.dataSize, !inFlightChunkCount, &stagingResources[slot]);
+                    if (acquireResult == VK_NOT_READY) {
+                        gvk_result(retire((uint32_t)(retire_i % inFlightCount)));
+                    }
+                }
+                gvk_result(acquireResult);
+                if (!download) {
+                    gvk_result(process(slot, chunk_i));
+                }
+            }
+
+            // Begin CommandBuffer
+            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            gvk_result(dispatchTable.gvkBeginCommandBuffer(taskResources[slot].vkCommandBuffer, &commandBufferBeginInfo));
+
+            // Record
+            recordChunk(chunk_i, taskResources[slot].vkCommandBuffer, stagingResources[slot].buffer);
+
+            // End CommandBuffer
+            gvk_result(dispatchTable.gvkEndCommandBuffer(taskResources[slot].vkCommandBuffer));
+
+            // Submit CommandBuffer
+            {
+                auto submitInfo = get_default<VkSubmitInfo>();
+                submitInfo.commandBufferCount = 1;
+                submitInfo.pCommandBuffers = &taskResources[slot].vkCommandBuffer;
+                gvk_result(queue_submit(submitInfo, taskResources[slot].fence));
+            }
+            inFlightChunks[slot] = chunk_i;
+            ++inFlightChunkCount;
+        }
+
+        // Retire remaining chunks, oldest first
+        for (size_t chunk_i = chunks.size(); chunk_i < chunks.size() + inFlightCount; ++chunk_i) {
+            gvk_result(retire((uint32_t)(chunk_i % inFlightCount)));
+        }
+    } gvk_result_scope_end;
+
+    // If streaming failed, chunks may still be in flight...hold this thread's
+    //  execution until they're complete so their staging resources can be safely
+    //  released and their fences reused
+    for (uint32_t slot = 0; slot < inFlightCount; ++slot) {
+        if (inFlightChunks[slot] < chunks.size()) {
+            dispatchTable.gvkWaitForFences(mDevice, 1, &taskResources[slot].fence.get<VkFence>(), VK_TRUE, UINT64_MAX);
+            dispatchTable.gvkResetFences(mDevice, 1, &taskResources[slot].fence.get<VkFence>());
+        }
+    }
+    return gvkResult;
+}
+
+VkResult CopyEngine::map_host_visible_memory(VkDeviceMemory memory, const VkMemoryAllocateInfo& memoryAllocateInfo, const GvkMappedMemoryInfo& mappedMemoryInfo, bool download, const std::vector<VkBufferCopy>& regions, HostMapping* pHostMapping)
+{
+    // NOTE : If memory isn't host visible (or can't be mapped) pHostMapping->pData
+    //  is left null and the caller falls back to copying through staging memory.
+    //  If memory is already mapped (ie. by the application) its mapping is used
+    //  when it covers every region.  Non coherent memory that's already mapped is
+    //  left alone so its invalidates/flushes stay under the application's control.
+    assert(mDevice);
+    assert(memory);
+    assert(pHostMapping);
+    *pHostMapping = { };
+    auto memoryTypeIndex = memoryAllocateInfo.memoryTypeIndex;
+    if (regions.empty() || mPhysicalDeviceMemoryProperties.memoryTypeCount <= memoryTypeIndex) {
+        return VK_SUCCESS;
+    }
+    auto memoryPropertyFlags = mPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+    if (!(memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+        return VK_SUCCESS;
+    }
+
+    // NOTE : Host reads from uncached device local memory (ie. resizable BAR) are
+    //  much slower than copying on the device, so those are still downloaded
+    //  through staging memory.  Writes to that memory are fine to map.
+    auto hostCached = (memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0;
+    if (download && !hostCached && memoryPropertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+        return VK_SUCCESS;
+    }
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pHostMapping->coherent = (memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        if (mappedMemoryInfo.dataHandle) {
+            auto mappedEnd = mappedMemoryInfo.size == VK_WHOLE_SIZE ? memoryAllocateInfo.allocationSize : mappedMemoryInfo.offset + mappedMemoryInfo.size;
+            auto mappingCoversRegions = pHostMapping->coherent;
+            for (const auto& region : regions) {
+                mappingCoversRegions &= mappedMemoryInfo.offset <= region.srcOffset && region.srcOffset + region.size <= mappedEnd;
+            }
+            if (mappingCoversRegions) {
+                pHostMapping->pData = (uint8_t*)(uintptr_t)mappedMemoryInfo.dataHandle;
+                pHostMapping->offset = mappedMemoryInfo.offset;
+            }
+        } else if (dispatchTable.gvkMapMemory(mDevice, memory, 0, VK_WHOLE_SIZE, 0, (void**)&pHostMapping->pData) == VK_SUCCESS) {
+            pHostMapping->unmap = true;
+            if (download && !pHostMapping->coherent) {
+                auto mappedMemoryRange = get_default<VkMappedMemoryRange>();
+                mappedMemoryRange.memory = memory;
+                mappedMemoryRange.size = VK_WHOLE_SIZE;
+                gvk_result(dispatchTable.gvkInvalidateMappedMemoryRanges(mDevice, 1, &mappedMemoryRange));
+            }
+        } else {
+            pHostMapping->pData = nullptr;
+        }
     } gvk_result_scope_end;
+    if (gvkResult != VK_SUCCESS) {
+        unmap_host_visible_memory(memory, download, *pHostMapping);
+        *pHostMapping = { };
+    }
     return gvkResult;
 }
 
+void CopyEngine::unmap_host_visible_memory(VkDeviceMemory memory, bool download, const HostMapping& hostMapping)
+{
+    assert(mDevice);
+    assert(memory);
+    if (hostMapping.unmap) {
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        if (!download && !hostMapping.coherent) {
+            auto mappedMemoryRange = get_default<VkMappedMemoryRange>();
+            mappedMemoryRange.memory = memory;
+            mappedMemoryRange.size = VK_WHOLE_SIZE;
+            auto vkResult = dispatchTable.gvkFlushMappedMemoryRanges(mDevice, 1, &mappedMemoryRange);
+            (void)vkResult;
+            assert(vkResult == VK_SUCCESS);
+        }
+        dispatchTable.gvkUnmapMemory(mDevice, memory);
+    }
+}
+
+std::vector<CopyEngine::StagingChunk<VkBufferCopy>> CopyEngine::get_staging_chunks(const std::vector<VkBufferCopy>& regions) const
+{
+    // NOTE : Each region's srcOffset is the offset into the resource and its
+    //  dstOffset is the offset into the packed resource data.  Regions are split
+    //  into copies that fit in a single staging chunk, each copy's srcOffset is
+    //  the offset into the resource and its dstOffset is the offset into the
+    //  staging chunk.
+    std::vector<StagingChunk<VkBufferCopy>> chunks(1);
+    if (!regions.empty()) {
+        chunks.back().dataOffset = regions.front().dstOffset;
+    }
+    for (const auto& region : regions) {
+        VkDeviceSize regionOffset = 0;
+        while (regionOffset < region.size) {
+            if (mStagingChunkSize && chunks.back().dataSize == mStagingChunkSize) {
+                StagingChunk<VkBufferCopy> chunk{ };
+                chunk.dataOffset = chunks.back().dataOffset + chunks.back().dataSize;
+                chunks.push_back(std::move(chunk));
+            }
+            auto& chunk = chunks.back();
+            auto copySize = region.size - regionOffset;
+            if (mStagingChunkSize) {
+                copySize = std::min(copySize, mStagingChunkSize - chunk.dataSize);
+            }
+            auto bufferCopy = get_default<VkBufferCopy>();
+            bufferCopy.srcOffset = region.srcOffset + regionOffset;
+            bufferCopy.dstOffset = chunk.dataSize;
+            bufferCopy.size = copySize;
+            chunk.copies.push_back(bufferCopy);
+            chunk.dataSize += copySize;
+            regionOffset += copySize;
+        }
+    }
+    return chunks;
+}
+
+std::vector<CopyEngine::StagingChunk<VkBufferImageCopy>> CopyEngine::get_staging_chunks(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, const std::vector<VkImageLayout>& imageLayouts) const
+{
+    // NOTE : Subresources are packed in the same order they're written to and
+    //  read from resource data, each chunk covers a contiguous range of that data.
+    //  Subresources that don't fit in a single chunk are split by depth slice and
+    //  then by rows of texels (or blocks for compressed formats).  When streaming
+    //  through a staging budget, subresources without a layout end the current
+    //  chunk so that their data isn't transferred.
+    GvkFormatInfo formatInfo{ };
+    get_format_info(imageCreateInfo.format, &formatInfo);
+    auto imageAspectFlags = get_image_aspect_flags(imageCreateInfo.format);
+    auto splittable = !(imageAspectFlags & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT));
+    VkExtent3D blockExtent { 1, 1, 1 };
+    VkDeviceSize blockSize = get_bytes_per_texel(imageCreateInfo.format);
+    if (formatInfo.compressionType) {
+        blockExtent = { formatInfo.blockExtent[0], formatInfo.blockExtent[1], formatInfo.blockExtent[2] };
+        blockSize = formatInfo.blockSize;
+    }
+
+    std::vector<StagingChunk<VkBufferImageCopy>> chunks(1);
+    auto startChunk = [&](VkDeviceSize dataOffset)
+    {
+        if (chunks.back().dataSize) {
+            chunks.emplace_back();
+        }
+        chunks.back().dataOffset = dataOffset;
+    };
+    VkDeviceSize bufferOffset = 0;
+    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+            auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
+            auto arrayLayerSubresourceRange = imageSubresourceRange;
+            arrayLayerSubresourceRange.baseMipLevel = mipLevel;
+            arrayLayerSubresourceRange.levelCount = 1;
+            arrayLayerSubresourceRange.baseArrayLayer = arrayLayer;
+            arrayLayerSubresourceRange.layerCount = 1;
+            VkDeviceSize subresourceSize = get_image_data_size(imageCreateInfo, arrayLayerSubresourceRange);
+            if (!mStagingChunkSize) {
+                if (imageLayouts[subresource]) {
+                    auto bufferImageCopy = get_default<VkBufferImageCopy>();
+                    bufferImageCopy.bufferOffset = bufferOffset;
+                    bufferImageCopy.imageSubresource.aspectMask = imageAspectFlags & ~VK_IMAGE_ASPECT_STENCIL_BIT;
+                    bufferImageCopy.imageSubresource.mipLevel = mipLevel;
+                    bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
+                    bufferImageCopy.imageSubresource.layerCount = 1;
+                    bufferImageCopy.imageExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
+                    chunks.back().copies.push_back(bufferImageCopy);
+                }
+                chunks.back().dataSize += subresourceSize;
+            } else if (!imageLayouts[subresource]) {
+                startChunk(bufferOffset + subresourceSize);
+            } else {
+                auto mipLevelExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
+                auto rowSize = (mipLevelExtent.width / blockExtent.width) * blockSize;
+                auto rowCount = mipLevelExtent.height / blockExtent.height;
+                auto sliceCount = mipLevelExtent.depth / blockExtent.depth;
+                auto split =
+                    splittable &&
+                    mStagingChunkSize < subresourceSize &&
+                    rowSize && rowSize <= mStagingChunkSize &&
+                    !(mipLevelExtent.width % blockExtent.width) &&
+                    !(mipLevelExtent.height % blockExtent.height) &&
+                    !(mipLevelExtent.depth % blockExtent.depth) &&
+                    rowSize * rowCount * sliceCount == subresourceSize;
+                if (!split) {
+                    if (mStagingChunkSize < chunks.back().dataSize + subresourceSize) {
+                        startChunk(bufferOffset);
+                    }
+                    auto bufferImageCopy = get_default<VkBufferImageCopy>();
+                    bufferImageCopy.bufferOffset = bufferOffset - chunks.back().dataOffset;
+                    bufferImageCopy.imageSubresource.aspectMask = imageAspectFlags & ~VK_IMAGE_ASPECT_STENCIL_BIT;
+                    bufferImageCopy.imageSubresource.mipLevel = mipLevel;
+                    bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
+                    bufferImageCopy.imageSubresource.layerCount = 1;
+                    bufferImageCopy.imageExtent = mipLevelExtent;
+                    chunks.back().copies.push_back(bufferImageCopy);
+                    chunks.back().dataSize += subresourceSize;
+                } else {
+                    auto rowOffset = bufferOffset;
+                    for (uint32_t slice = 0; slice < sliceCount; ++slice) {
+                        uint32_t row = 0;
+                        while (row < rowCount) {
+                            if (mStagingChunkSize < chunks.back().dataSize + rowSize) {
+                                startChunk(rowOffset);
+                            }
+                            auto rows = (uint32_t)std::min((VkDeviceSize)(rowCount - row), (mStagingChunkSize - chunks.back().dataSize) / rowSize);
+                            auto bufferImageCopy = get_default<VkBufferImageCopy>();
+                            bufferImageCopy.bufferOffset = rowOffset - chunks.back().dataOffset;
+                            bufferImageCopy.imageSubresource.aspectMask = imageAspectFlags & ~VK_IMAGE_ASPECT_STENCIL_BIT;
+                            bufferImageCopy.imageSubresource.mipLevel = mipLevel;
+                            bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
+                            bufferImageCopy.imageSubresource.layerCount = 1;
+                            bufferImageCopy.imageOffset = { 0, (int32_t)(row * blockExtent.height), (int32_t)(slice * blockExtent.depth) };
+                            bufferImageCopy.imageExtent = { mipLevelExtent.width, rows * blockExtent.height, blockExtent.depth };
+                            chunks.back().copies.push_back(bufferImageCopy);
+                            chunks.back().dataSize += rows * rowSize;
+                            rowOffset += rows * rowSize;
+                            row += rows;
+                        }
+                    }
+                }
+            }
+            bufferOffset += subresourceSize;
+        }
+    }
+    if (1 < chunks.size() && !chunks.back().dataSize) {
+        chunks.pop_back();
+    }
+    return chunks;
+}
+
+bool CopyEngine::get_host_image_copy_enabled(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, const std::vector<VkImageLayout>& srcImageLayouts, const std::vector<VkImageLayout>& dstImageLayouts) const
+{
+    // NOTE : When dstImageLayouts is empty the VkImage is being downloaded and
+    //  every subresource with a layout must be in a supported source layout.
+    //  Otherwise the VkImage is being uploaded, every subresource with a new
+    //  layout must be in a supported destination layout and must be transitioned
+    //  from either an undefined layout or a supported source layout.
+    if (!mHostImageCopyEnabled || !(imageCreateInfo.usage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) || imageCreateInfo.samples != VK_SAMPLE_COUNT_1_BIT) {
+        return false;
+    }
+    auto supported = [](const std::vector<VkImageLayout>& imageLayouts, VkImageLayout imageLayout)
+    {
+        return std::find(imageLayouts.begin(), imageLayouts.end(), imageLayout) != imageLayouts.end();
+    };
+    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+            auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
+            auto srcImageLayout = srcImageLayouts[subresource];
+            if (dstImageLayouts.empty()) {
+                if (srcImageLayout && !supported(mHostImageCopySrcLayouts, srcImageLayout)) {
+                    return false;
+                }
+            } else if (dstImageLayouts[subresource]) {
+                if (srcImageLayout != VK_IMAGE_LAYOUT_UNDEFINED && srcImageLayout != VK_IMAGE_LAYOUT_PREINITIALIZED && !supported(mHostImageCopySrcLayouts, srcImageLayout)) {
+                    return false;
+                }
+                if (!supported(mHostImageCopyDstLayouts, dstImageLayouts[subresource])) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 VkResult CopyEngine::get_acceleration_structure_task_resources(VkDeviceSize taskSize, AccelerationStructureTaskResources* pTaskResources)
 {
     assert(mDevice);
@@ -1658,14 +2339,14 @@ uint32_t get_image_data_size(VkFormat format, const VkExtent3D& extent, const Vk
     GvkFormatInfo formatInfo{ };
     get_format_info(format, &formatInfo);
     auto imageAspectFlags = get_image_aspect_flags(format);
-    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
+    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount; ++arrayLayer) {
+        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount; ++mipLevel) {
             auto mipLevelExtent = get_mip_level_extent(extent, mipLevel);
             if (!formatInfo.compressionType) {
-                imageDataSize += get_bytes_per_texel(format) * mipLevelExtent.width * mipLevelExtent.height * mipLevelExtent.depth * imageSubresourceRange.layerCount;
+                imageDataSize += get_bytes_per_texel(format) * mipLevelExtent.width * mipLevelExtent.height * mipLevelExtent.depth;
             } else {
                 auto blockCount = (mipLevelExtent.width / formatInfo.blockExtent[0]) * (mipLevelExtent.height / formatInfo.blockExtent[1]) * (mipLevelExtent.depth / formatInfo.blockExtent[2]);
-                imageDataSize += blockCount * formatInfo.blockSize * imageSubresourceRange.layerCount;
+                imageDataSize += blockCount * formatInfo.blockSize;
             }
             // FROM : https://vulkan.lunarg.com/doc/view/1.3.261.1/windows/1.3-extensions/vkspec.html#VUID-vkCmdCopyImageToBuffer-srcImage-07978
             //  If srcImage has a depth/stencil format, the bufferOffset member of any element of pRegions must be a multiple of 4
@@ -30,7 +30,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-layer.hpp"
 #include "gvk-structures.hpp"
 
+#include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -38,7 +41,7 @@ namespace gvk {
 namespace restore_point {
 
 template <typename T>
-static void write_command(GvkRestorePointCreateFlags flags, std::ofstream& infoFile, std::ofstream& jsonFile, const GvkCommandBaseStructure* pCommand)
+static void write_command(GvkRestorePointCreateFlags flags, std::ostream& infoFile, std::ostream& jsonFile, const GvkCommandBaseStructure* pCommand)
 {
     assert(pCommand->sType == get_stype<T>());
     if (flags & GVK_RESTORE_POINT_CREATE_OBJECT_INFO_BIT) {
@@ -56,7 +59,49 @@ VkResult Creator::create_restore_point(const CreateInfo& createInfo)
     mLog << "Entered gvk::restore_point::Creator::create_restore_point()" << layer::Log::Flush;
 
     mCreateInfo = createInfo;
-    std::filesystem::create_directories(createInfo.path);
+    if (mCreateInfo.sinkType == GVK_RESTORE_POINT_SINK_TYPE_FILE) {
+        std::filesystem::create_directories(createInfo.path);
+    }
+
+    // Records are queued to a Sink and written by a SinkWriter on its own thread.
+    //  If GVK_RESTORE_POINT_CREATE_PACKED_ARCHIVE_BIT is set file sinks append all
+    //  records to a single Archive instead of writing loose files.
+    std::unique_ptr<SinkWriter> upSinkWriter;
+    auto sinkResult = VK_SUCCESS;
+    switch (mCreateInfo.sinkType) {
+    case GVK_RESTORE_POINT_SINK_TYPE_SOCKET: {
+        sinkResult = SocketSinkWriter::create(mCreateInfo.sinkAddress, &upSinkWriter);
+    } break;
+    case GVK_RESTORE_POINT_SINK_TYPE_CUSTOM: {
+        upSinkWriter = std::make_unique<CallbackSinkWriter>(mCreateInfo.sinkCallbacks);
+    } break;
+    default: {
+        if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_PACKED_ARCHIVE_BIT) {
+            sinkResult = ArchiveSinkWriter::create(createInfo.path / Archive::FileName, &upSinkWriter);
+        } else {
+            upSinkWriter = std::make_unique<DirectorySinkWriter>(createInfo.path);
+        }
+    } break;
+    }
+    if (sinkResult == VK_SUCCESS) {
+        sinkResult = Sink::create(std::move(upSinkWriter), mCreateInfo.sinkQueueBudget, &mCreateInfo.sink);
+    }
+
+    // Write the RestorePointHeader, the Applier reads it to determine how the rest
+    //  of the restore point's records were written.
+    if (sinkResult == VK_SUCCESS) {
+        RestorePointHeader restorePointHeader{ };
+        restorePointHeader.createFlags = mCreateInfo.gvkRestorePoint->createFlags;
+        restorePointHeader.compressionType = mCreateInfo.compressionType;
+        restorePointHeader.pageSize = mCreateInfo.deltaPageSize ? mCreateInfo.deltaPageSize : PageHashes::DefaultPageSize;
+        sinkResult = mCreateInfo.sink->write_object(RestorePointHeader::FileName, sizeof(restorePointHeader), (const uint8_t*)&restorePointHeader);
+    }
+    if (sinkResult != VK_SUCCESS) {
+        mResult = sinkResult;
+        mLog << VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        mLog << "Failed to create gvk::restore_point::Sink for " << (mCreateInfo.sinkAddress.empty() ? createInfo.path.string() : mCreateInfo.sinkAddress) << layer::Log::Flush;
+        return mResult;
+    }
 
     // Process the VkInstance
     GvkStateTrackedObject stateTrackedInstance{ };
@@ -71,6 +116,15 @@ VkResult Creator::create_restore_point(const CreateInfo& createInfo)
     enumerateInfo.pUserData = this;
     gvkEnumerateStateTrackedObjects(&stateTrackedInstance, &enumerateInfo);
 
+    // If GVK_RESTORE_POINT_CREATE_PARALLEL_OBJECT_PROCESSING_BIT is set enumeration
+    //  only collects objects and their dependencies, process them now.
+    if (!mDeferredObjects.empty()) {
+        auto deferredResult = process_deferred_objects();
+        if (mResult == VK_SUCCESS) {
+            mResult = deferredResult;
+        }
+    }
+
     // Prepare array of all objects besides debug objects
     std::vector<GvkStateTrackedObject> objects;
     objects.reserve(mCreateInfo.gvkRestorePoint->objectMap.size());
@@ -90,6 +144,13 @@ VkResult Creator::create_restore_point(const CreateInfo& createInfo)
         mCreateInfo.gvkRestorePoint->manifest = restorePointManifest;
         gvk_result(write_object_restore_info(mCreateInfo, { }, "GvkRestorePointManifest", restorePointManifest));
 
+        // If this is a delta restore point, write the path to its base restore point
+        if (mCreateInfo.baseRestorePoint) {
+            auto basePath = mCreateInfo.baseRestorePoint->path.u8string();
+            gvk_result(write_resource_data(mCreateInfo, mCreateInfo.path / PageHashes::BaseRestorePointFileName, 0, basePath.size(), (const uint8_t*)basePath.data()));
+            gvk_result(end_resource_data(mCreateInfo, mCreateInfo.path / PageHashes::BaseRestorePointFileName));
+        }
+
         // Process acceleration structure data after everything else
         if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_ACCELERATION_STRUCTURE_DATA_BIT) {
             gvk_result(process_VkAccelerationStructureKHR_downloads());
@@ -107,11 +168,114 @@ VkResult Creator::create_restore_point(const CreateInfo& createInfo)
     mDeviceQueueCreateInfos.clear();
     mCopyEngines.clear();
 
+    // NOTE : The Sink is finalized after mCopyEngines are cleared so that all in
+    //  flight resource data has been queued.  finalize() blocks until the queue is
+    //  drained and reports any error encountered by the SinkWriter.
+    if (mCreateInfo.sink) {
+        auto sinkResult = mCreateInfo.sink->finalize();
+        if (mResult == VK_SUCCESS) {
+            mResult = sinkResult;
+        }
+        mCreateInfo.sink.reset();
+    }
+
     mLog << VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
     mLog << "Leaving gvk::restore_point::Creator::create_restore_point() " << gvk::to_string(mResult, Printer::Default & ~Printer::EnumValue) << layer::Log::Flush;
     return mResult;
 }
 
+VkResult Creator::process_deferred_objects()
+{
+    gvk_result_scope_begin(VK_SUCCESS) {
+        // NOTE : Objects are deferred in enumeration order so each object's
+        //  dependencies are always ahead of it.  Objects that set up Creator state
+        //  (VkDevice, CopyEngine downloads, etc.) are processed on this thread in
+        //  that order, then the remaining objects only need their restore info
+        //  generated and serialized so they're processed concurrently.
+        std::vector<const DeferredObject*> concurrentObjects;
+        concurrentObjects.reserve(mDeferredObjects.size());
+        for (const auto& deferredObject : mDeferredObjects) {
+            if (process_concurrently(deferredObject.object.type)) {
+                concurrentObjects.push_back(&deferredObject);
+            } else {
+                gvk_result(process_restore_info(deferredObject.object, deferredObject.dependencies));
+            }
+        }
+
+        std::unique_ptr<asio::thread_pool> upThreadPool;
+        switch (mCreateInfo.threadCount) {
+        case 0: { upThreadPool = std::make_unique<asio::thread_pool>(); } break;
+        case 1: break;
+        default: { upThreadPool = std::make_unique<asio::thread_pool>(mCreateInfo.threadCount); } break;
+        }
+        if (upThreadPool) {
+            // NOTE : Each concurrent object's records are collected in its own
+            //  Sink::Batch.  As objects complete, every completed Batch that's next
+            //  in enumeration order is queued, so records are written in the same
+            //  order regardless of thread count and completed Batches don't wait
+            //  for the entire pool.
+            std::mutex mutex;
+            std::set<std::thread::id> initializedThreads;
+            std::vector<Sink::Batch> batches(concurrentObjects.size());
+            std::vector<bool> completed(concurrentObjects.size());
+            size_t nextBatchIndex = 0;
+            VkResult concurrentResult = VK_SUCCESS;
+            for (size_t i = 0; i < concurrentObjects.size(); ++i) {
+                asio::post(*upThreadPool, [&, i]()
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    auto initializeThread = initializedThreads.insert(std::this_thread::get_id()).second;
+                    lock.unlock();
+                    if (initializeThread && mCreateInfo.pfnInitializeThreadCallback) {
+                        mCreateInfo.pfnInitializeThreadCallback();
+                    }
+                    const auto& deferredObject = *concurrentObjects[i];
+                    mCreateInfo.sink->begin_batch(&batches[i]);
+                    auto result = process_restore_info(deferredObject.object, deferredObject.dependencies);
+                    mCreateInfo.sink->end_batch();
+                    lock.lock();
+                    if (result != VK_SUCCESS && concurrentResult == VK_SUCCESS) {
+                        concurrentResult = result;
+                    }
+                    completed[i] = true;
+                    for (; nextBatchIndex < batches.size() && completed[nextBatchIndex]; ++nextBatchIndex) {
+                        result = mCreateInfo.sink->push_batch(std::move(batches[nextBatchIndex]));
+                        batches[nextBatchIndex] = { };
+                        if (result != VK_SUCCESS && concurrentResult == VK_SUCCESS) {
+                            concurrentResult = result;
+                        }
+                    }
+                });
+            }
+            upThreadPool->join();
+            gvk_result(concurrentResult);
+        } else {
+            for (auto pDeferredObject : concurrentObjects) {
+                gvk_result(process_restore_info(pDeferredObject->object, pDeferredObject->dependencies));
+            }
+        }
+    } gvk_result_scope_end;
+    mDeferredObjects.clear();
+    return gvkResult;
+}
+
+bool Creator::process_concurrently(VkObjectType objectType)
+{
+    switch (objectType) {
+    case VK_OBJECT_TYPE_INSTANCE:
+    case VK_OBJECT_TYPE_PHYSICAL_DEVICE:
+    case VK_OBJECT_TYPE_DEVICE:
+    case VK_OBJECT_TYPE_QUEUE:
+    case VK_OBJECT_TYPE_DEVICE_MEMORY:
+    case VK_OBJECT_TYPE_BUFFER:
+    case VK_OBJECT_TYPE_IMAGE:
+    case VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR:
+    case VK_OBJECT_TYPE_SURFACE_KHR:
+    case VK_OBJECT_TYPE_SWAPCHAIN_KHR: return false;
+    default: return true;
+    }
+}
+
 VkResult Creator::process_VkDebugReportCallbackEXT(GvkDebugReportCallbackRestoreInfoEXT& restoreInfo)
 {
     (void)restoreInfo;
@@ -0,0 +1,136 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-restore-point/delta.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace gvk {
+namespace restore_point {
+
+void PageHashes::insert(const std::string& key, VkDeviceSize dataOffset, const std::vector<PageHash>& pageHashes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto& recordPageHashes = mPageHashes[key];
+    if (!dataOffset) {
+        recordPageHashes.clear();
+    }
+    recordPageHashes.insert(recordPageHashes.end(), pageHashes.begin(), pageHashes.end());
+}
+
+void PageHashes::get_changed_ranges(const std::string& key, const std::vector<PageHash>& pageHashes, std::vector<ResourceDataRange>& changedRanges) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto itr = mPageHashes.find(key);
+    for (const auto& pageHash : pageHashes) {
+        // NOTE : Page hashes are inserted in the order resource data is written, so
+        //  each record's page hashes are sorted by offset
+        auto changed = true;
+        if (itr != mPageHashes.end()) {
+            const auto& basePageHashes = itr->second;
+            auto compare = [](const PageHash& lhs, VkDeviceSize offset) { return lhs.offset < offset; };
+            auto baseItr = std::lower_bound(basePageHashes.begin(), basePageHashes.end(), pageHash.offset, compare);
+            changed =
+                baseItr == basePageHashes.end() ||
+                baseItr->offset != pageHash.offset ||
+                baseItr->size != pageHash.size ||
+                baseItr->hash != pageHash.hash;
+        }
+        if (changed) {
+            if (!changedRanges.empty() && changedRanges.back().offset + changedRanges.back().size == pageHash.offset) {
+                changedRanges.back().size += pageHash.size;
+            } else {
+                changedRanges.push_back({ pageHash.offset, pageHash.size });
+            }
+        }
+    }
+}
+
+void PageHashes::get(const std::string& key, std::vector<PageHash>& pageHashes) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto itr = mPageHashes.find(key);
+    if (itr != mPageHashes.end()) {
+        pageHashes = itr->second;
+    } else {
+        pageHashes.clear();
+    }
+}
+
+uint64_t hash_resource_data(const uint8_t* pData, size_t size)
+{
+    assert(pData || !size);
+    static constexpr uint64_t Prime0 = 0x9e3779b185ebca87;
+    static constexpr uint64_t Prime1 = 0xc2b2ae3d27d4eb4f;
+    auto mix = [](uint64_t hash, uint64_t value)
+    {
+        hash ^= value * Prime1;
+        hash = (hash << 31) | (hash >> 33);
+        return hash * Prime0;
+    };
+    uint64_t hash = Prime0 ^ size;
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t value = 0;
+        memcpy(&value, pData + offset, sizeof(value));
+        hash = mix(hash, value);
+    }
+    if (offset < size) {
+        uint64_t value = 0;
+        memcpy(&value, pData + offset, size - offset);
+        hash = mix(hash, value);
+    }
+    hash ^= hash >> 33;
+    hash *= Prime1;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+void hash_resource_data_pages(VkDeviceSize pageSize, VkDeviceSize dataOffset, VkDeviceSize dataSize, const uint8_t* pData, std::vector<PageHash>& pageHashes)
+{
+    assert(pageSize);
+    assert(pData || !dataSize);
+    auto dataEnd = dataOffset + dataSize;
+    for (auto offset = dataOffset; offset < dataEnd;) {
+        auto pageEnd = std::min((offset / pageSize + 1) * pageSize, dataEnd);
+        PageHash pageHash{ };
+        pageHash.offset = offset;
+        pageHash.size = pageEnd - offset;
+        pageHash.hash = hash_resource_data(pData + offset - dataOffset, (size_t)pageHash.size);
+        pageHashes.push_back(pageHash);
+        offset = pageEnd;
+    }
+}
+
+uint64_t get_resource_data_hash(const std::vector<PageHash>& pageHashes)
+{
+    return hash_resource_data((const uint8_t*)pageHashes.data(), pageHashes.size() * sizeof(PageHash));
+}
+
+} // namespace restore_point
+} // namespace gvk
@@ -29,9 +29,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-point/layer.hpp"
 #include "gvk-layer/registry.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace gvk {
 namespace restore_point {
 
+// NOTE : VkCopyAccelerationStructureToMemoryInfoKHR::dst must be 256 byte aligned
+static constexpr VkDeviceSize AccelerationStructureSerializationAlignment = 256;
+static constexpr VkDeviceSize AccelerationStructureDownloadBatchSize = 64 * 1024 * 1024;
+
 VkResult Layer::pre_vkCreateAccelerationStructureKHR(VkDevice device, const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure, VkResult gvkResult)
 {
     (void)device;
@@ -66,13 +73,13 @@ VkResult Creator::process_VkAccelerationStructureKHR_downloads()
         VkInstance vkInstance = VK_NULL_HANDLE;
         VkPhysicalDevice vkPhysicalDevice = VK_NULL_HANDLE;
         VkDevice vkDevice = VK_NULL_HANDLE;
-        VkDeviceSize maxAccelerationStructureSerializationSize = 0;
+        std::vector<VkAccelerationStructureKHR> accelerationStructures;
         for (uint32_t i = 0; i < mCreateInfo.gvkRestorePoint->manifest->objectCount; ++i) {
             const auto& object = mCreateInfo.gvkRestorePoint->manifest->pObjects[i];
             if (object.type == VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR) {
                 // TODO : Documentation
                 Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-                gvk_result(read_object_restore_info(mCreateInfo.path, "VkAccelerationStructureKHR", to_hex_string(object.handle), restoreInfo));
+                gvk_result(read_object_restore_info(mCreateInfo, "VkAccelerationStructureKHR", to_hex_string(object.handle), restoreInfo));
                 auto vkInstanceDependency = get_dependency<VkInstance>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
                 auto vkPhysicalDeviceDependency = get_dependency<VkPhysicalDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
                 auto vkDeviceDependency = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
@@ -82,14 +89,19 @@ VkResult Creator::process_VkAccelerationStructureKHR_downloads()
                 vkInstance = vkInstanceDependency;
                 vkPhysicalDevice = vkPhysicalDeviceDependency;
                 vkDevice = vkDeviceDependency;
-
-                // TODO : Documentation
-                VkDeviceSize acclerationStructureSerializationSize = 0;
-                gvk_result(mCopyEngines[vkDevice].get_acceleration_structure_serialization_size((VkAccelerationStructureKHR)object.handle, &acclerationStructureSerializationSize));
-                maxAccelerationStructureSerializationSize = std::max(maxAccelerationStructureSerializationSize, acclerationStructureSerializationSize);
+                accelerationStructures.push_back((VkAccelerationStructureKHR)object.handle);
             }
         }
 
+        // NOTE : Serialization sizes for every VkAccelerationStructureKHR are queried
+        //  with a single call so the device only sees one submission.
+        std::vector<VkDeviceSize> accelerationStructureSerializationSizes(accelerationStructures.size());
+        VkDeviceSize maxAccelerationStructureSerializationSize = 0;
+        if (!accelerationStructures.empty()) {
+            gvk_result(mCopyEngines[vkDevice].get_acceleration_structure_serialization_sizes((uint32_t)accelerationStructures.size(), accelerationStructures.data(), accelerationStructureSerializationSizes.data()));
+            maxAccelerationStructureSerializationSize = *std::max_element(accelerationStructureSerializationSizes.begin(), accelerationStructureSerializationSizes.end());
+        }
+
         // TODO : Documentation
         if (maxAccelerationStructureSerializationSize) {
             gvk_result(vkInstance ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
@@ -103,7 +115,7 @@ VkResult Creator::process_VkAccelerationStructureKHR_downloads()
             // TODO : Documentation
             auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
             bufferCreateInfo.flags = VK_BUFFER_CREATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT;
-            bufferCreateInfo.size = maxAccelerationStructureSerializationSize;
+            bufferCreateInfo.size = std::max(maxAccelerationStructureSerializationSize, AccelerationStructureDownloadBatchSize);
             bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
             VkBuffer vkBuffer = VK_NULL_HANDLE;
             gvk_result(layerDeviceDispatchTable.gvkCreateBuffer(vkDevice, &bufferCreateInfo, nullptr, &vkBuffer));
@@ -171,39 +183,50 @@ VkResult Creator::process_VkAccelerationStructureKHR_downloads()
             accelerationStructureSerializationInfo.pBufferCreateInfo = &bufferCreateInfo;
             accelerationStructureSerializationInfo.bufferDeviceAddress = bufferDeviceAddress;
 
-            // TODO : Documentation
-            for (uint32_t i = 0; i < mCreateInfo.gvkRestorePoint->manifest->objectCount; ++i) {
-                const auto& object = mCreateInfo.gvkRestorePoint->manifest->pObjects[i];
-                if (object.type == VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR) {
-                    // TODO : Documentation
-                    gvk_result(mCopyEngines[vkDevice].get_acceleration_structure_serialization_size((VkAccelerationStructureKHR)object.handle, &accelerationStructureSerializationInfo.size));
-
-                    // TODO : Documentation
-                    Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-                    gvk_result(read_object_restore_info(mCreateInfo.path, "VkAccelerationStructureKHR", to_hex_string(object.handle), restoreInfo));
-                    auto modifiedAccelerationStructureRestoreInfo = (GvkAccelerationStructureRestoreInfoKHR)restoreInfo;
-                    modifiedAccelerationStructureRestoreInfo.pSerializationInfo = &accelerationStructureSerializationInfo;
-                    modifiedAccelerationStructureRestoreInfo.serializedSize = accelerationStructureSerializationInfo.size;
-                    gvk_result(write_object_restore_info(mCreateInfo, "VkAccelerationStructureKHR", to_hex_string(modifiedAccelerationStructureRestoreInfo.handle), modifiedAccelerationStructureRestoreInfo));
-
-                    // TODO : Documentation
-                    if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_ACCELERATION_STRUCTURE_DATA_BIT) {
-                        auto downloadInfo = get_default<CopyEngine::DownloadAccelerationStructureInfo>();
-                        downloadInfo.accelerationStructure = restoreInfo->handle;
-                        downloadInfo.accelerationStructureCreateInfo = *restoreInfo->pAccelerationStructureCreateInfoKHR;
-                        downloadInfo.accelerationStructureSerializedSize = accelerationStructureSerializationInfo.size;
-                        downloadInfo.buffer = vkBuffer;
-                        downloadInfo.bufferCreateInfo = bufferCreateInfo;
-                        downloadInfo.bufferDeviceAddress = bufferDeviceAddress;
-                        downloadInfo.memory = vkDeviceMemory;
-                        downloadInfo.memoryAllocateInfo = memoryAllocateInfo;
-                        downloadInfo.device = vkDevice;
-                        downloadInfo.pUserData = this;
-                        downloadInfo.pfnCallback = process_downloaded_VkAccelerationStructureKHR;
-                        mCopyEngines[vkDevice].download(downloadInfo);
+            // NOTE : VkAccelerationStructureKHR downloads are batched so that each batch
+            //  is serialized into its own range of the serialization VkBuffer and copied
+            //  out with a single submission.  A batch is flushed when the next download
+            //  won't fit in the VkBuffer.
+            std::vector<CopyEngine::DownloadAccelerationStructureInfo> downloadInfos;
+            VkDeviceSize batchSize = 0;
+            for (size_t i = 0; i < accelerationStructures.size(); ++i) {
+                // TODO : Documentation
+                accelerationStructureSerializationInfo.size = accelerationStructureSerializationSizes[i];
+
+                // TODO : Documentation
+                Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
+                gvk_result(read_object_restore_info(mCreateInfo, "VkAccelerationStructureKHR", to_hex_string(accelerationStructures[i]), restoreInfo));
+                auto modifiedAccelerationStructureRestoreInfo = (GvkAccelerationStructureRestoreInfoKHR)restoreInfo;
+                modifiedAccelerationStructureRestoreInfo.pSerializationInfo = &accelerationStructureSerializationInfo;
+                modifiedAccelerationStructureRestoreInfo.serializedSize = accelerationStructureSerializationInfo.size;
+                gvk_result(write_object_restore_info(mCreateInfo, "VkAccelerationStructureKHR", to_hex_string(modifiedAccelerationStructureRestoreInfo.handle), modifiedAccelerationStructureRestoreInfo));
+
+                // TODO : Documentation
+                if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_ACCELERATION_STRUCTURE_DATA_BIT) {
+                    if (bufferCreateInfo.size < batchSize + accelerationStructureSerializationInfo.size) {
+                        mCopyEngines[vkDevice].download((uint32_t)downloadInfos.size(), downloadInfos.data());
+                        downloadInfos.clear();
+                        batchSize = 0;
                     }
+                    auto downloadInfo = get_default<CopyEngine::DownloadAccelerationStructureInfo>();
+                    downloadInfo.accelerationStructure = restoreInfo->handle;
+                    downloadInfo.accelerationStructureCreateInfo = *restoreInfo->pAccelerationStructureCreateInfoKHR;
+                    downloadInfo.accelerationStructureSerializedSize = accelerationStructureSerializationInfo.size;
+                    downloadInfo.buffer = vkBuffer;
+                    downloadInfo.bufferCreateInfo = bufferCreateInfo;
+                    downloadInfo.bufferDeviceAddress = bufferDeviceAddress;
+                    downloadInfo.bufferOffset = batchSize;
+                    downloadInfo.memory = vkDeviceMemory;
+                    downloadInfo.memoryAllocateInfo = memoryAllocateInfo;
+                    downloadInfo.device = vkDevice;
+                    downloadInfo.pUserData = this;
+                    downloadInfo.pfnCallback = process_downloaded_VkAccelerationStructureKHR;
+                    downloadInfos.push_back(downloadInfo);
+                    batchSize += accelerationStructureSerializationInfo.size;
+                    batchSize = (batchSize + AccelerationStructureSerializationAlignment - 1) & ~(AccelerationStructureSerializationAlignment - 1);
                 }
             }
+            mCopyEngines[vkDevice].download((uint32_t)downloadInfos.size(), downloadInfos.data());
 
             // TODO : Documentation
             for (auto& copyEngine : mCopyEngines) {
@@ -231,11 +254,9 @@ void Creator::process_downloaded_VkAccelerationStructureKHR(const CopyEngine::Do
             restorePointObject.dispatchableHandle = (uint64_t)downloadInfo.device;
             creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.accelerationStructureSerializedSize, pData);
         } else {
-            auto path = creator.mCreateInfo.path / "VkAccelerationStructureKHR";
-            std::filesystem::create_directories(path);
-            path /= to_hex_string(downloadInfo.accelerationStructure);
-            std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
-            dataFile.write((char*)pData, downloadInfo.accelerationStructureSerializedSize);
+            auto path = (creator.mCreateInfo.path / "VkAccelerationStructureKHR" / to_hex_string(downloadInfo.accelerationStructure)).replace_extension("data");
+            write_resource_data_chunk(creator.mCreateInfo, path, 0, downloadInfo.accelerationStructureSerializedSize, pData);
+            end_resource_data(creator.mCreateInfo, path);
         }
     }
 }
@@ -304,7 +325,7 @@ VkResult Applier::restore_VkAccelerationStructureKHR_data(const GvkStateTrackedO
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo));
         if (restoreInfo->flags & GVK_STATE_TRACKED_OBJECT_STATUS_ACTIVE_BIT) {
             auto vkDevice = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, restorePointObject.dispatchableHandle, restorePointObject.dispatchableHandle }).handle;
             gvk_result(restoreInfo->pSerializationInfo ? VK_SUCCESS : VK_ERROR_UNKNOWN);
@@ -334,16 +355,14 @@ void Applier::process_VkAccelerationStructureKHR_data_upload(const CopyEngine::U
     (void)uploadInfo;
     (void)bindBufferMemoryInfo;
     (void)pData;
+    assert(uploadInfo.pUserData);
+    const auto& applier = *(Applier*)uploadInfo.pUserData;
     gvk_result_scope_begin(VK_SUCCESS) {
         if (pData) {
-            if (std::filesystem::exists(uploadInfo.path)) {
-                std::ifstream dataFile(uploadInfo.path, std::ios::binary);
-                gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-                dataFile.read((char*)pData, uploadInfo.accelerationStructureSerializedSize);
+            if (resource_data_exists(applier.mApplyInfo, uploadInfo.path)) {
+                gvk_result(applier.read_resource_data(uploadInfo.path, 0, uploadInfo.accelerationStructureSerializedSize, pData));
             }
         } else {
-            assert(uploadInfo.pUserData);
-            const auto& applier = *(Applier*)uploadInfo.pUserData;
             if (applier.mApplyInfo.pfnProcessResourceDataCallback) {
                 GvkStateTrackedObject restorePointObject{ };
                 restorePointObject.type = VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR;
@@ -360,7 +379,7 @@ VkResult Applier::process_VkAccelerationStructureKHR_builds(const GvkStateTracke
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo));
         if (restoreInfo->buildGeometryInfo.sType == get_stype<VkAccelerationStructureBuildGeometryInfoKHR>()) {
             auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
             device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
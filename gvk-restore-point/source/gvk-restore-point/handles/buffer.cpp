@@ -159,13 +159,13 @@ void Creator::process_downloaded_VkBuffer(const CopyEngine::DownloadBufferInfo&
             restorePointObject.type = VK_OBJECT_TYPE_BUFFER;
             restorePointObject.handle = (uint64_t)downloadInfo.buffer;
             restorePointObject.dispatchableHandle = (uint64_t)downloadInfo.device;
-            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.size, pData);
+            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.dataSize, pData);
         } else {
-            auto path = creator.mCreateInfo.path / "VkBuffer";
-            std::filesystem::create_directories(path);
-            path /= to_hex_string(downloadInfo.buffer);
-            std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
-            dataFile.write((char*)pData, downloadInfo.size);
+            auto path = (creator.mCreateInfo.path / "VkBuffer" / to_hex_string(downloadInfo.buffer)).replace_extension("data");
+            write_resource_data_chunk(creator.mCreateInfo, path, downloadInfo.dataOffset, downloadInfo.dataSize, pData);
+            if (downloadInfo.dataOffset + downloadInfo.dataSize == downloadInfo.bufferCreateInfo.size) {
+                end_resource_data(creator.mCreateInfo, path);
+            }
         }
     }
 }
@@ -190,7 +190,7 @@ VkResult Applier::restore_VkBuffer_data(const GvkStateTrackedObject& restorePoin
     gvk_result_scope_begin(VK_SUCCESS) {
         if (mApplyInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_BUFFER_DATA_BIT) {
             Auto<GvkBufferRestoreInfo> restoreInfo;
-            gvk_result(read_object_restore_info(mApplyInfo.path, "VkBuffer", to_hex_string(restorePointObject.handle), restoreInfo));
+            gvk_result(read_object_restore_info(mApplyInfo, "VkBuffer", to_hex_string(restorePointObject.handle), restoreInfo));
             if (restoreInfo->flags & GVK_STATE_TRACKED_OBJECT_STATUS_ACTIVE_BIT) {
                 auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
                 device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
@@ -211,22 +211,20 @@ VkResult Applier::restore_VkBuffer_data(const GvkStateTrackedObject& restorePoin
 
 void Applier::process_VkBuffer_data_upload(const CopyEngine::UploadBufferInfo& uploadInfo, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
 {
+    assert(uploadInfo.pUserData);
+    const auto& applier = *(Applier*)uploadInfo.pUserData;
     gvk_result_scope_begin(VK_SUCCESS) {
         if (pData) {
-            if (std::filesystem::exists(uploadInfo.path)) {
-                std::ifstream dataFile(uploadInfo.path, std::ios::binary);
-                gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-                dataFile.read((char*)pData, uploadInfo.size);
+            if (resource_data_exists(applier.mApplyInfo, uploadInfo.path)) {
+                gvk_result(applier.read_resource_data(uploadInfo.path, uploadInfo.dataOffset, uploadInfo.dataSize, pData));
             }
         } else {
-            assert(uploadInfo.pUserData);
-            const auto& applier = *(Applier*)uploadInfo.pUserData;
             if (applier.mApplyInfo.pfnProcessResourceDataCallback) {
                 GvkStateTrackedObject restorePointObject{ };
                 restorePointObject.type = VK_OBJECT_TYPE_BUFFER;
                 restorePointObject.handle = (uint64_t)uploadInfo.buffer;
                 restorePointObject.dispatchableHandle = (uint64_t)uploadInfo.device;
-                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, uploadInfo.size, pData);
+                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, uploadInfo.dataSize, pData);
             }
         }
     } gvk_result_scope_end;
@@ -230,7 +230,7 @@ VkResult Applier::restore_VkDescriptorSet_bindings(const GvkStateTrackedObject&
     gvk_result_scope_begin(VK_SUCCESS) {
         std::vector<VkWriteDescriptorSet> descriptorWrites;
         Auto<GvkDescriptorSetRestoreInfo> descriptorSetRestoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDescriptorSet", to_hex_string(capturedDescriptorSet.handle), descriptorSetRestoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkDescriptorSet", to_hex_string(capturedDescriptorSet.handle), descriptorSetRestoreInfo));
 
 #if 0
         auto pNext = get_pnext<VkDescriptorSetVariableDescriptorCountAllocateInfo>(*descriptorSetRestoreInfo->pDescriptorSetAllocateInfo);
@@ -28,6 +28,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-point/creator.hpp"
 #include "gvk-restore-point/layer.hpp"
 #include "gvk-layer/registry.hpp"
+#include "gvk-structures/pnext.hpp"
+
+#include <algorithm>
+#include <vector>
 
 namespace gvk {
 namespace restore_point {
@@ -91,6 +95,37 @@ VkResult Creator::process_VkDeviceMemory(GvkDeviceMemoryRestoreInfo& restoreInfo
             bindings.insert(std::make_pair(bindImageMemoryInfo.memoryOffset, memoryRequirements.size));
         }
 
+        // If GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT is set only the
+        //  ranges of the allocation that are bound to a VkBuffer or VkImage are
+        //  downloaded.  Overlapping and adjacent bindings are coalesced and each
+        //  region's dstOffset is its offset in the packed VkDeviceMemory data.
+        const auto& memoryAllocateInfo = restoreInfo.pMemoryAllocateInfo ? *restoreInfo.pMemoryAllocateInfo : VkMemoryAllocateInfo{ };
+        std::vector<VkBufferCopy> dataRegions;
+        if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT) {
+            for (const auto& binding : bindings) {
+                auto begin = std::min(binding.first, memoryAllocateInfo.allocationSize);
+                auto end = std::min(binding.first + binding.second, memoryAllocateInfo.allocationSize);
+                if (begin < end) {
+                    if (!dataRegions.empty() && begin <= dataRegions.back().srcOffset + dataRegions.back().size) {
+                        auto& dataRegion = dataRegions.back();
+                        dataRegion.size = std::max(dataRegion.size, end - dataRegion.srcOffset);
+                    } else {
+                        auto dataRegion = get_default<VkBufferCopy>();
+                        dataRegion.srcOffset = begin;
+                        dataRegion.size = end - begin;
+                        dataRegions.push_back(dataRegion);
+                    }
+                }
+            }
+            VkDeviceSize dataSize = 0;
+            for (auto& dataRegion : dataRegions) {
+                dataRegion.dstOffset = dataSize;
+                dataSize += dataRegion.size;
+            }
+            restoreInfo.dataRegionCount = (uint32_t)dataRegions.size();
+            restoreInfo.pDataRegions = !dataRegions.empty() ? dataRegions.data() : nullptr;
+        }
+
         // HACK :
         if (restoreInfo.flags & GVK_STATE_TRACKED_OBJECT_STATUS_ACTIVE_BIT) {
             // Get mapped memory
@@ -99,17 +134,19 @@ VkResult Creator::process_VkDeviceMemory(GvkDeviceMemoryRestoreInfo& restoreInfo
             restoreInfo.mappedMemoryInfo = mappedMemoryInfo;
         }
 
-        const auto& memoryAllocateInfo = restoreInfo.pMemoryAllocateInfo ? *restoreInfo.pMemoryAllocateInfo : VkMemoryAllocateInfo{ };
-
         if (restoreInfo.flags & GVK_STATE_TRACKED_OBJECT_STATUS_ACTIVE_BIT) {
             // Submit for download
-            if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_DATA_BIT) {
+            // NOTE : If only bound regions are requested and nothing is bound there's
+            //  nothing to download, the allocation's contents are undefined on apply.
+            auto downloadRegions = !(mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT) || !dataRegions.empty();
+            if (mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_DATA_BIT && downloadRegions) {
                 auto downloadInfo = get_default<CopyEngine::DownloadDeviceMemoryInfo>();
                 downloadInfo.device = device;
                 downloadInfo.memory = restoreInfo.handle;
                 downloadInfo.memoryAllocateInfo = memoryAllocateInfo;
-                downloadInfo.regionCount = 0;
-                downloadInfo.pRegions = nullptr;
+                downloadInfo.regionCount = restoreInfo.dataRegionCount;
+                downloadInfo.pRegions = restoreInfo.pDataRegions;
+                downloadInfo.mappedMemoryInfo = restoreInfo.mappedMemoryInfo;
                 downloadInfo.pUserData = this;
                 downloadInfo.pfnAllocateResourceDataCallaback = mCreateInfo.pfnAllocateResourceDataCallback;
                 downloadInfo.pfnCallback = process_downloaded_VkDeviceMemory;
@@ -164,13 +201,14 @@ void Creator::process_downloaded_VkDeviceMemory(const CopyEngine::DownloadDevice
             restorePointObject.type = VK_OBJECT_TYPE_DEVICE_MEMORY;
             restorePointObject.handle = (uint64_t)downloadInfo.memory;
             restorePointObject.dispatchableHandle = (uint64_t)downloadInfo.device;
-            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.memoryAllocateInfo.allocationSize, pData);
+            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.dataSize, pData);
         } else {
-            auto path = creator.mCreateInfo.path / "VkDeviceMemory";
-            std::filesystem::create_directories(path);
-            path /= to_hex_string(downloadInfo.memory);
-            std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
-            dataFile.write((char*)pData, downloadInfo.memoryAllocateInfo.allocationSize);
+            auto path = (creator.mCreateInfo.path / "VkDeviceMemory" / to_hex_string(downloadInfo.memory)).replace_extension("data");
+            write_resource_data_chunk(creator.mCreateInfo, path, downloadInfo.dataOffset, downloadInfo.dataSize, pData);
+            const auto& lastRegion = downloadInfo.pRegions[downloadInfo.regionCount - 1];
+            if (downloadInfo.dataOffset + downloadInfo.dataSize == lastRegion.dstOffset + lastRegion.size) {
+                end_resource_data(creator.mCreateInfo, path);
+            }
         }
     }
 }
@@ -257,17 +295,25 @@ VkResult Layer::post_vkUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoK
 VkResult Applier::restore_VkDeviceMemory(const GvkStateTrackedObject& restorePointObject, const GvkDeviceMemoryRestoreInfo& restoreInfo)
 {
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-        remove_pnext_entries(
-            (VkBaseOutStructure*)restoreInfo.pMemoryAllocateInfo,
-            {
-                VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO,
-                VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
-                VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT,
-                VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
-            }
-        );
+        // NOTE : The restore info is restored with a copy of its VkMemoryAllocateInfo
+        //  that doesn't export or import memory, the restore info isn't modified.
+        Auto<VkMemoryAllocateInfo> memoryAllocateInfo;
+        auto restoreInfoCopy = restoreInfo;
+        if (restoreInfo.pMemoryAllocateInfo) {
+            memoryAllocateInfo = *restoreInfo.pMemoryAllocateInfo;
+            detail::remove_pnext_entries(
+                memoryAllocateInfo,
+                {
+                    VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO,
+                    VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
+                    VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT,
+                    VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR,
+                }
+            );
+            restoreInfoCopy.pMemoryAllocateInfo = &*memoryAllocateInfo;
+        }
 
-        gvk_result(BasicApplier::restore_VkDeviceMemory(restorePointObject, restoreInfo));
+        gvk_result(BasicApplier::restore_VkDeviceMemory(restorePointObject, restoreInfoCopy));
         auto device = (VkDevice)get_restored_object(get_restore_point_object_dependency<VkDevice>(restoreInfo.dependencyCount, restoreInfo.pDependencies)).handle;
         auto restoredObject = get_restored_object(restorePointObject);
         auto deviceMemory = (VkDeviceMemory)restoredObject.handle;
@@ -284,7 +330,7 @@ VkResult Applier::restore_VkDeviceMemory(const GvkStateTrackedObject& restorePoi
 
             // TODO : Is this the best place for this logic?
             Auto<GvkBufferRestoreInfo> bufferRestoreInfo;
-            gvk_result(read_object_restore_info<GvkBufferRestoreInfo>(mApplyInfo.path, "VkBuffer", to_hex_string(bufferBindInfo.buffer), bufferRestoreInfo));
+            gvk_result(read_object_restore_info<GvkBufferRestoreInfo>(mApplyInfo, "VkBuffer", to_hex_string(bufferBindInfo.buffer), bufferRestoreInfo));
             if (bufferRestoreInfo->pBufferCreateInfo->usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
                 auto bufferDeviceAddressInfo = get_default<VkBufferDeviceAddressInfo>();
                 bufferDeviceAddressInfo.buffer = buffer;
@@ -314,7 +360,15 @@ VkResult Applier::restore_VkDeviceMemory_data(const GvkStateTrackedObject& resto
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkDeviceMemoryRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkDeviceMemory", to_hex_string(restorePointObject.handle), restoreInfo));
+
+        // NOTE : When the restore point was created with
+        //  GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT a dataRegionCount
+        //  of 0 means nothing was bound and no data was written, it doesn't mean the
+        //  data contains the entire allocation.
+        if (mApplyInfo.header.createFlags & GVK_RESTORE_POINT_CREATE_DEVICE_MEMORY_BOUND_REGIONS_BIT && !restoreInfo->dataRegionCount) {
+            gvk_result_scope_break(VK_SUCCESS);
+        }
         auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
         CopyEngine::UploadDeviceMemoryInfo uploadInfo{ };
@@ -322,7 +376,13 @@ VkResult Applier::restore_VkDeviceMemory_data(const GvkStateTrackedObject& resto
         uploadInfo.device = device;
         uploadInfo.memory = (VkDeviceMemory)get_restored_object(restorePointObject).handle;
         uploadInfo.memoryAllocateInfo = *restoreInfo->pMemoryAllocateInfo;
-        // TODO : Handle regions...
+        uploadInfo.regionCount = restoreInfo->dataRegionCount;
+        uploadInfo.pRegions = restoreInfo->pDataRegions;
+        if (!(mApplyInfo.flags & GVK_RESTORE_POINT_APPLY_SYNTHETIC_BIT)) {
+            auto restoredDeviceMemory = get_restored_object(restorePointObject);
+            auto& mappedMemoryInfo = uploadInfo.mappedMemoryInfo;
+            gvkGetStateTrackedMappedMemory(&restoredDeviceMemory, &mappedMemoryInfo.offset, &mappedMemoryInfo.size, &mappedMemoryInfo.flags, (void**)&mappedMemoryInfo.dataHandle);
+        }
         uploadInfo.pUserData = this;
         uploadInfo.pfnCallback = process_VkDeviceMemory_data_upload;
         mCopyEngines[device].upload(uploadInfo);
@@ -332,28 +392,20 @@ VkResult Applier::restore_VkDeviceMemory_data(const GvkStateTrackedObject& resto
 
 void Applier::process_VkDeviceMemory_data_upload(const CopyEngine::UploadDeviceMemoryInfo& uploadInfo, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
 {
+    assert(uploadInfo.pUserData);
+    const auto& applier = *(Applier*)uploadInfo.pUserData;
     gvk_result_scope_begin(VK_SUCCESS) {
         if (pData) {
-            if (std::filesystem::exists(uploadInfo.path)) {
-                std::ifstream dataFile(uploadInfo.path, std::ios::binary);
-                gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-                // TODO : Handle regions...
-                assert(uploadInfo.regionCount == 1);
-                assert(uploadInfo.pRegions);
-                dataFile.read((char*)pData, uploadInfo.pRegions[0].size);
+            if (resource_data_exists(applier.mApplyInfo, uploadInfo.path)) {
+                gvk_result(applier.read_resource_data(uploadInfo.path, uploadInfo.dataOffset, uploadInfo.dataSize, pData));
             }
         } else {
-            assert(uploadInfo.pUserData);
-            const auto& applier = *(Applier*)uploadInfo.pUserData;
             if (applier.mApplyInfo.pfnProcessResourceDataCallback) {
                 GvkStateTrackedObject restorePointObject{ };
                 restorePointObject.type = VK_OBJECT_TYPE_DEVICE_MEMORY;
                 restorePointObject.handle = (uint64_t)uploadInfo.memory;
                 restorePointObject.dispatchableHandle = (uint64_t)uploadInfo.device;
-                // TODO : Handle regions...
-                assert(uploadInfo.regionCount == 1);
-                assert(uploadInfo.pRegions);
-                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, uploadInfo.pRegions[0].size, pData);
+                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, uploadInfo.dataSize, pData);
             }
         }
     } gvk_result_scope_end;
@@ -364,7 +416,7 @@ VkResult Applier::restore_VkDeviceMemory_mapping(const GvkStateTrackedObject& ca
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkDeviceMemoryRestoreInfo> deviceMemoryRestoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(capturedDeviceMemory.handle), deviceMemoryRestoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkDeviceMemory", to_hex_string(capturedDeviceMemory.handle), deviceMemoryRestoreInfo));
         auto restoredDeviceMemory = get_restored_object(capturedDeviceMemory);
         auto mappedMemoryInfo = get_default<GvkMappedMemoryInfo>();
         if (!(mApplyInfo.flags & GVK_RESTORE_POINT_APPLY_SYNTHETIC_BIT)) {
@@ -29,20 +29,62 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-point/layer.hpp"
 #include "gvk-layer/registry.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace gvk {
 namespace restore_point {
 
+static bool get_host_image_copy_supported(VkPhysicalDevice physicalDevice)
+{
+    // NOTE : VK_EXT_host_image_copy depends on VK_KHR_copy_commands2 and
+    //  VK_KHR_format_feature_flags2, it's only enabled when both the instance and
+    //  physical device are Vulkan 1.3 so those don't need to be enabled as well.
+    if (layer::Registry::get().apiVersion < VK_API_VERSION_1_3) {
+        return false;
+    }
+    const auto& layerDispatchTable = layer::Registry::get().get_physical_device_dispatch_table(physicalDevice);
+    VkPhysicalDeviceProperties physicalDeviceProperties{};
+    layerDispatchTable.gvkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+    if (physicalDeviceProperties.apiVersion < VK_API_VERSION_1_3) {
+        return false;
+    }
+    uint32_t extensionPropertyCount = 0;
+    layerDispatchTable.gvkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionPropertyCount, nullptr);
+    std::vector<VkExtensionProperties> extensionProperties(extensionPropertyCount);
+    layerDispatchTable.gvkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionPropertyCount, extensionProperties.data());
+    auto extensionPropertiesItr = std::find_if(extensionProperties.begin(), extensionProperties.end(),
+        [](const VkExtensionProperties& extensionProperties)
+        {
+            return !strcmp(extensionProperties.extensionName, VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+        }
+    );
+    if (extensionPropertiesItr == extensionProperties.end()) {
+        return false;
+    }
+    auto hostImageCopyFeatures = get_default<VkPhysicalDeviceHostImageCopyFeaturesEXT>();
+    auto physicalDeviceFeatures = get_default<VkPhysicalDeviceFeatures2>();
+    physicalDeviceFeatures.pNext = &hostImageCopyFeatures;
+    layerDispatchTable.gvkGetPhysicalDeviceFeatures2(physicalDevice, &physicalDeviceFeatures);
+    return hostImageCopyFeatures.hostImageCopy == VK_TRUE;
+}
+
 thread_local VkDeviceCreateInfo tlApplicationDeviceCreateInfo;
 thread_local VkDeviceCreateInfo tlRestorePointDeviceCreateInfo;
+thread_local std::vector<const char*> tlRestorePointEnabledExtensionNames;
+thread_local VkPhysicalDeviceHostImageCopyFeaturesEXT tlHostImageCopyFeatures;
+thread_local bool tlHostImageCopyEnabled;
 VkResult Layer::pre_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, VkResult gvkResult)
 {
-    (void)physicalDevice;
     (void)pAllocator;
     (void)pDevice;
     if (gvkResult == VK_SUCCESS) {
         assert(pCreateInfo);
         tlApplicationDeviceCreateInfo = *pCreateInfo;
         tlRestorePointDeviceCreateInfo = tlApplicationDeviceCreateInfo;
+        tlHostImageCopyEnabled = get_host_image_copy_supported(physicalDevice);
+        bool hostImageCopyFeaturesProvided = false;
         auto pNext = (VkBaseOutStructure*)pCreateInfo->pNext;
         while (pNext) {
             switch (pNext->sType) {
@@ -58,6 +100,12 @@ VkResult Layer::pre_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDevi
             case get_stype<VkPhysicalDeviceDescriptorBufferFeaturesEXT>(): {
                 ((VkPhysicalDeviceDescriptorBufferFeaturesEXT*)pNext)->descriptorBufferCaptureReplay = ((VkPhysicalDeviceDescriptorBufferFeaturesEXT*)pNext)->descriptorBuffer;
             } break;
+            case get_stype<VkPhysicalDeviceHostImageCopyFeaturesEXT>(): {
+                if (tlHostImageCopyEnabled) {
+                    ((VkPhysicalDeviceHostImageCopyFeaturesEXT*)pNext)->hostImageCopy = VK_TRUE;
+                }
+                hostImageCopyFeaturesProvided = true;
+            } break;
             case get_stype<VkPhysicalDeviceOpacityMicromapFeaturesEXT>(): {
                 ((VkPhysicalDeviceOpacityMicromapFeaturesEXT*)pNext)->micromapCaptureReplay = ((VkPhysicalDeviceOpacityMicromapFeaturesEXT*)pNext)->micromap;
             } break;
@@ -81,6 +129,29 @@ VkResult Layer::pre_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDevi
             }
             pNext = pNext->pNext;
         }
+
+        // NOTE : If VK_EXT_host_image_copy is available it's enabled so that the
+        //  CopyEngine can copy VkImage data on the host, see pre_vkCreateImage().
+        if (tlHostImageCopyEnabled) {
+            tlRestorePointEnabledExtensionNames.assign(pCreateInfo->ppEnabledExtensionNames, pCreateInfo->ppEnabledExtensionNames + pCreateInfo->enabledExtensionCount);
+            auto extensionNameItr = std::find_if(tlRestorePointEnabledExtensionNames.begin(), tlRestorePointEnabledExtensionNames.end(),
+                [](const char* pExtensionName)
+                {
+                    return !strcmp(pExtensionName, VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+                }
+            );
+            if (extensionNameItr == tlRestorePointEnabledExtensionNames.end()) {
+                tlRestorePointEnabledExtensionNames.push_back(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+                tlRestorePointDeviceCreateInfo.enabledExtensionCount = (uint32_t)tlRestorePointEnabledExtensionNames.size();
+                tlRestorePointDeviceCreateInfo.ppEnabledExtensionNames = tlRestorePointEnabledExtensionNames.data();
+            }
+            if (!hostImageCopyFeaturesProvided) {
+                tlHostImageCopyFeatures = get_default<VkPhysicalDeviceHostImageCopyFeaturesEXT>();
+                tlHostImageCopyFeatures.pNext = (void*)tlRestorePointDeviceCreateInfo.pNext;
+                tlHostImageCopyFeatures.hostImageCopy = VK_TRUE;
+                tlRestorePointDeviceCreateInfo.pNext = &tlHostImageCopyFeatures;
+            }
+        }
         *const_cast<VkDeviceCreateInfo*>(pCreateInfo) = tlRestorePointDeviceCreateInfo;
     }
     return gvkResult;
@@ -88,16 +159,28 @@ VkResult Layer::pre_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDevi
 
 VkResult Layer::post_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, VkResult gvkResult)
 {
-    (void)physicalDevice;
     (void)pAllocator;
-    (void)pDevice;
     if (gvkResult == VK_SUCCESS) {
         assert(pCreateInfo);
+        assert(pDevice);
         *const_cast<VkDeviceCreateInfo*>(pCreateInfo) = tlApplicationDeviceCreateInfo;
+        if (tlHostImageCopyEnabled) {
+            std::lock_guard<std::mutex> lock(mHostImageCopyMutex);
+            mHostImageCopyPhysicalDevices[*pDevice] = physicalDevice;
+        }
     }
     return gvkResult;
 }
 
+void Layer::post_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator)
+{
+    {
+        std::lock_guard<std::mutex> lock(mHostImageCopyMutex);
+        mHostImageCopyPhysicalDevices.erase(device);
+    }
+    BasicLayer::post_vkDestroyDevice(device, pAllocator);
+}
+
 VkResult Creator::process_VkDevice(GvkDeviceRestoreInfo& restoreInfo)
 {
     assert(restoreInfo.pDeviceCreateInfo);
@@ -130,6 +213,9 @@ VkResult Creator::process_VkDevice(GvkDeviceRestoreInfo& restoreInfo)
         assert(!copyEngine);
         auto copyEngineCreateInfo = get_default<CopyEngine::CreateInfo>();
         copyEngineCreateInfo.threadCount = mCreateInfo.threadCount;
+        copyEngineCreateInfo.stagingMemoryBudget = mCreateInfo.stagingMemoryBudget;
+        copyEngineCreateInfo.stagingChunkSize = mCreateInfo.stagingChunkSize;
+        copyEngineCreateInfo.inFlightTransferCount = mCreateInfo.inFlightTransferCount;
         copyEngineCreateInfo.pfnInitializeThreadCallback = mCreateInfo.pfnInitializeThreadCallback;
         gvk_result(CopyEngine::create(restoreInfo.handle, &copyEngineCreateInfo, &copyEngine));
         gvk_result(BasicCreator::process_VkDevice(restoreInfo));
@@ -195,6 +281,9 @@ VkResult Applier::restore_VkDevice_state(const GvkStateTrackedObject& restorePoi
         assert(!copyEngine);
         auto copyEngineCreateInfo = get_default<CopyEngine::CreateInfo>();
         copyEngineCreateInfo.threadCount = mApplyInfo.threadCount;
+        copyEngineCreateInfo.stagingMemoryBudget = mApplyInfo.stagingMemoryBudget;
+        copyEngineCreateInfo.stagingChunkSize = mApplyInfo.stagingChunkSize;
+        copyEngineCreateInfo.inFlightTransferCount = mApplyInfo.inFlightTransferCount;
         copyEngineCreateInfo.pfnInitializeThreadCallback = mApplyInfo.pfnInitializeThreadCallback;
         gvk_result(CopyEngine::create(gvkDevice, &copyEngineCreateInfo, &copyEngine));
 
@@ -37,13 +37,52 @@ namespace restore_point {
 
 VkResult Layer::pre_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage, VkResult gvkResult)
 {
-    (void)device;
     (void)pAllocator;
     (void)pImage;
     if (gvkResult == VK_SUCCESS) {
         assert(pCreateInfo);
         if (!(pCreateInfo->usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT)) {
             const_cast<VkImageCreateInfo*>(pCreateInfo)->usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+            // NOTE : If VK_EXT_host_image_copy was enabled in pre_vkCreateDevice(),
+            //  VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT is added so the CopyEngine can copy
+            //  this VkImage on the host.  The usage is only added when the
+            //  implementation reports that it doesn't change the VkImage memory layout,
+            //  so the application's device access performance is unaffected.
+            VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+            {
+                std::lock_guard<std::mutex> lock(mHostImageCopyMutex);
+                auto itr = mHostImageCopyPhysicalDevices.find(device);
+                if (itr != mHostImageCopyPhysicalDevices.end()) {
+                    physicalDevice = itr->second;
+                }
+            }
+            if (physicalDevice &&
+                !(pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) &&
+                pCreateInfo->samples == VK_SAMPLE_COUNT_1_BIT &&
+                (pCreateInfo->tiling == VK_IMAGE_TILING_OPTIMAL || pCreateInfo->tiling == VK_IMAGE_TILING_LINEAR)) {
+                auto imageFormatInfo = get_default<VkPhysicalDeviceImageFormatInfo2>();
+                imageFormatInfo.format = pCreateInfo->format;
+                imageFormatInfo.type = pCreateInfo->imageType;
+                imageFormatInfo.tiling = pCreateInfo->tiling;
+                imageFormatInfo.usage = pCreateInfo->usage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+                imageFormatInfo.flags = pCreateInfo->flags;
+                auto hostImageCopyDevicePerformanceQuery = get_default<VkHostImageCopyDevicePerformanceQueryEXT>();
+                auto imageFormatProperties = get_default<VkImageFormatProperties2>();
+                imageFormatProperties.pNext = &hostImageCopyDevicePerformanceQuery;
+                const auto& layerDispatchTable = layer::Registry::get().get_physical_device_dispatch_table(physicalDevice);
+                auto vkResult = layerDispatchTable.gvkGetPhysicalDeviceImageFormatProperties2(physicalDevice, &imageFormatInfo, &imageFormatProperties);
+                const auto& maxExtent = imageFormatProperties.imageFormatProperties.maxExtent;
+                if (vkResult == VK_SUCCESS &&
+                    hostImageCopyDevicePerformanceQuery.identicalMemoryLayout &&
+                    pCreateInfo->extent.width <= maxExtent.width &&
+                    pCreateInfo->extent.height <= maxExtent.height &&
+                    pCreateInfo->extent.depth <= maxExtent.depth &&
+                    pCreateInfo->mipLevels <= imageFormatProperties.imageFormatProperties.maxMipLevels &&
+                    pCreateInfo->arrayLayers <= imageFormatProperties.imageFormatProperties.maxArrayLayers) {
+                    const_cast<VkImageCreateInfo*>(pCreateInfo)->usage |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+                }
+            }
         }
     }
     return gvkResult;
@@ -128,7 +167,10 @@ void Creator::process_downloaded_VkImage(const CopyEngine::DownloadImageInfo& do
     // TODO : Documentation
     // TODO : General cleanup
     if (creator.mCreateInfo.gvkRestorePoint->createFlags & (GVK_RESTORE_POINT_CREATE_IMAGE_DATA_BIT | GVK_RESTORE_POINT_CREATE_IMAGE_PNG_BIT)) {
-        std::filesystem::create_directories(path);
+        // NOTE : PNGs are always written as loose files, regardless of the Sink
+        if (creator.mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_IMAGE_PNG_BIT) {
+            std::filesystem::create_directories(path);
+        }
         path /= to_hex_string(downloadInfo.image);
     }
 
@@ -154,45 +196,51 @@ void Creator::process_downloaded_VkImage(const CopyEngine::DownloadImageInfo& do
             }
         }
         if (pngAble) {
+            // NOTE : Image data may be downloaded in chunks, only subresources that are
+            //  entirely contained in this chunk are written.
             VkDeviceSize offset = 0;
             get_format_info(imageCreateInfo.format, &formatInfo);
             auto bytesPerTexel = get_bytes_per_texel(imageCreateInfo.format);
             const auto& imageSubresourceRange = downloadInfo.imageSubresourceRange;
             auto mipLevelStrMaxSize = std::to_string(imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount).size();
-            for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                std::string mipLevelStr = std::to_string(mipLevel);
-                mipLevelStr.insert(0, mipLevelStrMaxSize - mipLevelStr.size(), '0');
-                auto mipLevelExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                auto arrayLayerStrMaxSize = std::to_string(imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount).size();
-                for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                    std::string arrayLayerStr = std::to_string(arrayLayer);
-                    arrayLayerStr.insert(0, arrayLayerStrMaxSize - arrayLayerStr.size(), '0');
-                    auto pngPath = path;
-                    pngPath.replace_extension(mipLevelStr + '.' + arrayLayerStr + '.' + "png");
-                    auto stride = mipLevelExtent.width * bytesPerTexel;
-                    stbi_write_png(pngPath.string().c_str(), (int)mipLevelExtent.width, (int)mipLevelExtent.height, (int)formatInfo.componentCount, pData + offset, stride);
+            auto arrayLayerStrMaxSize = std::to_string(imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount).size();
+            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
+                std::string arrayLayerStr = std::to_string(arrayLayer);
+                arrayLayerStr.insert(0, arrayLayerStrMaxSize - arrayLayerStr.size(), '0');
+                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
                     auto arrayElementSubresourceRange = imageSubresourceRange;
                     arrayElementSubresourceRange.baseMipLevel = mipLevel;
                     arrayElementSubresourceRange.levelCount = 1;
                     arrayElementSubresourceRange.baseArrayLayer = arrayLayer;
                     arrayElementSubresourceRange.layerCount = 1;
-                    offset += get_image_data_size(imageCreateInfo, arrayElementSubresourceRange);
+                    auto subresourceSize = get_image_data_size(imageCreateInfo, arrayElementSubresourceRange);
+                    if (downloadInfo.dataOffset <= offset && offset + subresourceSize <= downloadInfo.dataOffset + downloadInfo.dataSize) {
+                        std::string mipLevelStr = std::to_string(mipLevel);
+                        mipLevelStr.insert(0, mipLevelStrMaxSize - mipLevelStr.size(), '0');
+                        auto mipLevelExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
+                        auto pngPath = path;
+                        pngPath.replace_extension(mipLevelStr + '.' + arrayLayerStr + '.' + "png");
+                        auto stride = mipLevelExtent.width * bytesPerTexel;
+                        stbi_write_png(pngPath.string().c_str(), (int)mipLevelExtent.width, (int)mipLevelExtent.height, (int)formatInfo.componentCount, pData + offset - downloadInfo.dataOffset, stride);
+                    }
+                    offset += subresourceSize;
                 }
             }
         }
     }
 
     if (creator.mCreateInfo.gvkRestorePoint->createFlags & GVK_RESTORE_POINT_CREATE_IMAGE_DATA_BIT) {
-        auto imageDataSize = get_image_data_size(imageCreateInfo, downloadInfo.imageSubresourceRange);
         if (creator.mCreateInfo.pfnProcessResourceDataCallback) {
             GvkStateTrackedObject restorePointObject{ };
             restorePointObject.type = VK_OBJECT_TYPE_IMAGE;
             restorePointObject.handle = (uint64_t)downloadInfo.image;
             restorePointObject.dispatchableHandle = (uint64_t)downloadInfo.device;
-            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, imageDataSize, pData);
+            creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, downloadInfo.dataSize, pData);
         } else {
-            std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
-            dataFile.write((char*)pData, imageDataSize);
+            write_resource_data_chunk(creator.mCreateInfo, path.replace_extension("data"), downloadInfo.dataOffset, downloadInfo.dataSize, pData);
+            if (downloadInfo.dataOffset + downloadInfo.dataSize == get_image_data_size(imageCreateInfo, downloadInfo.imageSubresourceRange)) {
+                end_resource_data(creator.mCreateInfo, path);
+            }
         }
     }
 }
@@ -221,7 +269,7 @@ VkResult Applier::restore_VkImage_layouts(const GvkStateTrackedObject& restorePo
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
         auto vkDevice = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         vkDevice = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)vkDevice, (uint64_t)vkDevice }).handle;
         auto vkImage = (VkImage)get_restored_object(restorePointObject).handle;
@@ -260,7 +308,7 @@ VkResult Applier::restore_VkImage_data(const GvkStateTrackedObject& restorePoint
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
         if (!get_dependency<VkSwapchainKHR>(restoreInfo->dependencyCount, restoreInfo->pDependencies)) {
             auto vkDevice = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
             vkDevice = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)vkDevice, (uint64_t)vkDevice }).handle;
@@ -299,22 +347,20 @@ VkResult Applier::restore_VkImage_data(const GvkStateTrackedObject& restorePoint
 
 void Applier::process_VkImage_data_upload(const CopyEngine::UploadImageInfo& uploadInfo, const VkBindBufferMemoryInfo& bindBufferMemoryInfo, uint8_t* pData)
 {
+    assert(uploadInfo.pUserData);
+    const auto& applier = *(Applier*)uploadInfo.pUserData;
     gvk_result_scope_begin(VK_SUCCESS) {
         if (pData) {
-            if (std::filesystem::exists(uploadInfo.path)) {
-                std::ifstream dataFile(uploadInfo.path, std::ios::binary);
-                gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-                dataFile.read((char*)pData, get_image_data_size(uploadInfo.imageCreateInfo, uploadInfo.imageSubresourceRange));
+            if (resource_data_exists(applier.mApplyInfo, uploadInfo.path)) {
+                gvk_result(applier.read_resource_data(uploadInfo.path, uploadInfo.dataOffset, uploadInfo.dataSize, pData));
             }
         } else {
-            assert(uploadInfo.pUserData);
-            const auto& applier = *(Applier*)uploadInfo.pUserData;
             if (applier.mApplyInfo.pfnProcessResourceDataCallback) {
                 GvkStateTrackedObject restorePointObject{ };
                 restorePointObject.type = VK_OBJECT_TYPE_IMAGE;
                 restorePointObject.handle = (uint64_t)uploadInfo.image;
                 restorePointObject.dispatchableHandle = (uint64_t)uploadInfo.device;
-                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, get_image_data_size(uploadInfo.imageCreateInfo, uploadInfo.imageSubresourceRange), pData);
+                applier.mApplyInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, uploadInfo.dataSize, pData);
             }
         }
     } gvk_result_scope_end;
@@ -325,7 +371,7 @@ VkResult Applier::process_VkImage_layouts(const GvkStateTrackedObject& restorePo
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
         auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
         CopyEngine::TransitionImageLayoutInfo transitionInfo{ };
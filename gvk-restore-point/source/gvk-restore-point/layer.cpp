@@ -65,6 +65,22 @@ VkResult Layer::create_restore_point(VkInstance instance, const GvkRestorePointC
     createInfo.instance = instance;
     createInfo.gvkRestorePoint = *pRestorePoint;
     createInfo.threadCount = 0; // TODO : Enable user control...pCreateInfo->threadCount
+    createInfo.stagingMemoryBudget = pCreateInfo->stagingMemoryBudget;
+    createInfo.stagingChunkSize = pCreateInfo->stagingChunkSize;
+    createInfo.inFlightTransferCount = pCreateInfo->inFlightTransferCount;
+    createInfo.compressionType = pCreateInfo->compressionType;
+    createInfo.compressionLevel = pCreateInfo->compressionLevel;
+    createInfo.compressionBlockSize = pCreateInfo->compressionBlockSize;
+    createInfo.baseRestorePoint = pCreateInfo->baseRestorePoint;
+    createInfo.deltaPageSize = pCreateInfo->deltaPageSize;
+    if (pCreateInfo->pSinkInfo) {
+        createInfo.sinkType = pCreateInfo->pSinkInfo->type;
+        createInfo.sinkAddress = pCreateInfo->pSinkInfo->pAddress ? pCreateInfo->pSinkInfo->pAddress : std::string();
+        createInfo.sinkQueueBudget = pCreateInfo->pSinkInfo->queueBudget;
+        createInfo.sinkCallbacks = *pCreateInfo->pSinkInfo;
+        createInfo.sinkCallbacks.pAddress = nullptr;
+    }
+    assert(!createInfo.baseRestorePoint || get_restore_points().count(createInfo.baseRestorePoint));
     createInfo.pfnInitializeThreadCallback = pCreateInfo->pfnInitializeThreadCallback;
     createInfo.pfnAllocateResourceDataCallback = pCreateInfo->pfnAllocateResourceDataCallback;
     createInfo.pfnProcessResourceDataCallback = pCreateInfo->pfnProcessResourceDataCallback;
@@ -89,6 +105,7 @@ VkResult Layer::create_restore_point(VkInstance instance, const GvkRestorePointC
     if (createInfo.path.empty()) {
         createInfo.path = "gvk-restore-point";
     }
+    (*pRestorePoint)->path = std::filesystem::absolute(createInfo.path);
 
     // Create the GvkRestorePoint
     return Creator().create_restore_point(createInfo);
@@ -106,6 +123,9 @@ VkResult Layer::apply_restore_point(VkInstance instance, const GvkRestorePointAp
     applyInfo.vkInstance = instance;
     applyInfo.gvkRestorePoint = restorePoint;
     applyInfo.threadCount = pApplyInfo->threadCount;
+    applyInfo.stagingMemoryBudget = pApplyInfo->stagingMemoryBudget;
+    applyInfo.stagingChunkSize = pApplyInfo->stagingChunkSize;
+    applyInfo.inFlightTransferCount = pApplyInfo->inFlightTransferCount;
 
     // Set path
     if (pApplyInfo->pPath) {
@@ -193,7 +213,7 @@ namespace layer {
 
 void on_load(Registry& registry)
 {
-    registry.layers.push_back(std::make_unique<restore_point::Layer>());
+    registry.add_layer<restore_point::Layer>();
 }
 
 } // namespace layer
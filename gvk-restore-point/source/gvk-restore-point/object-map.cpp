@@ -38,7 +38,7 @@ bool ObjectMap::register_object_restoration(const CapturedObject& capturedObject
 void ObjectMap::register_object_destruction(const RestoredObject& restoredObject)
 {
     assert(is_valid(restoredObject));
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::lock_guard<std::shared_mutex> lock(mMutex);
     auto itr = mCapturedObjects.find(restoredObject);
     if (itr != mCapturedObjects.end()) {
         mRestoredObjects.erase(itr->second);
@@ -50,13 +50,18 @@ bool ObjectMap::set_object_mapping(const CapturedObject& capturedObject, const R
 {
     assert(is_valid(capturedObject));
     assert(is_valid(restoredObject));
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::lock_guard<std::shared_mutex> lock(mMutex);
     auto restoredObjectInserted = mRestoredObjects.insert({ capturedObject, restoredObject }).second;
     auto capturedObjectInserted = mCapturedObjects.insert({ restoredObject, capturedObject }).second;
     assert(restoredObjectInserted == capturedObjectInserted);
     return restoredObjectInserted && capturedObjectInserted;
 }
 
+std::shared_lock<std::shared_mutex> ObjectMap::get_shared_lock() const
+{
+    return std::shared_lock<std::shared_mutex>(mMutex);
+}
+
 const std::map<CapturedObject, RestoredObject>& ObjectMap::get_restored_objects() const
 {
     return mRestoredObjects;
@@ -69,28 +74,28 @@ const std::map<RestoredObject, CapturedObject>& ObjectMap::get_captured_objects(
 
 RestoredObject ObjectMap::get_restored_object(const CapturedObject& capturedObject) const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::shared_lock<std::shared_mutex> lock(mMutex);
     auto itr = mRestoredObjects.find(capturedObject);
     return itr != mRestoredObjects.end() ? itr->second : RestoredObject{ };
 }
 
 CapturedObject ObjectMap::get_captured_object(const RestoredObject& restoredObject) const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::shared_lock<std::shared_mutex> lock(mMutex);
     auto itr = mCapturedObjects.find(restoredObject);
     return itr != mCapturedObjects.end() ? itr->second : RestoredObject{ };
 }
 
 size_t ObjectMap::size() const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::shared_lock<std::shared_mutex> lock(mMutex);
     assert(mRestoredObjects.size() == mCapturedObjects.size());
     return mRestoredObjects.size();
 }
 
 void ObjectMap::clear()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::lock_guard<std::shared_mutex> lock(mMutex);
     mRestoredObjects.clear();
     mCapturedObjects.clear();
 }
@@ -0,0 +1,496 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+
+#include "gvk-restore-point/sink.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace gvk {
+namespace restore_point {
+
+// NOTE : The Sink and Batch that records written on this thread are collected in,
+//  see Sink::begin_batch()
+static thread_local std::pair<const Sink*, Sink::Batch*> tlBatch;
+
+SinkWriter::~SinkWriter()
+{
+}
+
+DirectorySinkWriter::DirectorySinkWriter(const std::filesystem::path& path)
+    : mPath { path }
+{
+}
+
+VkResult DirectorySinkWriter::begin_object(const std::string& key)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Each record's file is created once when the record begins and stays
+        //  open until the record ends, chunks are written in place at their offsets.
+        auto path = mPath / key;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream dataFile(path, std::ios::binary | std::ios::out | std::ios::trunc);
+        gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        mDataFiles[key] = std::move(dataFile);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult DirectorySinkWriter::write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto itr = mDataFiles.find(key);
+        if (itr == mDataFiles.end()) {
+            gvk_result(begin_object(key));
+            itr = mDataFiles.find(key);
+        }
+        auto& dataFile = itr->second;
+        dataFile.seekp(dataOffset);
+        dataFile.write((const char*)pData, dataSize);
+        gvk_result(dataFile.good() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult DirectorySinkWriter::end_object(const std::string& key)
+{
+    auto itr = mDataFiles.find(key);
+    if (itr == mDataFiles.end()) {
+        return VK_SUCCESS;
+    }
+    itr->second.close();
+    auto vkResult = itr->second.fail() ? VK_ERROR_INITIALIZATION_FAILED : VK_SUCCESS;
+    mDataFiles.erase(itr);
+    return vkResult;
+}
+
+VkResult DirectorySinkWriter::finalize()
+{
+    auto vkResult = VK_SUCCESS;
+    for (auto& dataFile : mDataFiles) {
+        dataFile.second.close();
+        if (dataFile.second.fail()) {
+            vkResult = VK_ERROR_INITIALIZATION_FAILED;
+        }
+    }
+    mDataFiles.clear();
+    return vkResult;
+}
+
+VkResult ArchiveSinkWriter::create(const std::filesystem::path& path, std::unique_ptr<SinkWriter>* pupSinkWriter)
+{
+    assert(pupSinkWriter);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto upArchiveSinkWriter = std::make_unique<ArchiveSinkWriter>();
+        gvk_result(Archive::create(path, &upArchiveSinkWriter->mArchive));
+        *pupSinkWriter = std::move(upArchiveSinkWriter);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult ArchiveSinkWriter::begin_object(const std::string& key)
+{
+    return mArchive.write(key, 0, 0, nullptr);
+}
+
+VkResult ArchiveSinkWriter::write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData)
+{
+    return mArchive.write(key, dataOffset, dataSize, pData);
+}
+
+VkResult ArchiveSinkWriter::end_object(const std::string&)
+{
+    return VK_SUCCESS;
+}
+
+VkResult ArchiveSinkWriter::finalize()
+{
+    return mArchive.finalize();
+}
+
+VkResult SocketSinkWriter::create(const std::string& address, std::unique_ptr<SinkWriter>* pupSinkWriter)
+{
+    assert(pupSinkWriter);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        std::unique_ptr<SocketSinkWriter> upSocketSinkWriter(new SocketSinkWriter);
+#if defined(_WIN32) || defined(_WIN64)
+        auto pipe = CreateFileW(std::filesystem::path(address).c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        gvk_result(pipe != INVALID_HANDLE_VALUE ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        upSocketSinkWriter->mPipe = pipe;
+#else
+        sockaddr_un socketAddress { };
+        socketAddress.sun_family = AF_UNIX;
+        gvk_result(!address.empty() && address.size() < sizeof(socketAddress.sun_path) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        memcpy(socketAddress.sun_path, address.c_str(), address.size());
+        upSocketSinkWriter->mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        gvk_result(upSocketSinkWriter->mSocket != -1 ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(!connect(upSocketSinkWriter->mSocket, (const sockaddr*)&socketAddress, sizeof(socketAddress)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+#endif
+        gvk_result(upSocketSinkWriter->send(&Magic, sizeof(Magic)));
+        gvk_result(upSocketSinkWriter->send(&Version, sizeof(Version)));
+        *pupSinkWriter = std::move(upSocketSinkWriter);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+SocketSinkWriter::~SocketSinkWriter()
+{
+    close();
+}
+
+VkResult SocketSinkWriter::begin_object(const std::string& key)
+{
+    return send_message(BeginObject, key, 0, 0, nullptr);
+}
+
+VkResult SocketSinkWriter::write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData)
+{
+    return send_message(WriteChunk, key, dataOffset, dataSize, pData);
+}
+
+VkResult SocketSinkWriter::end_object(const std::string& key)
+{
+    return send_message(EndObject, key, 0, 0, nullptr);
+}
+
+VkResult SocketSinkWriter::finalize()
+{
+    auto vkResult = send_message(Finalize, { }, 0, 0, nullptr);
+    close();
+    return vkResult;
+}
+
+VkResult SocketSinkWriter::send_message(MessageType type, const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        uint8_t header[2 * sizeof(uint32_t) + 2 * sizeof(uint64_t)] { };
+        auto keySize = (uint32_t)key.size();
+        memcpy(header, &type, sizeof(uint32_t));
+        memcpy(header + sizeof(uint32_t), &keySize, sizeof(uint32_t));
+        memcpy(header + 2 * sizeof(uint32_t), &dataOffset, sizeof(uint64_t));
+        memcpy(header + 2 * sizeof(uint32_t) + sizeof(uint64_t), &dataSize, sizeof(uint64_t));
+        gvk_result(send(header, sizeof(header)));
+        gvk_result(send(key.data(), key.size()));
+        gvk_result(send(pData, dataSize));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult SocketSinkWriter::send(const void* pData, uint64_t size)
+{
+    auto pBytes = (const uint8_t*)pData;
+    while (size) {
+#if defined(_WIN32) || defined(_WIN64)
+        DWORD sent = 0;
+        auto sendSize = (DWORD)std::min<uint64_t>(size, UINT32_MAX);
+        if (!mPipe || !WriteFile(mPipe, pBytes, sendSize, &sent, nullptr) || !sent) {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+#else
+        // NOTE : MSG_NOSIGNAL prevents a collector that disconnects early from
+        //  raising SIGPIPE in the application, the failure is reported instead.
+#ifdef MSG_NOSIGNAL
+        auto flags = MSG_NOSIGNAL;
+#else
+        auto flags = 0;
+#endif
+        auto sent = mSocket != -1 ? ::send(mSocket, pBytes, (size_t)std::min<uint64_t>(size, INT32_MAX), flags) : -1;
+        if (sent <= 0) {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+#endif
+        pBytes += sent;
+        size -= sent;
+    }
+    return VK_SUCCESS;
+}
+
+void SocketSinkWriter::close()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (mPipe) {
+        FlushFileBuffers(mPipe);
+        CloseHandle(mPipe);
+        mPipe = nullptr;
+    }
+#else
+    if (mSocket != -1) {
+        ::close(mSocket);
+        mSocket = -1;
+    }
+#endif
+}
+
+CallbackSinkWriter::CallbackSinkWriter(const GvkRestorePointSinkInfo& sinkInfo)
+    : mSinkInfo { sinkInfo }
+{
+}
+
+VkResult CallbackSinkWriter::begin_object(const std::string& key)
+{
+    return mSinkInfo.pfnBeginObjectCallback ? mSinkInfo.pfnBeginObjectCallback(mSinkInfo.pUserData, key.c_str()) : VK_SUCCESS;
+}
+
+VkResult CallbackSinkWriter::write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData)
+{
+    return mSinkInfo.pfnWriteChunkCallback ? mSinkInfo.pfnWriteChunkCallback(mSinkInfo.pUserData, key.c_str(), dataOffset, dataSize, pData) : VK_SUCCESS;
+}
+
+VkResult CallbackSinkWriter::end_object(const std::string& key)
+{
+    return mSinkInfo.pfnEndObjectCallback ? mSinkInfo.pfnEndObjectCallback(mSinkInfo.pUserData, key.c_str()) : VK_SUCCESS;
+}
+
+VkResult CallbackSinkWriter::finalize()
+{
+    return VK_SUCCESS;
+}
+
+VkResult Sink::create(std::unique_ptr<SinkWriter> upSinkWriter, VkDeviceSize queueBudget, std::shared_ptr<Sink>* pspSink)
+{
+    assert(upSinkWriter);
+    assert(pspSink);
+    std::shared_ptr<Sink> spSink(new Sink);
+    spSink->mupSinkWriter = std::move(upSinkWriter);
+    spSink->mQueueBudget = queueBudget ? queueBudget : DefaultQueueBudget;
+    spSink->mThread = std::thread(&Sink::process_messages, spSink.get());
+    *pspSink = std::move(spSink);
+    return VK_SUCCESS;
+}
+
+Sink::~Sink()
+{
+    finalize();
+}
+
+VkResult Sink::begin_object(const std::string& key)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mOpenObjects.insert(key);
+    mSizes[key] = 0;
+    mRetainedObjects.erase(key);
+    Message message { };
+    message.type = SocketSinkWriter::BeginObject;
+    message.key = key;
+    return push(lock, std::move(message));
+}
+
+VkResult Sink::write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData, bool retain)
+{
+    // NOTE : Writing a chunk at offset 0 of a record that isn't open starts the
+    //  record, this matches Archive::write() replacing records written at offset 0.
+    if (!dataOffset) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (!mOpenObjects.count(key)) {
+            lock.unlock();
+            auto vkResult = begin_object(key);
+            if (vkResult != VK_SUCCESS) {
+                return vkResult;
+            }
+        }
+    }
+    std::unique_lock<std::mutex> lock(mMutex);
+    mOpenObjects.insert(key);
+    auto& size = mSizes[key];
+    size = dataOffset ? std::max(size, dataOffset + dataSize) : dataSize;
+    if (retain) {
+        auto& retainedObject = mRetainedObjects[key];
+        retainedObject.resize((size_t)size);
+        if (dataSize) {
+            memcpy(retainedObject.data() + dataOffset, pData, (size_t)dataSize);
+        }
+    }
+    Message message { };
+    message.type = SocketSinkWriter::WriteChunk;
+    message.key = key;
+    message.dataOffset = dataOffset;
+    if (dataSize) {
+        message.data.assign(pData, pData + dataSize);
+    }
+    return push(lock, std::move(message));
+}
+
+VkResult Sink::end_object(const std::string& key)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (!mOpenObjects.erase(key)) {
+        return mResult;
+    }
+    Message message { };
+    message.type = SocketSinkWriter::EndObject;
+    message.key = key;
+    return push(lock, std::move(message));
+}
+
+VkResult Sink::write_object(const std::string& key, uint64_t dataSize, const uint8_t* pData, bool retain)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        gvk_result(begin_object(key));
+        gvk_result(write_chunk(key, 0, dataSize, pData, retain));
+        gvk_result(end_object(key));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult Sink::finalize()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mThread.joinable()) {
+        // NOTE : Records that were never explicitly ended (ie. records written with
+        //  write_chunk() only) are ended before the SinkWriter is finalized.
+        for (const auto& key : mOpenObjects) {
+            Message message { };
+            message.type = SocketSinkWriter::EndObject;
+            message.key = key;
+            mMessages.push_back(std::move(message));
+        }
+        mOpenObjects.clear();
+        Message message { };
+        message.type = SocketSinkWriter::Finalize;
+        mMessages.push_back(std::move(message));
+        mFinalizing = true;
+        mCondition.notify_all();
+        lock.unlock();
+        mThread.join();
+        lock.lock();
+    }
+    return mResult;
+}
+
+uint64_t Sink::get_size(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto itr = mSizes.find(key);
+    return itr != mSizes.end() ? itr->second : 0;
+}
+
+VkResult Sink::read_retained(const std::string& key, std::vector<uint8_t>& data) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto itr = mRetainedObjects.find(key);
+    if (itr == mRetainedObjects.end()) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    data = itr->second;
+    return VK_SUCCESS;
+}
+
+void Sink::begin_batch(Batch* pBatch)
+{
+    assert(pBatch);
+    assert(!tlBatch.first && "gvk::restore_point::Sink batches can't be nested; gvk maintenance required");
+    tlBatch = { this, pBatch };
+}
+
+void Sink::end_batch()
+{
+    assert(tlBatch.first == this);
+    tlBatch = { };
+}
+
+VkResult Sink::push_batch(Batch&& batch)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    for (auto& message : batch.messages) {
+        auto vkResult = push(lock, std::move(message));
+        if (vkResult != VK_SUCCESS) {
+            return vkResult;
+        }
+    }
+    return mResult;
+}
+
+VkResult Sink::push(std::unique_lock<std::mutex>& lock, Message&& message)
+{
+    assert(lock.owns_lock());
+    if (mFinalizing) {
+        return mResult == VK_SUCCESS ? VK_ERROR_INITIALIZATION_FAILED : mResult;
+    }
+    if (tlBatch.first == this) {
+        tlBatch.second->messages.push_back(std::move(message));
+        return mResult;
+    }
+    mCondition.wait(lock, [&]() { return mMessages.empty() || mQueuedSize + message.data.size() <= mQueueBudget || mResult != VK_SUCCESS; });
+    if (mResult == VK_SUCCESS) {
+        mQueuedSize += message.data.size();
+        mMessages.push_back(std::move(message));
+        mCondition.notify_all();
+    }
+    return mResult;
+}
+
+void Sink::process_messages()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mCondition.wait(lock, [&]() { return !mMessages.empty() || mFinalizing; });
+        if (mMessages.empty()) {
+            break;
+        }
+        auto message = std::move(mMessages.front());
+        mMessages.pop_front();
+        auto vkResult = mResult;
+        lock.unlock();
+        if (vkResult == VK_SUCCESS) {
+            const auto& key = message.key;
+            const auto& data = message.data;
+            switch (message.type) {
+            case SocketSinkWriter::BeginObject: vkResult = mupSinkWriter->begin_object(key); break;
+            case SocketSinkWriter::WriteChunk: vkResult = mupSinkWriter->write_chunk(key, message.dataOffset, data.size(), data.data()); break;
+            case SocketSinkWriter::EndObject: vkResult = mupSinkWriter->end_object(key); break;
+            case SocketSinkWriter::Finalize: vkResult = mupSinkWriter->finalize(); break;
+            default: assert(false && "gvk::restore_point::Sink message type is unserviced; gvk maintenance required"); break;
+            }
+        }
+        lock.lock();
+        mQueuedSize -= message.data.size();
+        if (mResult == VK_SUCCESS) {
+            mResult = vkResult;
+        }
+        mCondition.notify_all();
+    }
+}
+
+} // namespace restore_point
+} // namespace gvk
@@ -0,0 +1,373 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "restore-point-test-utilities.hpp"
+#include "gvk-restore-point/compression.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace gvk::restore_point;
+
+static constexpr VkDeviceSize BlockSize = 4096;
+
+/**
+Gets data that doesn't compress (ie. a pseudo random byte sequence)
+*/
+static std::vector<uint8_t> get_incompressible_data(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    uint32_t state = 0x12345678;
+    for (auto& value : data) {
+        state = state * 1664525 + 1013904223;
+        value = (uint8_t)(state >> 24);
+    }
+    return data;
+}
+
+/**
+Gets data made up of a short repeating pattern
+*/
+static std::vector<uint8_t> get_repetitive_data(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (uint8_t)(i % 7);
+    }
+    return data;
+}
+
+/**
+Gets data with runs of repeated bytes broken up by pseudo random bytes, this
+    compresses but still produces a mix of matches and literals
+*/
+static std::vector<uint8_t> get_mixed_data(size_t size)
+{
+    auto data = get_incompressible_data(size);
+    for (size_t i = 0; i < data.size(); ++i) {
+        if ((i / 64) % 2) {
+            data[i] = (uint8_t)(i / 64);
+        }
+    }
+    return data;
+}
+
+/**
+Gets a ReadResourceDataFunction that reads from a record held in memory
+*/
+static ReadResourceDataFunction get_read_function(const std::vector<uint8_t>& record)
+{
+    return [&record](uint64_t offset, uint64_t size, uint8_t* pData)
+    {
+        if (record.size() < offset || record.size() - offset < size) {
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+        memcpy(pData, record.data() + offset, (size_t)size);
+        return VK_SUCCESS;
+    };
+}
+
+/**
+Compresses data with lz4_compress() and checks that lz4_decompress() restores it
+*/
+static void validate_lz4_round_trip(const std::vector<uint8_t>& data, int32_t level)
+{
+    std::vector<uint8_t> compressedData(gvk::detail::get_lz4_compress_bound(data.size()));
+    auto compressedSize = gvk::detail::lz4_compress(data.data(), data.size(), level, compressedData.data());
+    ASSERT_LE(compressedSize, compressedData.size());
+    std::vector<uint8_t> decompressedData(data.size());
+    ASSERT_TRUE(gvk::detail::lz4_decompress(compressedData.data(), compressedSize, decompressedData.data(), decompressedData.size()));
+    EXPECT_EQ(decompressedData, data);
+}
+
+TEST(Compression, Lz4RoundTrip)
+{
+    for (auto level : { 0, 1, 4, 12 }) {
+        validate_lz4_round_trip({ }, level);
+        validate_lz4_round_trip({ 1, 2, 3 }, level);
+        validate_lz4_round_trip(get_incompressible_data(64 * 1024), level);
+        validate_lz4_round_trip(get_repetitive_data(64 * 1024), level);
+        validate_lz4_round_trip(std::vector<uint8_t>(64 * 1024, 0xaa), level);
+        validate_lz4_round_trip(get_mixed_data(256 * 1024), level);
+    }
+}
+
+TEST(Compression, Lz4RepetitiveDataCompresses)
+{
+    auto data = get_repetitive_data(64 * 1024);
+    std::vector<uint8_t> compressedData(gvk::detail::get_lz4_compress_bound(data.size()));
+    auto compressedSize = gvk::detail::lz4_compress(data.data(), data.size(), 1, compressedData.data());
+    EXPECT_LT(compressedSize, data.size() / 32);
+}
+
+TEST(Compression, Lz4TruncatedInputFails)
+{
+    auto data = get_mixed_data(16 * 1024);
+    std::vector<uint8_t> compressedData(gvk::detail::get_lz4_compress_bound(data.size()));
+    auto compressedSize = gvk::detail::lz4_compress(data.data(), data.size(), 1, compressedData.data());
+    std::vector<uint8_t> decompressedData(data.size());
+    for (auto truncatedSize : { compressedSize - 1, compressedSize / 2, (size_t)1 }) {
+        EXPECT_FALSE(gvk::detail::lz4_decompress(compressedData.data(), truncatedSize, decompressedData.data(), decompressedData.size()));
+    }
+
+    // NOTE : Decompressing into a buffer that's too small or too large also fails
+    decompressedData.resize(data.size() - 1);
+    EXPECT_FALSE(gvk::detail::lz4_decompress(compressedData.data(), compressedSize, decompressedData.data(), decompressedData.size()));
+    decompressedData.resize(data.size() + 1);
+    EXPECT_FALSE(gvk::detail::lz4_decompress(compressedData.data(), compressedSize, decompressedData.data(), decompressedData.size()));
+}
+
+TEST(Compression, Lz4CorruptedInputFails)
+{
+    std::vector<uint8_t> decompressedData(64);
+
+    // A match offset of 0 is invalid
+    const std::vector<uint8_t> ZeroMatchOffset { 0x10, 'a', 0x00, 0x00, 0x00 };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(ZeroMatchOffset.data(), ZeroMatchOffset.size(), decompressedData.data(), 5));
+
+    // A match offset that reaches back before the start of the output is invalid
+    const std::vector<uint8_t> BadMatchOffset { 0x10, 'a', 0x02, 0x00, 0x00 };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(BadMatchOffset.data(), BadMatchOffset.size(), decompressedData.data(), 5));
+
+    // A match that runs past the end of the output is invalid
+    const std::vector<uint8_t> MatchPastEnd { 0x1f, 'a', 0x01, 0x00, 0xff, 0x00, 0x00 };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(MatchPastEnd.data(), MatchPastEnd.size(), decompressedData.data(), decompressedData.size()));
+
+    // A literal run that extends past the end of the input is invalid
+    const std::vector<uint8_t> LiteralsPastInput { 0x80, 'a', 'b', 'c' };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(LiteralsPastInput.data(), LiteralsPastInput.size(), decompressedData.data(), decompressedData.size()));
+
+    // A literal run that extends past the end of the output is invalid
+    const std::vector<uint8_t> LiteralsPastOutput { 0x40, 'a', 'b', 'c', 'd' };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(LiteralsPastOutput.data(), LiteralsPastOutput.size(), decompressedData.data(), 3));
+
+    // A length extension that's cut off is invalid
+    const std::vector<uint8_t> TruncatedLength { 0xf0, 0xff };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(TruncatedLength.data(), TruncatedLength.size(), decompressedData.data(), decompressedData.size()));
+
+    // A match offset that's cut off is invalid
+    const std::vector<uint8_t> TruncatedMatchOffset { 0x10, 'a', 0x01 };
+    EXPECT_FALSE(gvk::detail::lz4_decompress(TruncatedMatchOffset.data(), TruncatedMatchOffset.size(), decompressedData.data(), 5));
+}
+
+TEST(Compression, ResourceDataRoundTrip)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    std::vector<std::vector<uint8_t>> dataSets {
+        { },
+        get_incompressible_data(3 * BlockSize),
+        get_repetitive_data(3 * BlockSize),
+        get_mixed_data(5 * BlockSize + BlockSize / 3),
+    };
+    for (const auto& data : dataSets) {
+        for (auto compressionType : { GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE, GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4 }) {
+            std::vector<uint8_t> record;
+            ASSERT_EQ(compress_resource_data(compressionType, 0, BlockSize, 0, data.size(), data.data(), record), VK_SUCCESS);
+            CompressedBlockIndex compressedBlockIndex;
+            ASSERT_EQ(CompressedBlockIndex::create(get_read_function(record), record.size(), &compressedBlockIndex), VK_SUCCESS);
+            std::vector<uint8_t> decompressedData(data.size());
+            ASSERT_EQ(compressedBlockIndex.decompress(get_read_function(record), 0, data.size(), decompressedData.data()), VK_SUCCESS);
+            EXPECT_EQ(decompressedData, data);
+        }
+    }
+}
+
+TEST(Compression, ResourceDataBlocks)
+{
+    // NOTE : Data is split into blocks of at most the requested block size, the
+    //  final block holds whatever is left over.  Blocks that don't compress are
+    //  stored uncompressed.
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    auto data = get_repetitive_data(3 * BlockSize + BlockSize / 4);
+    auto incompressibleData = get_incompressible_data((size_t)BlockSize);
+    memcpy(data.data() + BlockSize, incompressibleData.data(), incompressibleData.size());
+    const VkDeviceSize DataOffset = 8 * BlockSize;
+    std::vector<uint8_t> record;
+    ASSERT_EQ(compress_resource_data(GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4, 0, BlockSize, DataOffset, data.size(), data.data(), record), VK_SUCCESS);
+    std::vector<CompressedBlockHeader> headers;
+    for (size_t recordOffset = 0; recordOffset < record.size();) {
+        ASSERT_LE(recordOffset + sizeof(CompressedBlockHeader), record.size());
+        CompressedBlockHeader header { };
+        memcpy(&header, record.data() + recordOffset, sizeof(header));
+        EXPECT_EQ(header.magic, CompressedBlockHeader::Magic);
+        recordOffset += sizeof(header) + header.compressedSize;
+        headers.push_back(header);
+    }
+    ASSERT_EQ(headers.size(), 4u);
+    for (size_t block_i = 0; block_i < headers.size(); ++block_i) {
+        EXPECT_EQ(headers[block_i].dataOffset, DataOffset + block_i * BlockSize);
+    }
+    EXPECT_EQ(headers[0].compressionType, (uint32_t)GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4);
+    EXPECT_LT(headers[0].compressedSize, headers[0].dataSize);
+    EXPECT_EQ(headers[1].compressionType, (uint32_t)GVK_RESTORE_POINT_COMPRESSION_TYPE_NONE);
+    EXPECT_EQ(headers[1].compressedSize, headers[1].dataSize);
+    EXPECT_EQ(headers[2].dataSize, BlockSize);
+    EXPECT_EQ(headers[3].dataSize, BlockSize / 4);
+
+    // Decompress ranges that start and end mid block, including the final block
+    CompressedBlockIndex compressedBlockIndex;
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(record), record.size(), &compressedBlockIndex), VK_SUCCESS);
+    const std::vector<std::pair<VkDeviceSize, VkDeviceSize>> Ranges {
+        { 0, data.size() },
+        { BlockSize / 2, BlockSize },
+        { BlockSize - 1, 2 },
+        { 3 * BlockSize + 1, BlockSize / 4 - 1 },
+        { BlockSize / 3, 2 * BlockSize + BlockSize / 2 },
+    };
+    for (const auto& range : Ranges) {
+        std::vector<uint8_t> decompressedData((size_t)range.second);
+        ASSERT_EQ(compressedBlockIndex.decompress(get_read_function(record), DataOffset + range.first, range.second, decompressedData.data()), VK_SUCCESS);
+        EXPECT_TRUE(std::equal(decompressedData.begin(), decompressedData.end(), data.begin() + (size_t)range.first));
+    }
+}
+
+TEST(Compression, AppendedChunks)
+{
+    // NOTE : Chunks compressed separately and appended to a record the way
+    //  write_compressed_resource_data() writes them decompress as one range
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    auto data = get_mixed_data(4 * BlockSize);
+    std::vector<uint8_t> record;
+    const VkDeviceSize ChunkSize = BlockSize + BlockSize / 2;
+    for (VkDeviceSize chunkOffset = 0; chunkOffset < data.size(); chunkOffset += ChunkSize) {
+        auto chunkSize = std::min<VkDeviceSize>(ChunkSize, data.size() - chunkOffset);
+        ASSERT_EQ(compress_resource_data(GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4, 0, BlockSize, chunkOffset, chunkSize, data.data() + chunkOffset, record), VK_SUCCESS);
+    }
+    CompressedBlockIndex compressedBlockIndex;
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(record), record.size(), &compressedBlockIndex), VK_SUCCESS);
+    std::vector<uint8_t> decompressedData(data.size());
+    ASSERT_EQ(compressedBlockIndex.decompress(get_read_function(record), 0, data.size(), decompressedData.data()), VK_SUCCESS);
+    EXPECT_EQ(decompressedData, data);
+}
+
+TEST(Compression, CorruptedRecordFails)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    auto data = get_repetitive_data(2 * BlockSize);
+    std::vector<uint8_t> record;
+    ASSERT_EQ(compress_resource_data(GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4, 0, BlockSize, 0, data.size(), data.data(), record), VK_SUCCESS);
+    CompressedBlockHeader header { };
+    memcpy(&header, record.data(), sizeof(header));
+    ASSERT_EQ(header.compressionType, (uint32_t)GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4);
+
+    // A record that ends partway through a block can't be indexed
+    CompressedBlockIndex compressedBlockIndex;
+    for (auto recordSize : { record.size() - 1, sizeof(CompressedBlockHeader) - 1, sizeof(CompressedBlockHeader) + header.compressedSize + 1 }) {
+        EXPECT_NE(CompressedBlockIndex::create(get_read_function(record), recordSize, &compressedBlockIndex), VK_SUCCESS);
+    }
+
+    // A block header with the wrong magic can't be indexed
+    auto badMagicRecord = record;
+    badMagicRecord[0] ^= 0xff;
+    EXPECT_NE(CompressedBlockIndex::create(get_read_function(badMagicRecord), badMagicRecord.size(), &compressedBlockIndex), VK_SUCCESS);
+
+    // A block whose compressed data is damaged indexes but fails to decompress
+    auto badMatchRecord = record;
+    auto pBlockData = badMatchRecord.data() + sizeof(CompressedBlockHeader);
+    auto literalCount = (size_t)(pBlockData[0] >> 4);
+    ASSERT_LT(literalCount, 15u);
+    auto pMatchOffset = pBlockData + 1 + literalCount;
+    pMatchOffset[0] = 0xff;
+    pMatchOffset[1] = 0xff;
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(badMatchRecord), badMatchRecord.size(), &compressedBlockIndex), VK_SUCCESS);
+    std::vector<uint8_t> decompressedData(data.size());
+    EXPECT_NE(compressedBlockIndex.decompress(get_read_function(badMatchRecord), 0, data.size(), decompressedData.data()), VK_SUCCESS);
+
+    // A block that decompresses to less data than its header claims fails
+    auto badSizeRecord = record;
+    header.dataSize += 1;
+    memcpy(badSizeRecord.data(), &header, sizeof(header));
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(badSizeRecord), badSizeRecord.size(), &compressedBlockIndex), VK_SUCCESS);
+    EXPECT_NE(compressedBlockIndex.decompress(get_read_function(badSizeRecord), 0, BlockSize, decompressedData.data()), VK_SUCCESS);
+
+    // A read failure is returned
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(record), record.size(), &compressedBlockIndex), VK_SUCCESS);
+    auto failedRead = [](uint64_t, uint64_t, uint8_t*) { return VK_ERROR_INITIALIZATION_FAILED; };
+    EXPECT_NE(compressedBlockIndex.decompress(failedRead, 0, data.size(), decompressedData.data()), VK_SUCCESS);
+}
+
+TEST(Compression, ParallelMatchesSerial)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    auto data = get_mixed_data(64 * BlockSize + BlockSize / 2);
+    std::vector<uint8_t> record;
+    ASSERT_EQ(compress_resource_data(GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4, 0, BlockSize, 0, data.size(), data.data(), record), VK_SUCCESS);
+    CompressedBlockIndex compressedBlockIndex;
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(record), record.size(), &compressedBlockIndex), VK_SUCCESS);
+    asio::thread_pool threadPool(4);
+    const std::vector<std::pair<VkDeviceSize, VkDeviceSize>> Ranges {
+        { 0, data.size() },
+        { BlockSize / 2, 32 * BlockSize },
+        { 63 * BlockSize + 7, BlockSize / 2 + BlockSize - 7 },
+    };
+    for (const auto& range : Ranges) {
+        std::vector<uint8_t> serialData((size_t)range.second);
+        ASSERT_EQ(compressedBlockIndex.decompress(get_read_function(record), range.first, range.second, serialData.data()), VK_SUCCESS);
+        std::vector<uint8_t> parallelData((size_t)range.second);
+        ASSERT_EQ(compressedBlockIndex.decompress(get_read_function(record), range.first, range.second, parallelData.data(), &threadPool), VK_SUCCESS);
+        EXPECT_EQ(parallelData, serialData);
+        EXPECT_TRUE(std::equal(parallelData.begin(), parallelData.end(), data.begin() + (size_t)range.first));
+    }
+
+    // NOTE : Decompressing from a task running on the asio::thread_pool that blocks
+    //  are decompressed on must not deadlock, even when every thread is busy
+    std::vector<std::vector<uint8_t>> taskData(8, std::vector<uint8_t>(data.size()));
+    std::vector<std::future<VkResult>> taskResults;
+    for (auto& decompressedData : taskData) {
+        auto spPromise = std::make_shared<std::promise<VkResult>>();
+        taskResults.push_back(spPromise->get_future());
+        asio::post(threadPool, [&, spPromise, pDecompressedData = decompressedData.data()]()
+        {
+            spPromise->set_value(compressedBlockIndex.decompress(get_read_function(record), 0, data.size(), pDecompressedData, &threadPool));
+        });
+    }
+    for (size_t task_i = 0; task_i < taskResults.size(); ++task_i) {
+        EXPECT_EQ(taskResults[task_i].get(), VK_SUCCESS);
+        EXPECT_EQ(taskData[task_i], data);
+    }
+
+    // NOTE : A block that fails to decompress is reported when decompressing in
+    //  parallel the same as it is when decompressing serially
+    auto badSizeRecord = record;
+    CompressedBlockHeader header { };
+    auto recordOffset = (size_t)0;
+    for (size_t block_i = 0; block_i < 10; ++block_i) {
+        memcpy(&header, badSizeRecord.data() + recordOffset, sizeof(header));
+        recordOffset += sizeof(header) + header.compressedSize;
+    }
+    memcpy(&header, badSizeRecord.data() + recordOffset, sizeof(header));
+    ASSERT_EQ(header.compressionType, (uint32_t)GVK_RESTORE_POINT_COMPRESSION_TYPE_LZ4);
+    header.dataSize += 1;
+    memcpy(badSizeRecord.data() + recordOffset, &header, sizeof(header));
+    ASSERT_EQ(CompressedBlockIndex::create(get_read_function(badSizeRecord), badSizeRecord.size(), &compressedBlockIndex), VK_SUCCESS);
+    std::vector<uint8_t> decompressedData(data.size() + 1);
+    EXPECT_NE(compressedBlockIndex.decompress(get_read_function(badSizeRecord), 0, data.size(), decompressedData.data()), VK_SUCCESS);
+    EXPECT_NE(compressedBlockIndex.decompress(get_read_function(badSizeRecord), 0, data.size(), decompressedData.data(), &threadPool), VK_SUCCESS);
+}
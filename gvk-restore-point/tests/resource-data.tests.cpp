@@ -0,0 +1,148 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "restore-point-test-utilities.hpp"
+#include "gvk-restore-point/utilities.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace gvk::restore_point;
+
+static constexpr VkDeviceSize PageSize = 4096;
+static constexpr VkDeviceSize DataSize = 3 * PageSize + PageSize / 2;
+
+/**
+Writes a ".data" record in two chunks the way CopyEngine callbacks do, along with
+its ".hash" record
+*/
+static void write_test_resource_data(const std::filesystem::path& restorePointPath, const std::filesystem::path& path, std::vector<uint8_t>& data)
+{
+    data.resize((size_t)DataSize);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (uint8_t)(i * 31 + i / PageSize);
+    }
+    GvkRestorePoint_T gvkRestorePoint;
+    CreateInfo createInfo;
+    createInfo.gvkRestorePoint = &gvkRestorePoint;
+    createInfo.path = restorePointPath;
+    createInfo.deltaPageSize = PageSize;
+    ASSERT_EQ(Sink::create(std::make_unique<DirectorySinkWriter>(restorePointPath), 0, &createInfo.sink), VK_SUCCESS);
+    auto chunkSize = 2 * PageSize;
+    ASSERT_EQ(write_resource_data_chunk(createInfo, path, 0, chunkSize, data.data()), VK_SUCCESS);
+    ASSERT_EQ(write_resource_data_chunk(createInfo, path, chunkSize, DataSize - chunkSize, data.data() + chunkSize), VK_SUCCESS);
+    ASSERT_EQ(end_resource_data(createInfo, path), VK_SUCCESS);
+    ASSERT_EQ(createInfo.sink->finalize(), VK_SUCCESS);
+}
+
+static ApplyInfo get_test_apply_info(const std::filesystem::path& restorePointPath)
+{
+    ApplyInfo applyInfo;
+    applyInfo.path = restorePointPath;
+    applyInfo.header.createFlags = GVK_RESTORE_POINT_CREATE_BUFFER_DATA_BIT;
+    applyInfo.header.pageSize = PageSize;
+    return applyInfo;
+}
+
+TEST(ResourceData, HashRoundTrip)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    TestDirectory testDirectory;
+    auto path = testDirectory.get_path() / "VkBuffer" / "0x0000000000000001.data";
+    std::vector<uint8_t> data;
+    write_test_resource_data(testDirectory.get_path(), path, data);
+    auto hashPath = path;
+    ASSERT_TRUE(std::filesystem::exists(hashPath.replace_extension("hash")));
+
+    auto applyInfo = get_test_apply_info(testDirectory.get_path());
+    std::vector<PageHash> pageHashes;
+    uint64_t resourceDataHash = 0;
+    ASSERT_EQ(read_resource_data_hashes(applyInfo, path, pageHashes, &resourceDataHash), VK_SUCCESS);
+    ASSERT_EQ(pageHashes.size(), 4u);
+    EXPECT_EQ(get_resource_data_hash(pageHashes), resourceDataHash);
+    for (const auto& pageHash : pageHashes) {
+        EXPECT_EQ(pageHash.hash, hash_resource_data(data.data() + pageHash.offset, (size_t)pageHash.size));
+    }
+
+    // Verify the whole record and chunks that don't line up with pages
+    std::vector<uint8_t> readData(data.size());
+    ASSERT_EQ(read_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+    EXPECT_EQ(readData, data);
+    EXPECT_EQ(verify_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+    const VkDeviceSize ChunkSize = PageSize + PageSize / 4;
+    for (VkDeviceSize dataOffset = 0; dataOffset < DataSize; dataOffset += ChunkSize) {
+        auto dataSize = std::min(ChunkSize, DataSize - dataOffset);
+        ASSERT_EQ(read_resource_data(applyInfo, path, dataOffset, dataSize, readData.data()), VK_SUCCESS);
+        EXPECT_EQ(verify_resource_data(applyInfo, path, dataOffset, dataSize, readData.data()), VK_SUCCESS);
+    }
+}
+
+TEST(ResourceData, CorruptedPageDetected)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    TestDirectory testDirectory;
+    auto path = testDirectory.get_path() / "VkBuffer" / "0x0000000000000001.data";
+    std::vector<uint8_t> data;
+    write_test_resource_data(testDirectory.get_path(), path, data);
+    {
+        std::fstream dataFile(path, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(dataFile.is_open());
+        dataFile.seekp(2 * PageSize + 7);
+        dataFile.put((char)~data[2 * PageSize + 7]);
+    }
+
+    // NOTE : Only the chunk that contains the corrupted page fails verification
+    auto applyInfo = get_test_apply_info(testDirectory.get_path());
+    std::vector<uint8_t> readData(data.size());
+    ASSERT_EQ(read_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+    EXPECT_NE(verify_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+    EXPECT_EQ(verify_resource_data(applyInfo, path, 0, 2 * PageSize, readData.data()), VK_SUCCESS);
+    EXPECT_NE(verify_resource_data(applyInfo, path, 2 * PageSize, PageSize, readData.data() + 2 * PageSize), VK_SUCCESS);
+    EXPECT_EQ(verify_resource_data(applyInfo, path, 3 * PageSize, DataSize - 3 * PageSize, readData.data() + 3 * PageSize), VK_SUCCESS);
+}
+
+TEST(ResourceData, MissingHashReported)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    TestDirectory testDirectory;
+    auto path = testDirectory.get_path() / "VkBuffer" / "0x0000000000000001.data";
+    std::vector<uint8_t> data;
+    write_test_resource_data(testDirectory.get_path(), path, data);
+    auto hashPath = path;
+    ASSERT_TRUE(std::filesystem::remove(hashPath.replace_extension("hash")));
+
+    auto applyInfo = get_test_apply_info(testDirectory.get_path());
+    std::vector<uint8_t> readData(data.size());
+    ASSERT_EQ(read_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+    EXPECT_NE(verify_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+
+    // NOTE : Restore points created before ".hash" records were introduced don't
+    //  have a pageSize and can't be verified
+    applyInfo.header.pageSize = 0;
+    EXPECT_EQ(verify_resource_data(applyInfo, path, 0, DataSize, readData.data()), VK_SUCCESS);
+}
@@ -0,0 +1,84 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+/**
+gvk_result() asserts on failure unless the gvk::gPfnGvkResultScopeCallback
+returns VK_TRUE, tests that exercise failure paths install this callback so
+failures are reported through return values instead
+*/
+inline VkBool32 process_gvk_result_scope_failure(VkResult, const char*, const char*)
+{
+    return VK_TRUE;
+}
+
+/**
+Creates an empty directory for a test and removes it when the test completes
+*/
+class TestDirectory final
+{
+public:
+    TestDirectory()
+    {
+        const auto* pTestInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        auto name = std::string("gvk-restore-point.tests.") + pTestInfo->test_suite_name() + "." + pTestInfo->name();
+        name += "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        mPath = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(mPath);
+        std::filesystem::create_directories(mPath);
+    }
+
+    ~TestDirectory()
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(mPath, errorCode);
+    }
+
+    const std::filesystem::path& get_path() const
+    {
+        return mPath;
+    }
+
+private:
+    std::filesystem::path mPath;
+
+    TestDirectory(const TestDirectory&) = delete;
+    TestDirectory& operator=(const TestDirectory&) = delete;
+};
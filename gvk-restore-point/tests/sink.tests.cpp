@@ -0,0 +1,353 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "restore-point-test-utilities.hpp"
+#include "gvk-restore-point/sink.hpp"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gvk::restore_point;
+
+/**
+SinkWriter that records the calls it receives and optionally runs a callback
+before each call returns
+*/
+class TestSinkWriter final
+    : public SinkWriter
+{
+public:
+    class Call final
+    {
+    public:
+        SocketSinkWriter::MessageType type{ };
+        std::string key;
+        uint64_t dataOffset{ };
+        std::vector<uint8_t> data;
+    };
+
+    TestSinkWriter(std::vector<Call>* pCalls, std::function<VkResult(const Call&)> callback = { })
+        : mpCalls { pCalls }
+        , mCallback { callback }
+    {
+    }
+
+    VkResult begin_object(const std::string& key) override final
+    {
+        return record({ SocketSinkWriter::BeginObject, key, 0, { } });
+    }
+
+    VkResult write_chunk(const std::string& key, uint64_t dataOffset, uint64_t dataSize, const uint8_t* pData) override final
+    {
+        return record({ SocketSinkWriter::WriteChunk, key, dataOffset, std::vector<uint8_t>(pData, pData + dataSize) });
+    }
+
+    VkResult end_object(const std::string& key) override final
+    {
+        return record({ SocketSinkWriter::EndObject, key, 0, { } });
+    }
+
+    VkResult finalize() override final
+    {
+        return record({ SocketSinkWriter::Finalize, { }, 0, { } });
+    }
+
+private:
+    VkResult record(Call&& call)
+    {
+        auto vkResult = mCallback ? mCallback(call) : VK_SUCCESS;
+        mpCalls->push_back(std::move(call));
+        return vkResult;
+    }
+
+    std::vector<TestSinkWriter::Call>* mpCalls{ };
+    std::function<VkResult(const Call&)> mCallback;
+};
+
+TEST(Sink, WriteOrder)
+{
+    std::vector<TestSinkWriter::Call> calls;
+    std::shared_ptr<Sink> spSink;
+    ASSERT_EQ(Sink::create(std::make_unique<TestSinkWriter>(&calls), 0, &spSink), VK_SUCCESS);
+    const std::vector<uint8_t> Data { 0, 1, 2, 3, 4, 5, 6, 7 };
+    ASSERT_EQ(spSink->write_chunk("VkBuffer/0x1.data", 0, 4, Data.data()), VK_SUCCESS);
+    ASSERT_EQ(spSink->write_chunk("VkBuffer/0x1.data", 4, 4, Data.data() + 4), VK_SUCCESS);
+    EXPECT_EQ(spSink->get_size("VkBuffer/0x1.data"), Data.size());
+    ASSERT_EQ(spSink->write_object("VkBuffer/0x1.info", Data.size(), Data.data(), true), VK_SUCCESS);
+    std::vector<uint8_t> retained;
+    ASSERT_EQ(spSink->read_retained("VkBuffer/0x1.info", retained), VK_SUCCESS);
+    EXPECT_EQ(retained, Data);
+    ASSERT_EQ(spSink->finalize(), VK_SUCCESS);
+
+    // NOTE : Records that aren't explicitly ended are ended before finalize()
+    ASSERT_EQ(calls.size(), 8u);
+    EXPECT_EQ(calls[0].type, SocketSinkWriter::BeginObject);
+    EXPECT_EQ(calls[1].type, SocketSinkWriter::WriteChunk);
+    EXPECT_EQ(calls[1].dataOffset, 0u);
+    EXPECT_EQ(calls[2].type, SocketSinkWriter::WriteChunk);
+    EXPECT_EQ(calls[2].dataOffset, 4u);
+    EXPECT_EQ(calls[2].data, std::vector<uint8_t>(Data.begin() + 4, Data.end()));
+    EXPECT_EQ(calls[3].type, SocketSinkWriter::BeginObject);
+    EXPECT_EQ(calls[3].key, "VkBuffer/0x1.info");
+    EXPECT_EQ(calls[4].type, SocketSinkWriter::WriteChunk);
+    EXPECT_EQ(calls[5].type, SocketSinkWriter::EndObject);
+    EXPECT_EQ(calls[5].key, "VkBuffer/0x1.info");
+    EXPECT_EQ(calls[6].type, SocketSinkWriter::EndObject);
+    EXPECT_EQ(calls[6].key, "VkBuffer/0x1.data");
+    EXPECT_EQ(calls[7].type, SocketSinkWriter::Finalize);
+}
+
+TEST(Sink, Batches)
+{
+    // NOTE : Records written on other threads are collected in Batches and are
+    //  written in the order the Batches are pushed, not the order they're written
+    std::vector<TestSinkWriter::Call> calls;
+    std::shared_ptr<Sink> spSink;
+    ASSERT_EQ(Sink::create(std::make_unique<TestSinkWriter>(&calls), 0, &spSink), VK_SUCCESS);
+    const std::vector<uint8_t> Data { 0, 1, 2, 3 };
+    std::vector<Sink::Batch> batches(4);
+    for (size_t i = batches.size(); i--;) {
+        std::thread([&, i]()
+        {
+            spSink->begin_batch(&batches[i]);
+            spSink->write_object(std::to_string(i) + ".info", Data.size(), Data.data(), true);
+            spSink->end_batch();
+        }).join();
+    }
+    EXPECT_EQ(spSink->get_size("0.info"), Data.size());
+    std::vector<uint8_t> retained;
+    EXPECT_EQ(spSink->read_retained("0.info", retained), VK_SUCCESS);
+    EXPECT_EQ(retained, Data);
+    ASSERT_EQ(spSink->write_object("header", Data.size(), Data.data()), VK_SUCCESS);
+    for (auto& batch : batches) {
+        ASSERT_EQ(spSink->push_batch(std::move(batch)), VK_SUCCESS);
+    }
+    ASSERT_EQ(spSink->finalize(), VK_SUCCESS);
+    ASSERT_EQ(calls.size(), 3 * (batches.size() + 1) + 1);
+    EXPECT_EQ(calls[0].key, "header");
+    for (size_t i = 0; i < batches.size(); ++i) {
+        EXPECT_EQ(calls[3 * (i + 1)].type, SocketSinkWriter::BeginObject);
+        EXPECT_EQ(calls[3 * (i + 1)].key, std::to_string(i) + ".info");
+    }
+}
+
+TEST(Sink, Backpressure)
+{
+    // NOTE : The TestSinkWriter blocks in its first write_chunk() until released.
+    //  The Sink's writer thread has dequeued that chunk, so the next chunk is
+    //  queued, but that chunk puts the queue over budget so the chunk after it
+    //  has to wait until the TestSinkWriter is released.
+    const VkDeviceSize QueueBudget = 16;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool writing = false;
+    bool released = false;
+    auto callback = [&](const TestSinkWriter::Call& call)
+    {
+        if (call.type == SocketSinkWriter::WriteChunk && !call.dataOffset) {
+            std::unique_lock<std::mutex> lock(mutex);
+            writing = true;
+            condition.notify_all();
+            condition.wait(lock, [&]() { return released; });
+        }
+        return VK_SUCCESS;
+    };
+    std::vector<TestSinkWriter::Call> calls;
+    std::shared_ptr<Sink> spSink;
+    ASSERT_EQ(Sink::create(std::make_unique<TestSinkWriter>(&calls, callback), QueueBudget, &spSink), VK_SUCCESS);
+    const std::vector<uint8_t> Data(QueueBudget, 7);
+    ASSERT_EQ(spSink->write_chunk("a.data", 0, Data.size(), Data.data()), VK_SUCCESS);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return writing; });
+    }
+    ASSERT_EQ(spSink->write_chunk("a.data", QueueBudget, Data.size(), Data.data()), VK_SUCCESS);
+    auto blockedWrite = std::async(std::launch::async, [&]() { return spSink->write_chunk("a.data", 2 * QueueBudget, Data.size(), Data.data()); });
+    EXPECT_EQ(blockedWrite.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+        condition.notify_all();
+    }
+    EXPECT_EQ(blockedWrite.get(), VK_SUCCESS);
+    ASSERT_EQ(spSink->finalize(), VK_SUCCESS);
+    EXPECT_EQ(spSink->get_size("a.data"), 3 * QueueBudget);
+}
+
+TEST(Sink, WriterErrorReturnedFromFinalize)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    // NOTE : Once the SinkWriter fails every subsequent call reports the failure
+    //  and records that were queued after it are discarded
+    std::vector<TestSinkWriter::Call> calls;
+    auto callback = [&](const TestSinkWriter::Call& call)
+    {
+        return call.type == SocketSinkWriter::WriteChunk && call.key == "b.data" ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS;
+    };
+    std::shared_ptr<Sink> spSink;
+    ASSERT_EQ(Sink::create(std::make_unique<TestSinkWriter>(&calls, callback), 0, &spSink), VK_SUCCESS);
+    const std::vector<uint8_t> Data(8, 3);
+    ASSERT_EQ(spSink->write_object("a.data", Data.size(), Data.data()), VK_SUCCESS);
+    spSink->write_object("b.data", Data.size(), Data.data());
+    spSink->write_object("c.data", Data.size(), Data.data());
+    EXPECT_EQ(spSink->finalize(), VK_ERROR_OUT_OF_HOST_MEMORY);
+    EXPECT_EQ(spSink->finalize(), VK_ERROR_OUT_OF_HOST_MEMORY);
+    EXPECT_EQ(spSink->write_object("d.data", Data.size(), Data.data()), VK_ERROR_OUT_OF_HOST_MEMORY);
+    for (const auto& call : calls) {
+        EXPECT_NE(call.key, "c.data");
+        EXPECT_NE(call.type, SocketSinkWriter::Finalize);
+    }
+}
+
+TEST(Sink, DirectorySinkWriterChunks)
+{
+    // NOTE : Chunks are written in place at their offsets into the file opened by
+    //  begin_object(), beginning a record again replaces its previous contents
+    TestDirectory testDirectory;
+    DirectorySinkWriter directorySinkWriter(testDirectory.get_path());
+    const std::vector<uint8_t> Data { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const std::string Key = "VkBuffer/0x1.data";
+    auto read_file = [&]()
+    {
+        std::ifstream file(testDirectory.get_path() / Key, std::ios::binary);
+        return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+    ASSERT_EQ(directorySinkWriter.begin_object(Key), VK_SUCCESS);
+    ASSERT_EQ(directorySinkWriter.write_chunk(Key, 4, 4, Data.data() + 4), VK_SUCCESS);
+    ASSERT_EQ(directorySinkWriter.write_chunk(Key, 0, 4, Data.data()), VK_SUCCESS);
+    ASSERT_EQ(directorySinkWriter.end_object(Key), VK_SUCCESS);
+    EXPECT_EQ(read_file(), Data);
+    ASSERT_EQ(directorySinkWriter.begin_object(Key), VK_SUCCESS);
+    ASSERT_EQ(directorySinkWriter.write_chunk(Key, 0, 2, Data.data()), VK_SUCCESS);
+    ASSERT_EQ(directorySinkWriter.finalize(), VK_SUCCESS);
+    EXPECT_EQ(read_file(), std::vector<uint8_t>(Data.begin(), Data.begin() + 2));
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+TEST(Sink, SocketSinkWriterFraming)
+{
+    gvk::gPfnGvkResultScopeCallback = process_gvk_result_scope_failure;
+    TestDirectory testDirectory;
+    auto address = (testDirectory.get_path() / "sink.socket").string();
+    sockaddr_un socketAddress { };
+    socketAddress.sun_family = AF_UNIX;
+    ASSERT_LT(address.size(), sizeof(socketAddress.sun_path));
+    memcpy(socketAddress.sun_path, address.c_str(), address.size());
+    auto listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_NE(listener, -1);
+    ASSERT_EQ(bind(listener, (const sockaddr*)&socketAddress, sizeof(socketAddress)), 0);
+    ASSERT_EQ(listen(listener, 1), 0);
+
+    // Collect everything written to the socket until the SocketSinkWriter closes it
+    auto received = std::async(std::launch::async,
+        [listener]()
+        {
+            std::vector<uint8_t> bytes;
+            auto connection = accept(listener, nullptr, nullptr);
+            if (connection != -1) {
+                uint8_t buffer[256];
+                for (auto size = recv(connection, buffer, sizeof(buffer), 0); 0 < size; size = recv(connection, buffer, sizeof(buffer), 0)) {
+                    bytes.insert(bytes.end(), buffer, buffer + size);
+                }
+                close(connection);
+            }
+            return bytes;
+        }
+    );
+    std::unique_ptr<SinkWriter> upSinkWriter;
+    ASSERT_EQ(SocketSinkWriter::create(address, &upSinkWriter), VK_SUCCESS);
+    std::shared_ptr<Sink> spSink;
+    ASSERT_EQ(Sink::create(std::move(upSinkWriter), 0, &spSink), VK_SUCCESS);
+    const std::vector<uint8_t> Data { 1, 2, 3, 4, 5 };
+    ASSERT_EQ(spSink->begin_object("key"), VK_SUCCESS);
+    ASSERT_EQ(spSink->write_chunk("key", 0, Data.size(), Data.data()), VK_SUCCESS);
+    ASSERT_EQ(spSink->end_object("key"), VK_SUCCESS);
+    ASSERT_EQ(spSink->finalize(), VK_SUCCESS);
+    auto bytes = received.get();
+    close(listener);
+
+    // Parse the stream
+    size_t offset = 0;
+    auto read = [&](void* pData, size_t size)
+    {
+        if (bytes.size() - offset < size) {
+            return false;
+        }
+        if (size) {
+            memcpy(pData, bytes.data() + offset, size);
+            offset += size;
+        }
+        return true;
+    };
+    uint64_t magic = 0;
+    uint64_t version = 0;
+    ASSERT_TRUE(read(&magic, sizeof(magic)));
+    ASSERT_TRUE(read(&version, sizeof(version)));
+    EXPECT_EQ(magic, 0x4b4e4953524b5647u); // "GVKRSINK"
+    EXPECT_EQ(version, 1u);
+    std::vector<TestSinkWriter::Call> messages;
+    while (offset < bytes.size()) {
+        uint32_t type = 0;
+        uint32_t keySize = 0;
+        uint64_t dataOffset = 0;
+        uint64_t dataSize = 0;
+        ASSERT_TRUE(read(&type, sizeof(type)));
+        ASSERT_TRUE(read(&keySize, sizeof(keySize)));
+        ASSERT_TRUE(read(&dataOffset, sizeof(dataOffset)));
+        ASSERT_TRUE(read(&dataSize, sizeof(dataSize)));
+        TestSinkWriter::Call message { (SocketSinkWriter::MessageType)type, std::string(keySize, '\0'), dataOffset, std::vector<uint8_t>((size_t)dataSize) };
+        ASSERT_TRUE(read(message.key.data(), keySize));
+        ASSERT_TRUE(read(message.data.data(), (size_t)dataSize));
+        messages.push_back(std::move(message));
+    }
+    ASSERT_EQ(messages.size(), 4u);
+    EXPECT_EQ((uint32_t)messages[0].type, 1u);
+    EXPECT_EQ(messages[0].key, "key");
+    EXPECT_EQ((uint32_t)messages[1].type, 2u);
+    EXPECT_EQ(messages[1].key, "key");
+    EXPECT_EQ(messages[1].dataOffset, 0u);
+    EXPECT_EQ(messages[1].data, Data);
+    EXPECT_EQ((uint32_t)messages[2].type, 3u);
+    EXPECT_EQ(messages[2].key, "key");
+    EXPECT_EQ((uint32_t)messages[3].type, 4u);
+    EXPECT_TRUE(messages[3].key.empty());
+    EXPECT_TRUE(messages[3].data.empty());
+}
+#endif
@@ -49,6 +49,7 @@ public:
 private:
     static void generate_header(FileGenerator& file, const xml::Manifest& manifest)
     {
+        file << "#include \"gvk-state-tracker/cmd-arena.hpp\"" << std::endl;
         file << "#include \"gvk-state-tracker/device-address-tracker.hpp\"" << std::endl;
         file << "#include \"gvk-state-tracker/image-layout-tracker.hpp\"" << std::endl;
         file << "#include \"gvk-structures/auto.hpp\"" << std::endl;
@@ -76,6 +77,7 @@ private:
         file << std::endl;
         file << "protected:" << std::endl;
         file << "    std::vector<const GvkCommandBaseStructure*> mCmds;" << std::endl;
+        file << "    CmdArena mCmdArena;" << std::endl;
         file << "    BasicCmdTracker(const BasicCmdTracker&) = delete;" << std::endl;
         file << "    BasicCmdTracker& operator=(const BasicCmdTracker&) = delete;" << std::endl;
         file << "};" << std::endl;
@@ -112,34 +114,18 @@ private:
                         file << "    cmd." << parameter.name << " = " << parameter.name << ";" << std::endl;
                     }
                 }
-                file << "    mCmds.push_back((const GvkCommandBaseStructure*)detail::create_dynamic_array_copy(1, &cmd, nullptr));" << std::endl;
+                file << "    mCmds.push_back((const GvkCommandBaseStructure*)detail::create_dynamic_array_copy(1, &cmd, mCmdArena.get_allocation_callbacks()));" << std::endl;
                 file << "}" << std::endl;
             }
         }
+        file << std::endl;
         file << "void BasicCmdTracker::reset()" << std::endl;
         file << "{" << std::endl;
-        file << "    for (auto pCmd : mCmds) {" << std::endl;
-        file << "        assert(pCmd);" << std::endl;
-        file << "        switch (pCmd->sType) {" << std::endl;
-        for (const auto& commandItr : manifest.commands) {
-            const auto& command = commandItr.second;
-            if (command.type == xml::Command::Type::Cmd) {
-                CompileGuardGenerator compileGuardGenerator(file, command.compileGuards);
-                std::string sType = "GVK_COMMAND_STRUCTURE_TYPE";
-                for (const auto& token : string::split_camel_case(string::strip_vk(command.name))) {
-                    sType += "_" + string::to_upper(token);
-                }
-                file << "        case " << sType << ": {" << std::endl;
-                file << "            detail::destroy_dynamic_array_copy(1, (const GvkCommandStructure" << string::strip_vk(command.name) << "*)pCmd, nullptr);" << std::endl;
-                file << "        } break;" << std::endl;
-            }
-        }
-        file << "        default: {" << std::endl;
-        file << "            assert(false && \"Unsupported GvkCommandStructureType\");" << std::endl;
-        file << "        } break;" << std::endl;
-        file << "        }" << std::endl;
-        file << "        mCmds.clear();" << std::endl;
-        file << "    }" << std::endl;
+        file << "    // NOTE : Recorded cmds are allocated from mCmdArena, they don't own any" << std::endl;
+        file << "    //  resources other than memory so they're released by rewinding mCmdArena" << std::endl;
+        file << "    //  rather than being destroyed individually..." << std::endl;
+        file << "    mCmds.clear();" << std::endl;
+        file << "    mCmdArena.reset();" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
     }
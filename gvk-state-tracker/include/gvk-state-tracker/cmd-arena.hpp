@@ -0,0 +1,80 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/detail/bump-allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace gvk {
+namespace state_tracker {
+
+/**
+Provides a bump allocator exposed through VkAllocationCallbacks
+    @note Frees are ignored, memory is reclaimed all at once when the CmdArena is reset
+    @note Blocks are retained across resets so steady state recording doesn't allocate
+    @note CmdArena is not thread safe, it's expected to be owned by a single VkCommandBuffer
+*/
+class CmdArena final
+{
+public:
+    static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+    CmdArena();
+    const VkAllocationCallbacks* get_allocation_callbacks() const;
+    void* allocate(size_t size, size_t alignment);
+    void reset();
+    size_t get_allocated_size() const;
+    size_t get_capacity() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> upData;
+        size_t size { };
+    };
+
+    void select_block(size_t blockIndex);
+    static VKAPI_ATTR void* VKAPI_CALL allocation(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void VKAPI_CALL free(void* pUserData, void* pMemory);
+
+    VkAllocationCallbacks mAllocationCallbacks { };
+    std::vector<Block> mBlocks;
+    size_t mBlockIndex { };
+    detail::BumpAllocator mBumpAllocator;
+    size_t mAllocatedSize { };
+
+    CmdArena(const CmdArena&) = delete;
+    CmdArena& operator=(const CmdArena&) = delete;
+};
+
+} // namespace state_tracker
+} // namespace gvk
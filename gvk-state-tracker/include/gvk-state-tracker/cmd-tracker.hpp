@@ -115,8 +115,10 @@ public:
 
 private:
     void record_image_layout_transition(VkDevice device, VkImage image, const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout imageLayout);
+    void record_trace_rays_buffers(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress);
 
-    std::unordered_set<VkBuffer> mShaderBindingTableBuffers;
+    VkDevice mTraceRaysDevice { VK_NULL_HANDLE };
+    std::unordered_set<VkBuffer> mTraceRaysBuffers;
     std::unordered_map<VkImage, ImageLayoutTracker> mImageLayoutTrackers;
     std::vector<size_t> mBuildAccelerationStructureCmdIndices;
     Auto<GvkCommandStructureCmdBeginRenderPass> mBeginRenderPass;
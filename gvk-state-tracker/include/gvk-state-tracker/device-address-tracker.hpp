@@ -28,24 +28,46 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-defines.hpp"
 
-#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace gvk {
 namespace state_tracker {
 
+/**
+Tracks the VkDeviceAddress ranges of VkBuffer objects created on a VkDevice
+    @note Ranges are stored in a flat array sorted by VkDeviceAddress and treated as an implicit balanced interval tree so that interior addresses can be resolved in O(log n)
+    @note Lookups take a shared lock and may run concurrently with each other
+*/
 class DeviceAddressTracker final
 {
 public:
     void reset();
-    void add(VkBuffer buffer, VkDeviceAddress deviceAddress);
+    void add(VkBuffer buffer, VkDeviceAddress deviceAddress, VkDeviceSize size);
     void erase(VkBuffer buffer);
     VkDeviceAddress get_device_address(VkBuffer buffer) const;
     VkBuffer get_buffer(VkDeviceAddress deviceAddress) const;
+    VkBuffer find_containing_buffer(VkDeviceAddress deviceAddress) const;
+    void find_containing_buffers(uint32_t deviceAddressCount, const VkDeviceAddress* pDeviceAddresses, VkBuffer* pBuffers) const;
+    void get_overlapping_buffers(VkDeviceAddress deviceAddress, VkDeviceSize size, std::vector<VkBuffer>& buffers) const;
 
 private:
-    mutable std::mutex mMutex;
-    std::unordered_map<VkDeviceAddress, VkBuffer> mBuffers;
+    struct Range
+    {
+        VkDeviceAddress begin { };
+        VkDeviceAddress end { };
+        VkBuffer buffer { };
+    };
+
+    VkBuffer find_containing_buffer_unlocked(VkDeviceAddress deviceAddress) const;
+    void get_overlapping_buffers_unlocked(size_t begin, size_t end, VkDeviceAddress deviceAddress, VkDeviceAddress deviceAddressEnd, std::vector<VkBuffer>& buffers) const;
+    void erase_unlocked(VkBuffer buffer);
+    VkDeviceAddress update_max_ends(size_t begin, size_t end);
+
+    mutable std::shared_mutex mMutex;
+    std::vector<Range> mRanges;
+    std::vector<VkDeviceAddress> mMaxEnds;
     std::unordered_map<VkBuffer, VkDeviceAddress> mDeviceAddresses;
 };
 
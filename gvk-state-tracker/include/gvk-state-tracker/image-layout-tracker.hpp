@@ -33,6 +33,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace gvk {
 namespace state_tracker {
 
+/**
+Tracks the VkImageLayout of each VkImageSubresource of a VkImage
+    @note When every VkImageSubresource shares a VkImageLayout it's stored in O(1), when VkImageLayouts diverge they're
+        stored as runs of array layers whose VkImageSubresources share the same VkImageLayout per mip level
+    @note VK_IMAGE_LAYOUT_MAX_ENUM marks a VkImageSubresource whose VkImageLayout is unknown, ImageLayoutTrackers
+        constructed this way can be used to accumulate transitions that are later applied with merge()
+*/
 class ImageLayoutTracker final
 {
 public:
@@ -41,47 +48,57 @@ public:
     ImageLayoutTracker& operator=(const ImageLayoutTracker& other) = default;
     ImageLayoutTracker(uint32_t mipLevelCount, uint32_t arrayLayerCount, VkImageLayout initialLayout);
     const VkImageLayout& operator[](const VkImageSubresource& imageSubresource) const;
-    VkImageLayout& operator[](const VkImageSubresource& imageSubresource);
 
     uint32_t get_mip_level_count() const;
     uint32_t get_array_layer_count() const;
     uint32_t get_subresource_count() const;
-    void get_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout* pImageLayout);
+    uint32_t get_run_count() const;
+    bool is_uniform() const;
+    void get_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout* pImageLayout) const;
     void set_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout imageLayout);
 
+    /**
+    Applies the known VkImageLayouts from another ImageLayoutTracker to this ImageLayoutTracker
+        @param [in] other The ImageLayoutTracker to apply
+        @note VkImageSubresources in VK_IMAGE_LAYOUT_MAX_ENUM in the given ImageLayoutTracker are left unchanged
+        @note The given ImageLayoutTracker must have the same mip level and array layer counts as this ImageLayoutTracker
+    */
+    void merge(const ImageLayoutTracker& other);
+
     template <typename ProcessSubresourceImageLayoutFunctionType>
     inline void enumerate(const VkImageSubresourceRange& imageSubresourceRange, ProcessSubresourceImageLayoutFunctionType processSubresourceImageLayout) const
     {
-        if (imageSubresourceRange.levelCount && imageSubresourceRange.layerCount) {
-            uint32_t lastMipLevel = imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount - 1;
-            uint32_t lastArrayLAyer = imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount - 1;
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer <= lastArrayLAyer && arrayLayer < mArrayLayerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel <= lastMipLevel && mipLevel < mMipLevelCount; ++mipLevel) {
+        uint32_t baseMipLevel = 0;
+        uint32_t mipLevelEnd = 0;
+        uint32_t baseArrayLayer = 0;
+        uint32_t arrayLayerEnd = 0;
+        if (get_ranges(imageSubresourceRange, &baseMipLevel, &mipLevelEnd, &baseArrayLayer, &arrayLayerEnd)) {
+            auto run = mRunBaseArrayLayers.empty() ? 0 : find_run(baseArrayLayer);
+            for (uint32_t arrayLayer = baseArrayLayer; arrayLayer < arrayLayerEnd; ++arrayLayer) {
+                while (run + 1 < mRunBaseArrayLayers.size() && mRunBaseArrayLayers[run + 1] <= arrayLayer) {
+                    ++run;
+                }
+                for (uint32_t mipLevel = baseMipLevel; mipLevel < mipLevelEnd; ++mipLevel) {
                     VkImageSubresource imageSubresource { };
                     imageSubresource.mipLevel = mipLevel;
                     imageSubresource.arrayLayer = arrayLayer;
-                    processSubresourceImageLayout(imageSubresource, operator[](imageSubresource));
+                    processSubresourceImageLayout(imageSubresource, mRunBaseArrayLayers.empty() ? mImageLayout : mRunImageLayouts[run * mMipLevelCount + mipLevel]);
                 }
             }
         }
     }
 
-    template <typename ProcessSubresourceImageLayoutFunctionType>
-    inline void enumerate(const VkImageSubresourceRange& imageSubresourceRange, ProcessSubresourceImageLayoutFunctionType processSubresourceImageLayout)
-    {
-        const_cast<const ImageLayoutTracker*>(this)->enumerate(
-            imageSubresourceRange,
-            [&processSubresourceImageLayout](const VkImageSubresource& imageSubresource, const VkImageLayout& imageLayout)
-            {
-                processSubresourceImageLayout(imageSubresource, const_cast<VkImageLayout&>(imageLayout));
-            }
-        );
-    }
-
 private:
+    bool get_ranges(const VkImageSubresourceRange& imageSubresourceRange, uint32_t* pBaseMipLevel, uint32_t* pMipLevelEnd, uint32_t* pBaseArrayLayer, uint32_t* pArrayLayerEnd) const;
+    size_t find_run(uint32_t arrayLayer) const;
+    size_t split_run(uint32_t arrayLayer);
+    void coalesce_runs(size_t beginRun, size_t endRun);
+
     uint32_t mMipLevelCount { 0 };
     uint32_t mArrayLayerCount { 0 };
-    std::vector<VkImageLayout> mSubresourceImageLayouts;
+    VkImageLayout mImageLayout { VK_IMAGE_LAYOUT_UNDEFINED };
+    std::vector<uint32_t> mRunBaseArrayLayers;
+    std::vector<VkImageLayout> mRunImageLayouts;
 };
 
 } // namespace state_tracker
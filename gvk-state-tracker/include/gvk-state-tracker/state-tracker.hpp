@@ -121,6 +121,7 @@ public:
     VkResult pre_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage, VkResult gvkResult) override final;
     VkResult post_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage, VkResult gvkResult) override final;
     void post_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) override final;
+    VkResult post_vkTransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount, const VkHostImageLayoutTransitionInfoEXT* pTransitions, VkResult gvkResult) override final;
 
     ////////////////////////////////////////////////////////////////////////////////
     // Defined in /source/gvk-state-tracker/instance.cpp
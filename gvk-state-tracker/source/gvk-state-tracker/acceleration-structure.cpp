@@ -98,7 +98,6 @@ VkResult StateTracker::process_build_acceleration_structures(VkDevice device, Vk
     (void)ppBuildRangeInfos;
 
     const auto& deviceAddressTracker = Device(device).get<DeviceAddressTracker>();
-    (void)deviceAddressTracker;
     for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
         auto& buildGeometryInfo = pInfos[info_i];
         auto pBuildRangeInfo = ppBuildRangeInfos[info_i];
@@ -109,14 +108,17 @@ VkResult StateTracker::process_build_acceleration_structures(VkDevice device, Vk
         std::set<Buffer> buffers;
         auto getBuffer = [&](VkDeviceAddress deviceAddress)
         {
-            (void)deviceAddress;
-            #if 0
-            // TODO : Find VkBuffer using its device address and create dependency
-            Buffer buffer({ device, deviceAddressTracker.get_buffer(deviceAddress) });
-            if (buffer) {
-                buffers.insert(buffer);
+            // NOTE : Geometry data device addresses may point anywhere inside of a
+            //  VkBuffer, so the containing range is resolved rather than the base.
+            if (deviceAddress) {
+                auto vkBuffer = deviceAddressTracker.find_containing_buffer(deviceAddress);
+                if (vkBuffer) {
+                    Buffer buffer({ device, vkBuffer });
+                    if (buffer) {
+                        buffers.insert(buffer);
+                    }
+                }
             }
-            #endif
         };
 
         getBuffer(buildGeometryInfo.scratchData.deviceAddress);
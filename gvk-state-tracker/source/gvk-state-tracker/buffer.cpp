@@ -55,6 +55,13 @@ VkResult StateTracker::post_vkCreateBuffer(VkDevice device, const VkBufferCreate
 
 VkDeviceAddress StateTracker::post_vkGetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo, VkDeviceAddress gvkResult)
 {
+    assert(pInfo);
+    if (gvkResult) {
+        Buffer stateTrackedBuffer({ device, pInfo->buffer });
+        assert(stateTrackedBuffer);
+        const auto& bufferCreateInfo = stateTrackedBuffer.mReference.get_obj().mBufferCreateInfo;
+        Device(device).mReference.get_obj().mDeviceAddressTracker.add(pInfo->buffer, gvkResult, bufferCreateInfo->size);
+    }
     return BasicStateTracker::post_vkGetBufferDeviceAddress(device, pInfo, gvkResult);
 }
 
@@ -73,6 +80,7 @@ void StateTracker::post_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const
     if (buffer) {
         Buffer stateTrackedBuffer({ device, buffer });
         assert(stateTrackedBuffer);
+        Device(device).mReference.get_obj().mDeviceAddressTracker.erase(buffer);
         auto& bufferControlBlock = stateTrackedBuffer.mReference.get_obj();
         if (bufferControlBlock.mBindBufferMemoryInfo->sType == VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO) {
             if (!bufferControlBlock.mVkDeviceMemoryBindings.empty()) {
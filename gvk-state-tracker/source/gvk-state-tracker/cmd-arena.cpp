@@ -0,0 +1,111 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-state-tracker/cmd-arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace gvk {
+namespace state_tracker {
+
+CmdArena::CmdArena()
+{
+    mAllocationCallbacks.pUserData = this;
+    mAllocationCallbacks.pfnAllocation = allocation;
+    mAllocationCallbacks.pfnFree = free;
+}
+
+const VkAllocationCallbacks* CmdArena::get_allocation_callbacks() const
+{
+    return &mAllocationCallbacks;
+}
+
+void* CmdArena::allocate(size_t size, size_t alignment)
+{
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    assert(!(alignment & (alignment - 1)) && "CmdArena alignment must be a power of two");
+    size = std::max(size, (size_t)1);
+    while (mBlockIndex < mBlocks.size()) {
+        auto pMemory = mBumpAllocator.allocate(size, alignment);
+        if (pMemory) {
+            mAllocatedSize += size;
+            return pMemory;
+        }
+        select_block(mBlockIndex + 1);
+    }
+
+    // NOTE : No retained block can service this allocation, so a new block is
+    //  added.  Blocks are never smaller than DefaultBlockSize and are sized to
+    //  guarantee that the requested alignment can be satisfied...
+    Block block { };
+    block.size = std::max(DefaultBlockSize, size + alignment);
+    block.upData.reset(new uint8_t[block.size]);
+    mBlocks.push_back(std::move(block));
+    select_block(mBlocks.size() - 1);
+    return allocate(size, alignment);
+}
+
+void CmdArena::reset()
+{
+    select_block(0);
+    mAllocatedSize = 0;
+}
+
+size_t CmdArena::get_allocated_size() const
+{
+    return mAllocatedSize;
+}
+
+size_t CmdArena::get_capacity() const
+{
+    size_t capacity = 0;
+    for (const auto& block : mBlocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void CmdArena::select_block(size_t blockIndex)
+{
+    mBlockIndex = blockIndex;
+    mBumpAllocator = mBlockIndex < mBlocks.size() ?
+        detail::BumpAllocator(mBlocks[mBlockIndex].upData.get(), mBlocks[mBlockIndex].size) :
+        detail::BumpAllocator();
+}
+
+VKAPI_ATTR void* VKAPI_CALL CmdArena::allocation(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope)
+{
+    assert(pUserData);
+    return ((CmdArena*)pUserData)->allocate(size, alignment);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdArena::free(void*, void*)
+{
+}
+
+} // namespace state_tracker
+} // namespace gvk
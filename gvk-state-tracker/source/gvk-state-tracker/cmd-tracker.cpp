@@ -28,13 +28,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-state-tracker/cmd-tracker.hpp"
 #include "gvk-structures/get-stype.hpp"
 
+#include <array>
+#include <vector>
+
 namespace gvk {
 namespace state_tracker {
 
 void CmdTracker::reset()
 {
     BasicCmdTracker::reset();
-    mShaderBindingTableBuffers.clear();
+    mTraceRaysDevice = VK_NULL_HANDLE;
+    mTraceRaysBuffers.clear();
     mImageLayoutTrackers.clear();
     mBeginRenderPass.reset();
     mBeginRenderPass2.reset();
@@ -63,17 +67,11 @@ const std::vector<size_t>& CmdTracker::get_build_acceleration_sturcture_cmd_indi
 
 void CmdTracker::enumerate_dependencies(PFN_gvkEnumerateStateTrackedObjectsCallback pfnCallback, void* pUserData) const
 {
-    CommandBuffer commandBuffer;
-    if (mBeginRenderPass->sType == get_stype<GvkCommandStructureCmdBeginRenderPass>()) {
-        commandBuffer = mBeginRenderPass->commandBuffer;
-    } else if (mBeginRenderPass2->sType == get_stype<GvkCommandStructureCmdBeginRenderPass2>()) {
-        commandBuffer = mBeginRenderPass2->commandBuffer;
-    }
-    if (commandBuffer) {
-        const auto& device = commandBuffer.get<Device>();
-        for (const auto& buffer : mShaderBindingTableBuffers) {
-            Buffer({ device, buffer }).enumerate_dependencies(pfnCallback, pUserData);
-        }
+    // NOTE : Buffers referenced by device address in vkCmdTraceRays*() aren't bound
+    //  to the VkCommandBuffer, so they're enumerated as dependencies here whether
+    //  or not the rays are traced in a render pass
+    for (const auto& buffer : mTraceRaysBuffers) {
+        Buffer({ mTraceRaysDevice, buffer }).enumerate_dependencies(pfnCallback, pUserData);
     }
 }
 
@@ -424,24 +422,22 @@ void CmdTracker::record_vkCmdBuildAccelerationStructuresKHR(VkCommandBuffer comm
 // RayTracing Cmds
 void CmdTracker::record_vkCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress)
 {
-    (void)commandBuffer;
-    (void)indirectDeviceAddress;
-    assert(false && "Unserviced vkCmd; gvk maintenance required");
+    // NOTE : The shader binding tables for vkCmdTraceRaysIndirect2KHR() are read
+    //  from the indirect buffer when the cmd executes, so only the indirect buffer
+    //  can be resolved when the cmd is recorded
+    record_trace_rays_buffers(commandBuffer, nullptr, nullptr, nullptr, nullptr, indirectDeviceAddress);
+    BasicCmdTracker::record_vkCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
 }
 
 void CmdTracker::record_vkCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress)
 {
-    (void)commandBuffer;
-    (void)pRaygenShaderBindingTable;
-    (void)pMissShaderBindingTable;
-    (void)pHitShaderBindingTable;
-    (void)pCallableShaderBindingTable;
-    (void)indirectDeviceAddress;
-    assert(false && "Unserviced vkCmd; gvk maintenance required");
+    record_trace_rays_buffers(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+    BasicCmdTracker::record_vkCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
 }
 
 void CmdTracker::record_vkCmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth)
 {
+    record_trace_rays_buffers(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, 0);
     BasicCmdTracker::record_vkCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
 }
 
@@ -450,15 +446,48 @@ void CmdTracker::record_vkCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint3
     record_vkCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
 }
 
+void CmdTracker::record_trace_rays_buffers(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress)
+{
+    // NOTE : Each shader binding table must be contained in a single VkBuffer, so
+    //  the VkBuffer containing its first address is the only one it references
+    CommandBuffer gvkCommandBuffer(commandBuffer);
+    assert(gvkCommandBuffer);
+    const auto& device = gvkCommandBuffer.get<Device>();
+    assert(!mTraceRaysDevice || mTraceRaysDevice == device.get<VkDevice>());
+    mTraceRaysDevice = device.get<VkDevice>();
+    const auto& deviceAddressTracker = device.get<DeviceAddressTracker>();
+    std::array<VkDeviceAddress, 4> deviceAddresses {
+        pRaygenShaderBindingTable ? pRaygenShaderBindingTable->deviceAddress : 0,
+        pMissShaderBindingTable ? pMissShaderBindingTable->deviceAddress : 0,
+        pHitShaderBindingTable ? pHitShaderBindingTable->deviceAddress : 0,
+        pCallableShaderBindingTable ? pCallableShaderBindingTable->deviceAddress : 0,
+    };
+    std::array<VkBuffer, 4> buffers { };
+    deviceAddressTracker.find_containing_buffers((uint32_t)deviceAddresses.size(), deviceAddresses.data(), buffers.data());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        if (deviceAddresses[i] && buffers[i]) {
+            mTraceRaysBuffers.insert(buffers[i]);
+        }
+    }
+    if (indirectDeviceAddress) {
+        auto indirectBuffer = deviceAddressTracker.find_containing_buffer(indirectDeviceAddress);
+        if (indirectBuffer) {
+            mTraceRaysBuffers.insert(indirectBuffer);
+        }
+    }
+}
+
 void CmdTracker::record_image_layout_transition(VkDevice device, VkImage image, const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout imageLayout)
 {
-    // TODO : Should be tracking image layout deltas, but currently writing all
-    //  subresource layouts on queue submission.
+    // NOTE : Only the transitions recorded in this VkCommandBuffer are tracked,
+    //  every other subresource is VK_IMAGE_LAYOUT_MAX_ENUM.  The transitions are
+    //  merged with the VkImage's ImageLayoutTracker on queue submission.
     auto imageLayoutTrackerItr = mImageLayoutTrackers.find(image);
     if (imageLayoutTrackerItr == mImageLayoutTrackers.end()) {
         Image gvkImage({ device, image });
         assert(gvkImage);
-        imageLayoutTrackerItr = mImageLayoutTrackers.insert({ image, gvkImage.get<ImageLayoutTracker>() }).first;
+        const auto& imageLayoutTracker = gvkImage.get<ImageLayoutTracker>();
+        imageLayoutTrackerItr = mImageLayoutTrackers.insert({ image, ImageLayoutTracker(imageLayoutTracker.get_mip_level_count(), imageLayoutTracker.get_array_layer_count(), VK_IMAGE_LAYOUT_MAX_ENUM) }).first;
     }
     imageLayoutTrackerItr->second.set_image_layouts(imageSubresourceRange, imageLayout);
 }
@@ -26,47 +26,197 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-state-tracker/device-address-tracker.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
 namespace gvk {
 namespace state_tracker {
 
+/*
+
+    Ranges are sorted by begin address and treated as an implicit balanced binary
+    tree...the root of the subtree covering mRanges[begin, end) is the range at
+    begin + (end - begin) / 2.  Since VkBuffers that alias the same VkDeviceMemory
+    may have overlapping ranges, mMaxEnds[i] stores the greatest end address in
+    the subtree rooted at mRanges[i].  A search skips any subtree whose greatest
+    end address is at or before the address being searched for...
+
+        mRanges  : [0x1000, 0x9000) [0x2000, 0x3000) [0x4000, 0x5000)
+        mMaxEnds :  0x9000           0x9000           0x5000
+
+        find_containing_buffer(0x6000) checks [0x2000, 0x3000), then descends
+        into the left subtree since its greatest end address (0x9000) is after
+        0x6000 and finds [0x1000, 0x9000)
+
+    If a subtree's left child has a greatest end address after the address, the
+    left child contains the range that ends there, if that range begins after
+    the address then every range in the right child does as well.  So only one
+    path is searched and lookups are O(log n).
+
+*/
+
 void DeviceAddressTracker::reset()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    mBuffers.clear();
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    mRanges.clear();
+    mMaxEnds.clear();
     mDeviceAddresses.clear();
 }
 
-void DeviceAddressTracker::add(VkBuffer buffer, VkDeviceAddress deviceAddress)
+void DeviceAddressTracker::add(VkBuffer buffer, VkDeviceAddress deviceAddress, VkDeviceSize size)
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    mBuffers[deviceAddress] = buffer;
+    assert(buffer);
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    auto deviceAddressItr = mDeviceAddresses.find(buffer);
+    if (deviceAddressItr != mDeviceAddresses.end()) {
+        // NOTE : vkGetBufferDeviceAddress() may be called any number of times for
+        //  a given VkBuffer, it always returns the same VkDeviceAddress...
+        if (deviceAddressItr->second == deviceAddress) {
+            return;
+        }
+        erase_unlocked(buffer);
+    }
+    Range range { };
+    range.begin = deviceAddress;
+    range.end = deviceAddress + std::max(size, (VkDeviceSize)1);
+    range.buffer = buffer;
+    auto rangeItr = std::upper_bound(mRanges.begin(), mRanges.end(), range,
+        [](const Range& lhs, const Range& rhs)
+        {
+            return lhs.begin < rhs.begin;
+        }
+    );
+    mRanges.insert(rangeItr, range);
+    mMaxEnds.resize(mRanges.size());
+    update_max_ends(0, mRanges.size());
     mDeviceAddresses[buffer] = deviceAddress;
 }
 
 void DeviceAddressTracker::erase(VkBuffer buffer)
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    auto deviceAddressItr = mDeviceAddresses.find(buffer);
-    if (deviceAddressItr != mDeviceAddresses.end()) {
-        auto bufferItr = mBuffers.find(deviceAddressItr->second);
-        assert(bufferItr != mBuffers.end());
-        mBuffers.erase(bufferItr);
-        mDeviceAddresses.erase(deviceAddressItr);
-    }
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    erase_unlocked(buffer);
 }
 
 VkDeviceAddress DeviceAddressTracker::get_device_address(VkBuffer buffer) const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
+    std::shared_lock<std::shared_mutex> lock(mMutex);
     auto deviceAddressItr = mDeviceAddresses.find(buffer);
     return deviceAddressItr != mDeviceAddresses.end() ? deviceAddressItr->second : VkDeviceAddress{ };
 }
 
 VkBuffer DeviceAddressTracker::get_buffer(VkDeviceAddress deviceAddress) const
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    auto bufferItr = mBuffers.find(deviceAddress);
-    return bufferItr != mBuffers.end() ? bufferItr->second : VkBuffer{ };
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    auto rangeItr = std::lower_bound(mRanges.begin(), mRanges.end(), deviceAddress,
+        [](const Range& range, VkDeviceAddress deviceAddress)
+        {
+            return range.begin < deviceAddress;
+        }
+    );
+    return rangeItr != mRanges.end() && rangeItr->begin == deviceAddress ? rangeItr->buffer : VkBuffer{ };
+}
+
+VkBuffer DeviceAddressTracker::find_containing_buffer(VkDeviceAddress deviceAddress) const
+{
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return find_containing_buffer_unlocked(deviceAddress);
+}
+
+void DeviceAddressTracker::find_containing_buffers(uint32_t deviceAddressCount, const VkDeviceAddress* pDeviceAddresses, VkBuffer* pBuffers) const
+{
+    assert(!deviceAddressCount || pDeviceAddresses);
+    assert(!deviceAddressCount || pBuffers);
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    for (uint32_t i = 0; i < deviceAddressCount; ++i) {
+        pBuffers[i] = find_containing_buffer_unlocked(pDeviceAddresses[i]);
+    }
+}
+
+void DeviceAddressTracker::get_overlapping_buffers(VkDeviceAddress deviceAddress, VkDeviceSize size, std::vector<VkBuffer>& buffers) const
+{
+    buffers.clear();
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    get_overlapping_buffers_unlocked(0, mRanges.size(), deviceAddress, deviceAddress + std::max(size, (VkDeviceSize)1), buffers);
+}
+
+VkBuffer DeviceAddressTracker::find_containing_buffer_unlocked(VkDeviceAddress deviceAddress) const
+{
+    size_t begin = 0;
+    size_t end = mRanges.size();
+    while (begin < end) {
+        auto index = begin + (end - begin) / 2;
+        if (mMaxEnds[index] <= deviceAddress) {
+            break;
+        }
+        const auto& range = mRanges[index];
+        if (range.begin <= deviceAddress && deviceAddress < range.end) {
+            return range.buffer;
+        }
+        if (begin < index && deviceAddress < mMaxEnds[begin + (index - begin) / 2]) {
+            end = index;
+        } else if (range.begin <= deviceAddress) {
+            begin = index + 1;
+        } else {
+            break;
+        }
+    }
+    return VkBuffer{ };
+}
+
+void DeviceAddressTracker::get_overlapping_buffers_unlocked(size_t begin, size_t end, VkDeviceAddress deviceAddress, VkDeviceAddress deviceAddressEnd, std::vector<VkBuffer>& buffers) const
+{
+    if (begin < end) {
+        auto index = begin + (end - begin) / 2;
+        if (deviceAddress < mMaxEnds[index]) {
+            get_overlapping_buffers_unlocked(begin, index, deviceAddress, deviceAddressEnd, buffers);
+            const auto& range = mRanges[index];
+            if (range.begin < deviceAddressEnd) {
+                if (deviceAddress < range.end) {
+                    buffers.push_back(range.buffer);
+                }
+                get_overlapping_buffers_unlocked(index + 1, end, deviceAddress, deviceAddressEnd, buffers);
+            }
+        }
+    }
+}
+
+void DeviceAddressTracker::erase_unlocked(VkBuffer buffer)
+{
+    auto deviceAddressItr = mDeviceAddresses.find(buffer);
+    if (deviceAddressItr != mDeviceAddresses.end()) {
+        auto rangeItr = std::lower_bound(mRanges.begin(), mRanges.end(), deviceAddressItr->second,
+            [](const Range& range, VkDeviceAddress deviceAddress)
+            {
+                return range.begin < deviceAddress;
+            }
+        );
+        while (rangeItr != mRanges.end() && rangeItr->buffer != buffer) {
+            ++rangeItr;
+        }
+        assert(rangeItr != mRanges.end());
+        mRanges.erase(rangeItr);
+        mMaxEnds.resize(mRanges.size());
+        update_max_ends(0, mRanges.size());
+        mDeviceAddresses.erase(deviceAddressItr);
+    }
+}
+
+VkDeviceAddress DeviceAddressTracker::update_max_ends(size_t begin, size_t end)
+{
+    // NOTE : The shape of the implicit tree depends on the number of ranges, so
+    //  every mMaxEnds entry is recomputed when a range is added or erased.  This is
+    //  O(n), the same as inserting into or erasing from mRanges.
+    assert(mRanges.size() == mMaxEnds.size());
+    if (begin == end) {
+        return VkDeviceAddress{ };
+    }
+    auto index = begin + (end - begin) / 2;
+    auto leftMaxEnd = update_max_ends(begin, index);
+    auto rightMaxEnd = update_max_ends(index + 1, end);
+    mMaxEnds[index] = std::max(mRanges[index].end, std::max(leftMaxEnd, rightMaxEnd));
+    return mMaxEnds[index];
 }
 
 } // namespace state_tracker
@@ -83,10 +83,18 @@ VkResult StateTracker::post_vkAllocateMemory(VkDevice device, const VkMemoryAllo
             assert(dispatchTableItr != layer::Registry::get().VkDeviceDispatchTables.end());
             const auto& dispatchTable = dispatchTableItr->second;
 
+            // NOTE : Auto<> places its deep members in a single allocation, so rather
+            //  than linking a separately allocated VkMemoryOpaqueCaptureAddressAllocateInfo
+            //  into the tracked VkMemoryAllocateInfo, it's recreated with one.
             if (!pMemoryOpaqueCaptureAddressAllocateInfo) {
-                pMemoryOpaqueCaptureAddressAllocateInfo = (VkMemoryOpaqueCaptureAddressAllocateInfo*)detail::create_pnext_copy(&get_default<VkMemoryOpaqueCaptureAddressAllocateInfo>(), nullptr);
-                pMemoryOpaqueCaptureAddressAllocateInfo->pNext = memoryAllocateInfo.pNext;
-                memoryAllocateInfo.pNext = pMemoryOpaqueCaptureAddressAllocateInfo;
+                auto memoryOpaqueCaptureAddressAllocateInfo = get_default<VkMemoryOpaqueCaptureAddressAllocateInfo>();
+                memoryOpaqueCaptureAddressAllocateInfo.pNext = memoryAllocateInfo.pNext;
+                auto updatedMemoryAllocateInfo = memoryAllocateInfo;
+                updatedMemoryAllocateInfo.pNext = &memoryOpaqueCaptureAddressAllocateInfo;
+                auto& trackedMemoryAllocateInfo = gvkDeviceMemory.mReference.get_obj().mMemoryAllocateInfo;
+                trackedMemoryAllocateInfo = updatedMemoryAllocateInfo;
+                pMemoryOpaqueCaptureAddressAllocateInfo = const_cast<VkMemoryOpaqueCaptureAddressAllocateInfo*>(detail::get_pnext_structure<VkMemoryOpaqueCaptureAddressAllocateInfo>(trackedMemoryAllocateInfo->pNext));
+                assert(pMemoryOpaqueCaptureAddressAllocateInfo);
             }
 
             auto deviceMemoryOpaqueCaptureAddressInfo = get_default<VkDeviceMemoryOpaqueCaptureAddressInfo>();
@@ -196,9 +204,16 @@ VkResult StateTracker::post_vkBindBufferMemory2(VkDevice device, uint32_t bindIn
                 auto pBufferOpaqueCaptureAddressCreateInfo = detail::get_pnext_structure<VkBufferOpaqueCaptureAddressCreateInfo>(bufferCreateInfo.pNext);
                 auto pMutableBufferOpaqueCaptureAddressCreateInfo = const_cast<VkBufferOpaqueCaptureAddressCreateInfo*>(pBufferOpaqueCaptureAddressCreateInfo);
                 if (!pMutableBufferOpaqueCaptureAddressCreateInfo) {
-                    pMutableBufferOpaqueCaptureAddressCreateInfo = (VkBufferOpaqueCaptureAddressCreateInfo*)detail::create_pnext_copy(&get_default<VkBufferOpaqueCaptureAddressCreateInfo>(), nullptr);
-                    pMutableBufferOpaqueCaptureAddressCreateInfo->pNext = bufferCreateInfo.pNext;
-                    bufferCreateInfo.pNext = pMutableBufferOpaqueCaptureAddressCreateInfo;
+                    // NOTE : See the NOTE in post_vkAllocateMemory(), the tracked
+                    //  VkBufferCreateInfo is recreated with the new pNext entry.
+                    auto bufferOpaqueCaptureAddressCreateInfo = get_default<VkBufferOpaqueCaptureAddressCreateInfo>();
+                    bufferOpaqueCaptureAddressCreateInfo.pNext = bufferCreateInfo.pNext;
+                    auto updatedBufferCreateInfo = bufferCreateInfo;
+                    updatedBufferCreateInfo.pNext = &bufferOpaqueCaptureAddressCreateInfo;
+                    auto& trackedBufferCreateInfo = gvkBuffer.mReference.get_obj().mBufferCreateInfo;
+                    trackedBufferCreateInfo = updatedBufferCreateInfo;
+                    pMutableBufferOpaqueCaptureAddressCreateInfo = const_cast<VkBufferOpaqueCaptureAddressCreateInfo*>(detail::get_pnext_structure<VkBufferOpaqueCaptureAddressCreateInfo>(trackedBufferCreateInfo->pNext));
+                    assert(pMutableBufferOpaqueCaptureAddressCreateInfo);
                 }
 
                 auto bufferDeviceAddressInfo = get_default<VkBufferDeviceAddressInfo>();
@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-state-tracker/image-layout-tracker.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 namespace gvk {
@@ -33,41 +34,36 @@ namespace state_tracker {
 
 /*
 
-    The following layout is used when indexing individual VkImageSubresources.
-    To calculate a particular VkImageSubresource index:
-
-        imageSubresource.arrayLayer * mipLevelCount + imageSubresource.mipLevel
-
-    The following diagram illustrates the layout of an ImageLayoutTracker with 4
-    mip levels and 3 array layers:
-
-        0           1       2     3
-
-    0   +---------+ +-----+ +---+ +-+
-        |0        | |1    | |2  | +-+
-        |         | |     | +---+
-        |         | +-----+
-        |         |
-        +---------+
-    1   +---------+ +-----+ +---+ +-+
-        |4        | |5    | |6  | +-+
-        |         | |     | +---+
-        |         | +-----+
-        |         |
-        +---------+
-    2   +---------+ +-----+ +---+ +-+
-        |8        | |9    | |10 | +-+
-        |         | |     | +---+
-        |         | +-----+
-        |         |
-        +---------+
+    When every VkImageSubresource is in the same VkImageLayout, mRunBaseArrayLayers
+    is empty and mImageLayout holds the VkImageLayout for the entire VkImage.  When
+    VkImageLayouts diverge, array layers are grouped into runs.  Each run begins at
+    the array layer in mRunBaseArrayLayers and continues until the next run begins,
+    every array layer in a run shares the same VkImageLayout per mip level.  To
+    calculate a particular VkImageSubresource's VkImageLayout index:
+
+        run * mipLevelCount + imageSubresource.mipLevel
+
+    The following diagram illustrates an ImageLayoutTracker with 4 mip levels and
+    6 array layers after array layers 2 and 3 have had mip levels 0 and 1
+    transitioned...
+
+                 0 1 2 3
+        layer 0  A A A A    run 0 (base array layer 0) : A A A A
+        layer 1  A A A A
+        layer 2  B B A A    run 1 (base array layer 2) : B B A A
+        layer 3  B B A A
+        layer 4  A A A A    run 2 (base array layer 4) : A A A A
+        layer 5  A A A A
+
+    Adjacent runs with matching VkImageLayouts are coalesced after every update,
+    so a transition that covers the entire VkImage always returns it to O(1).
 
 */
 
 ImageLayoutTracker::ImageLayoutTracker(uint32_t mipLevelCount, uint32_t arrayLayerCount, VkImageLayout initialLayout)
     : mMipLevelCount { mipLevelCount }
     , mArrayLayerCount { arrayLayerCount }
-    , mSubresourceImageLayouts(mipLevelCount * arrayLayerCount, initialLayout)
+    , mImageLayout { initialLayout }
 {
     assert(mMipLevelCount);
     assert(mArrayLayerCount);
@@ -77,15 +73,12 @@ const VkImageLayout& ImageLayoutTracker::operator[](const VkImageSubresource& im
 {
     assert(imageSubresource.mipLevel < mMipLevelCount);
     assert(imageSubresource.arrayLayer < mArrayLayerCount);
-    auto index = imageSubresource.arrayLayer * mMipLevelCount + imageSubresource.mipLevel;
-    assert(index < mSubresourceImageLayouts.size());
-    return mSubresourceImageLayouts[index];
-}
-
-VkImageLayout& ImageLayoutTracker::operator[](const VkImageSubresource& imageSubresource)
-{
-    auto constThis = const_cast<const ImageLayoutTracker*>(this);
-    return const_cast<VkImageLayout&>(constThis->operator[](imageSubresource));
+    if (mRunBaseArrayLayers.empty()) {
+        return mImageLayout;
+    }
+    auto index = find_run(imageSubresource.arrayLayer) * mMipLevelCount + imageSubresource.mipLevel;
+    assert(index < mRunImageLayouts.size());
+    return mRunImageLayouts[index];
 }
 
 uint32_t ImageLayoutTracker::get_mip_level_count() const
@@ -100,14 +93,24 @@ uint32_t ImageLayoutTracker::get_array_layer_count() const
 
 uint32_t ImageLayoutTracker::get_subresource_count() const
 {
-    return (uint32_t)mSubresourceImageLayouts.size();
+    return mMipLevelCount * mArrayLayerCount;
+}
+
+uint32_t ImageLayoutTracker::get_run_count() const
+{
+    return mRunBaseArrayLayers.empty() ? 1 : (uint32_t)mRunBaseArrayLayers.size();
 }
 
-void ImageLayoutTracker::get_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout* pImageLayout)
+bool ImageLayoutTracker::is_uniform() const
+{
+    return mRunBaseArrayLayers.empty();
+}
+
+void ImageLayoutTracker::get_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout* pImageLayout) const
 {
     enumerate(
         imageSubresourceRange,
-        [&](const VkImageSubresource&, VkImageLayout& subresourceImageLayout)
+        [&](const VkImageSubresource&, const VkImageLayout& subresourceImageLayout)
         {
             *pImageLayout = subresourceImageLayout;
             ++pImageLayout;
@@ -117,13 +120,113 @@ void ImageLayoutTracker::get_image_layouts(const VkImageSubresourceRange& imageS
 
 void ImageLayoutTracker::set_image_layouts(const VkImageSubresourceRange& imageSubresourceRange, VkImageLayout imageLayout)
 {
-    enumerate(
-        imageSubresourceRange,
-        [&](const VkImageSubresource&, VkImageLayout& subresourceImageLayout)
-        {
-            subresourceImageLayout = imageLayout;
+    uint32_t baseMipLevel = 0;
+    uint32_t mipLevelEnd = 0;
+    uint32_t baseArrayLayer = 0;
+    uint32_t arrayLayerEnd = 0;
+    if (get_ranges(imageSubresourceRange, &baseMipLevel, &mipLevelEnd, &baseArrayLayer, &arrayLayerEnd)) {
+        // NOTE : Transitions that cover the entire VkImage are the common case, they
+        //  discard any runs and return the ImageLayoutTracker to O(1).
+        if (!baseMipLevel && mipLevelEnd == mMipLevelCount && !baseArrayLayer && arrayLayerEnd == mArrayLayerCount) {
+            mImageLayout = imageLayout;
+            mRunBaseArrayLayers.clear();
+            mRunImageLayouts.clear();
+            return;
         }
-    );
+        if (mRunBaseArrayLayers.empty()) {
+            if (mImageLayout == imageLayout) {
+                return;
+            }
+            mRunBaseArrayLayers.push_back(0);
+            mRunImageLayouts.assign(mMipLevelCount, mImageLayout);
+        }
+        auto beginRun = split_run(baseArrayLayer);
+        auto endRun = arrayLayerEnd < mArrayLayerCount ? split_run(arrayLayerEnd) : mRunBaseArrayLayers.size();
+        for (auto run = beginRun; run < endRun; ++run) {
+            auto pRunImageLayouts = &mRunImageLayouts[run * mMipLevelCount];
+            std::fill(pRunImageLayouts + baseMipLevel, pRunImageLayouts + mipLevelEnd, imageLayout);
+        }
+        coalesce_runs(beginRun ? beginRun - 1 : 0, endRun + 1);
+    }
+}
+
+void ImageLayoutTracker::merge(const ImageLayoutTracker& other)
+{
+    assert(mMipLevelCount == other.mMipLevelCount);
+    assert(mArrayLayerCount == other.mArrayLayerCount);
+    auto runCount = other.get_run_count();
+    for (uint32_t run = 0; run < runCount; ++run) {
+        VkImageSubresourceRange imageSubresourceRange { };
+        imageSubresourceRange.baseArrayLayer = other.mRunBaseArrayLayers.empty() ? 0 : other.mRunBaseArrayLayers[run];
+        imageSubresourceRange.layerCount = (run + 1 < runCount ? other.mRunBaseArrayLayers[run + 1] : mArrayLayerCount) - imageSubresourceRange.baseArrayLayer;
+        auto pRunImageLayouts = other.mRunBaseArrayLayers.empty() ? &other.mImageLayout : &other.mRunImageLayouts[run * mMipLevelCount];
+        auto runMipLevelCount = other.mRunBaseArrayLayers.empty() ? 1 : mMipLevelCount;
+        for (uint32_t mipLevel = 0; mipLevel < runMipLevelCount;) {
+            auto imageLayout = pRunImageLayouts[mipLevel];
+            uint32_t mipLevelEnd = mipLevel + 1;
+            while (mipLevelEnd < runMipLevelCount && pRunImageLayouts[mipLevelEnd] == imageLayout) {
+                ++mipLevelEnd;
+            }
+            if (imageLayout != VK_IMAGE_LAYOUT_MAX_ENUM) {
+                imageSubresourceRange.baseMipLevel = mipLevel;
+                imageSubresourceRange.levelCount = other.mRunBaseArrayLayers.empty() ? mMipLevelCount : mipLevelEnd - mipLevel;
+                set_image_layouts(imageSubresourceRange, imageLayout);
+            }
+            mipLevel = mipLevelEnd;
+        }
+    }
+}
+
+bool ImageLayoutTracker::get_ranges(const VkImageSubresourceRange& imageSubresourceRange, uint32_t* pBaseMipLevel, uint32_t* pMipLevelEnd, uint32_t* pBaseArrayLayer, uint32_t* pArrayLayerEnd) const
+{
+    assert(pBaseMipLevel);
+    assert(pMipLevelEnd);
+    assert(pBaseArrayLayer);
+    assert(pArrayLayerEnd);
+    if (imageSubresourceRange.baseMipLevel < mMipLevelCount && imageSubresourceRange.baseArrayLayer < mArrayLayerCount) {
+        *pBaseMipLevel = imageSubresourceRange.baseMipLevel;
+        *pMipLevelEnd = *pBaseMipLevel + std::min(imageSubresourceRange.levelCount, mMipLevelCount - *pBaseMipLevel);
+        *pBaseArrayLayer = imageSubresourceRange.baseArrayLayer;
+        *pArrayLayerEnd = *pBaseArrayLayer + std::min(imageSubresourceRange.layerCount, mArrayLayerCount - *pBaseArrayLayer);
+        return *pBaseMipLevel < *pMipLevelEnd && *pBaseArrayLayer < *pArrayLayerEnd;
+    }
+    return false;
+}
+
+size_t ImageLayoutTracker::find_run(uint32_t arrayLayer) const
+{
+    assert(!mRunBaseArrayLayers.empty());
+    assert(!mRunBaseArrayLayers.front());
+    auto runItr = std::upper_bound(mRunBaseArrayLayers.begin(), mRunBaseArrayLayers.end(), arrayLayer);
+    return (size_t)(runItr - mRunBaseArrayLayers.begin()) - 1;
+}
+
+size_t ImageLayoutTracker::split_run(uint32_t arrayLayer)
+{
+    auto run = find_run(arrayLayer);
+    if (mRunBaseArrayLayers[run] != arrayLayer) {
+        auto runImageLayoutsItr = mRunImageLayouts.begin() + run * mMipLevelCount;
+        mRunImageLayouts.insert(runImageLayoutsItr + mMipLevelCount, runImageLayoutsItr, runImageLayoutsItr + mMipLevelCount);
+        mRunBaseArrayLayers.insert(mRunBaseArrayLayers.begin() + ++run, arrayLayer);
+    }
+    return run;
+}
+
+void ImageLayoutTracker::coalesce_runs(size_t beginRun, size_t endRun)
+{
+    endRun = std::min(endRun, mRunBaseArrayLayers.size());
+    for (size_t run = endRun; run-- > beginRun + 1;) {
+        auto runImageLayoutsItr = mRunImageLayouts.begin() + run * mMipLevelCount;
+        if (std::equal(runImageLayoutsItr - mMipLevelCount, runImageLayoutsItr, runImageLayoutsItr)) {
+            mRunImageLayouts.erase(runImageLayoutsItr, runImageLayoutsItr + mMipLevelCount);
+            mRunBaseArrayLayers.erase(mRunBaseArrayLayers.begin() + run);
+        }
+    }
+    if (mRunBaseArrayLayers.size() == 1 && std::all_of(mRunImageLayouts.begin(), mRunImageLayouts.end(), [&](VkImageLayout imageLayout) { return imageLayout == mRunImageLayouts.front(); })) {
+        mImageLayout = mRunImageLayouts.front();
+        mRunBaseArrayLayers.clear();
+        mRunImageLayouts.clear();
+    }
 }
 
 } // namespace state_tracker
@@ -73,5 +73,20 @@ void StateTracker::post_vkDestroyImage(VkDevice device, VkImage image, const VkA
     BasicStateTracker::post_vkDestroyImage(device, image, pAllocator);
 }
 
+VkResult StateTracker::post_vkTransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount, const VkHostImageLayoutTransitionInfoEXT* pTransitions, VkResult gvkResult)
+{
+    // NOTE : Host transitions take effect immediately, so unlike barriers recorded
+    //  in VkCommandBuffers there's no need to wait for a VkQueue submission.
+    if (gvkResult == VK_SUCCESS && transitionCount && pTransitions) {
+        for (uint32_t transition_i = 0; transition_i < transitionCount; ++transition_i) {
+            const auto& transition = pTransitions[transition_i];
+            Image gvkImage({ device, transition.image });
+            assert(gvkImage);
+            gvkImage.mReference.get_obj().mImageLayoutTracker.set_image_layouts(transition.subresourceRange, transition.newLayout);
+        }
+    }
+    return gvkResult;
+}
+
 } // namespace state_tracker
 } // namespace gvk
@@ -59,7 +59,7 @@ VkResult StateTracker::post_vkQueueSubmit(VkQueue queue, uint32_t submitCount, c
                     for (const auto& imageLayoutTrackerItr : commandBufferControlBlock.mCmdTracker.get_image_layout_trackers()) {
                         auto imageReference = Image({ commandBufferControlBlock.mDevice, imageLayoutTrackerItr.first }).mReference;
                         assert(imageReference);
-                        imageReference.get_obj().mImageLayoutTracker = imageLayoutTrackerItr.second;
+                        imageReference.get_obj().mImageLayoutTracker.merge(imageLayoutTrackerItr.second);
                     }
                     #if 0 // TODO : Acceleration structure history
                     for (auto buildAcclerationStructureCmdIndex : commandBufferControlBlock.mCmdTracker.get_build_acceleration_sturcture_cmd_indices()) {
@@ -112,7 +112,7 @@ VkResult StateTracker::post_vkQueueSubmit2(VkQueue queue, uint32_t submitCount,
                     for (const auto& imageLayoutTrackerItr : commandBufferControlBlock.mCmdTracker.get_image_layout_trackers()) {
                         auto imageReference = Image({ commandBufferControlBlock.mDevice, imageLayoutTrackerItr.first }).mReference;
                         assert(imageReference);
-                        imageReference.get_obj().mImageLayoutTracker = imageLayoutTrackerItr.second;
+                        imageReference.get_obj().mImageLayoutTracker.merge(imageLayoutTrackerItr.second);
                     }
                     #if 0 // TODO : Acceleration structure history
                     for (auto buildAcclerationStructureCmdIndex : commandBufferControlBlock.mCmdTracker.get_build_acceleration_sturcture_cmd_indices()) {
@@ -325,7 +325,7 @@ namespace layer {
 
 void on_load(Registry& registry)
 {
-    registry.layers.push_back(std::make_unique<state_tracker::StateTracker>());
+    registry.add_layer<state_tracker::StateTracker>();
 }
 
 } // namespace layer
@@ -0,0 +1,165 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-state-tracker/device-address-tracker.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using gvk::state_tracker::DeviceAddressTracker;
+
+static VkBuffer get_test_buffer(uint64_t handle)
+{
+    return (VkBuffer)handle;
+}
+
+static std::vector<VkBuffer> get_sorted(std::vector<VkBuffer> buffers)
+{
+    std::sort(buffers.begin(), buffers.end());
+    return buffers;
+}
+
+TEST(DeviceAddressTracker, InteriorAddresses)
+{
+    DeviceAddressTracker deviceAddressTracker;
+    deviceAddressTracker.add(get_test_buffer(1), 0x1000, 0x1000);
+    deviceAddressTracker.add(get_test_buffer(2), 0x3000, 0x1000);
+    EXPECT_EQ(deviceAddressTracker.get_buffer(0x1000), get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.get_buffer(0x1004), VkBuffer{ });
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x0fff), VkBuffer{ });
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x1000), get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x1fff), get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x2000), VkBuffer{ });
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x3800), get_test_buffer(2));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x4000), VkBuffer{ });
+    EXPECT_EQ(deviceAddressTracker.get_device_address(get_test_buffer(2)), 0x3000u);
+    deviceAddressTracker.erase(get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x1800), VkBuffer{ });
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x3800), get_test_buffer(2));
+}
+
+TEST(DeviceAddressTracker, AliasedBuffers)
+{
+    // NOTE : VkBuffers bound to the same VkDeviceMemory at the same offset have the
+    //  same VkDeviceAddress, any of them may be returned for a shared address
+    DeviceAddressTracker deviceAddressTracker;
+    deviceAddressTracker.add(get_test_buffer(1), 0x1000, 0x1000);
+    deviceAddressTracker.add(get_test_buffer(2), 0x1000, 0x1000);
+    deviceAddressTracker.add(get_test_buffer(3), 0x1000, 0x4000);
+    auto buffer = deviceAddressTracker.find_containing_buffer(0x1800);
+    EXPECT_TRUE(buffer == get_test_buffer(1) || buffer == get_test_buffer(2) || buffer == get_test_buffer(3));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x3000), get_test_buffer(3));
+    std::vector<VkBuffer> buffers;
+    deviceAddressTracker.get_overlapping_buffers(0x1800, 0x100, buffers);
+    EXPECT_EQ(get_sorted(buffers), get_sorted({ get_test_buffer(1), get_test_buffer(2), get_test_buffer(3) }));
+    deviceAddressTracker.erase(get_test_buffer(3));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x3000), VkBuffer{ });
+    deviceAddressTracker.erase(get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x1800), get_test_buffer(2));
+}
+
+TEST(DeviceAddressTracker, OverlappingBuffers)
+{
+    // NOTE : A large VkBuffer that begins before several smaller VkBuffers must be
+    //  found for addresses past the end of the smaller VkBuffers
+    DeviceAddressTracker deviceAddressTracker;
+    deviceAddressTracker.add(get_test_buffer(1), 0x1000, 0x8000);
+    deviceAddressTracker.add(get_test_buffer(2), 0x2000, 0x1000);
+    deviceAddressTracker.add(get_test_buffer(3), 0x4000, 0x1000);
+    deviceAddressTracker.add(get_test_buffer(4), 0x8800, 0x1000);
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x6000), get_test_buffer(1));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x9400), get_test_buffer(4));
+    EXPECT_EQ(deviceAddressTracker.find_containing_buffer(0x9800), VkBuffer{ });
+    auto buffer = deviceAddressTracker.find_containing_buffer(0x2800);
+    EXPECT_TRUE(buffer == get_test_buffer(1) || buffer == get_test_buffer(2));
+    std::vector<VkBuffer> buffers;
+    deviceAddressTracker.get_overlapping_buffers(0x4800, 0x4001, buffers);
+    EXPECT_EQ(get_sorted(buffers), get_sorted({ get_test_buffer(1), get_test_buffer(3), get_test_buffer(4) }));
+    deviceAddressTracker.get_overlapping_buffers(0x3000, 0x1000, buffers);
+    EXPECT_EQ(get_sorted(buffers), get_sorted({ get_test_buffer(1) }));
+    deviceAddressTracker.get_overlapping_buffers(0x9800, 0x1000, buffers);
+    EXPECT_TRUE(buffers.empty());
+}
+
+TEST(DeviceAddressTracker, RandomBuffers)
+{
+    // Compare lookups against a linear search of randomly placed, overlapping
+    //  VkBuffers as VkBuffers are added and erased
+    struct TestBuffer
+    {
+        VkBuffer buffer{ };
+        VkDeviceAddress begin{ };
+        VkDeviceAddress end{ };
+    };
+    std::mt19937_64 random(0x5eed);
+    std::uniform_int_distribution<VkDeviceAddress> addressDistribution(0, 0x10000);
+    std::uniform_int_distribution<VkDeviceSize> sizeDistribution(1, 0x2000);
+    DeviceAddressTracker deviceAddressTracker;
+    std::vector<TestBuffer> testBuffers;
+    for (uint64_t i = 1; i <= 512; ++i) {
+        if (!testBuffers.empty() && !(i % 3)) {
+            auto eraseIndex = (size_t)(random() % testBuffers.size());
+            deviceAddressTracker.erase(testBuffers[eraseIndex].buffer);
+            testBuffers.erase(testBuffers.begin() + eraseIndex);
+        }
+        TestBuffer testBuffer { get_test_buffer(i), addressDistribution(random), 0 };
+        testBuffer.end = testBuffer.begin + sizeDistribution(random);
+        deviceAddressTracker.add(testBuffer.buffer, testBuffer.begin, testBuffer.end - testBuffer.begin);
+        testBuffers.push_back(testBuffer);
+        for (uint32_t j = 0; j < 16; ++j) {
+            auto deviceAddress = addressDistribution(random);
+            auto buffer = deviceAddressTracker.find_containing_buffer(deviceAddress);
+            std::vector<VkBuffer> expectedBuffers;
+            for (const auto& expectedBuffer : testBuffers) {
+                if (expectedBuffer.begin <= deviceAddress && deviceAddress < expectedBuffer.end) {
+                    expectedBuffers.push_back(expectedBuffer.buffer);
+                }
+            }
+            if (expectedBuffers.empty()) {
+                ASSERT_EQ(buffer, VkBuffer{ });
+            } else {
+                ASSERT_NE(std::find(expectedBuffers.begin(), expectedBuffers.end(), buffer), expectedBuffers.end());
+            }
+            auto size = sizeDistribution(random);
+            std::vector<VkBuffer> buffers;
+            deviceAddressTracker.get_overlapping_buffers(deviceAddress, size, buffers);
+            expectedBuffers.clear();
+            for (const auto& expectedBuffer : testBuffers) {
+                if (expectedBuffer.begin < deviceAddress + size && deviceAddress < expectedBuffer.end) {
+                    expectedBuffers.push_back(expectedBuffer.buffer);
+                }
+            }
+            ASSERT_EQ(get_sorted(buffers), get_sorted(expectedBuffers));
+        }
+    }
+}
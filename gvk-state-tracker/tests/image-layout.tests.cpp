@@ -25,6 +25,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 
 #include "state-tracker-test-utilities.hpp"
+#include "gvk-state-tracker/image-layout-tracker.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
 
 TEST(ImageLayout, SingleMipSingleArray)
 {
@@ -604,3 +609,126 @@ TEST(ImageLayout, RenderPass2)
         EXPECT_EQ(imageLayout, renderPassCreateInfo.pAttachments[i].finalLayout);
     }
 }
+
+TEST(ImageLayout, ImageLayoutTrackerRanges)
+{
+    // Apply random transitions to an ImageLayoutTracker and validate it against a
+    //  flat array of VkImageLayouts...
+    const uint32_t MipLevelCount = 6;
+    const uint32_t ArrayLayerCount = 32;
+    std::mt19937 rng(0);
+    gvk::state_tracker::ImageLayoutTracker imageLayoutTracker(MipLevelCount, ArrayLayerCount, VK_IMAGE_LAYOUT_UNDEFINED);
+    std::vector<VkImageLayout> expectedImageLayouts(MipLevelCount * ArrayLayerCount, VK_IMAGE_LAYOUT_UNDEFINED);
+    for (uint32_t i = 0; i < 1024; ++i) {
+        auto imageSubresourceRange = gvk::get_default<VkImageSubresourceRange>();
+        if (i % 8) {
+            imageSubresourceRange.baseMipLevel = rng() % MipLevelCount;
+            imageSubresourceRange.levelCount = rng() % (MipLevelCount - imageSubresourceRange.baseMipLevel) + 1;
+            imageSubresourceRange.baseArrayLayer = rng() % ArrayLayerCount;
+            imageSubresourceRange.layerCount = rng() % (ArrayLayerCount - imageSubresourceRange.baseArrayLayer) + 1;
+        }
+        auto imageLayout = rng() % 2 ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageLayoutTracker.set_image_layouts(imageSubresourceRange, imageLayout);
+        imageLayoutTracker.enumerate(
+            imageSubresourceRange,
+            [&](const VkImageSubresource& imageSubresource, const VkImageLayout&)
+            {
+                expectedImageLayouts[imageSubresource.arrayLayer * MipLevelCount + imageSubresource.mipLevel] = imageLayout;
+            }
+        );
+        std::vector<VkImageLayout> imageLayouts(expectedImageLayouts.size());
+        imageLayoutTracker.get_image_layouts(gvk::get_default<VkImageSubresourceRange>(), imageLayouts.data());
+        ASSERT_EQ(imageLayouts, expectedImageLayouts);
+        auto uniform = std::all_of(expectedImageLayouts.begin(), expectedImageLayouts.end(), [&](VkImageLayout expectedImageLayout) { return expectedImageLayout == expectedImageLayouts[0]; });
+        EXPECT_EQ(imageLayoutTracker.is_uniform(), uniform);
+    }
+}
+
+TEST(ImageLayout, ImageLayoutTrackerMerge)
+{
+    const uint32_t MipLevelCount = 4;
+    const uint32_t ArrayLayerCount = 6;
+    gvk::state_tracker::ImageLayoutTracker imageLayoutTracker(MipLevelCount, ArrayLayerCount, VK_IMAGE_LAYOUT_UNDEFINED);
+    auto imageSubresourceRange = gvk::get_default<VkImageSubresourceRange>();
+    imageSubresourceRange.baseArrayLayer = 4;
+    imageLayoutTracker.set_image_layouts(imageSubresourceRange, VK_IMAGE_LAYOUT_GENERAL);
+
+    // Transitions recorded against an ImageLayoutTracker of unknown layouts
+    //  should only affect the transitioned subresources when merged...
+    gvk::state_tracker::ImageLayoutTracker transitions(MipLevelCount, ArrayLayerCount, VK_IMAGE_LAYOUT_MAX_ENUM);
+    imageSubresourceRange.baseMipLevel = 0;
+    imageSubresourceRange.levelCount = 2;
+    imageSubresourceRange.baseArrayLayer = 2;
+    imageSubresourceRange.layerCount = 2;
+    transitions.set_image_layouts(imageSubresourceRange, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    imageLayoutTracker.merge(transitions);
+    for (uint32_t arrayLayer = 0; arrayLayer < ArrayLayerCount; ++arrayLayer) {
+        for (uint32_t mipLevel = 0; mipLevel < MipLevelCount; ++mipLevel) {
+            VkImageSubresource imageSubresource { VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, arrayLayer };
+            if (2 <= arrayLayer && arrayLayer < 4 && mipLevel < 2) {
+                EXPECT_EQ(imageLayoutTracker[imageSubresource], VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+            } else if (4 <= arrayLayer) {
+                EXPECT_EQ(imageLayoutTracker[imageSubresource], VK_IMAGE_LAYOUT_GENERAL);
+            } else {
+                EXPECT_EQ(imageLayoutTracker[imageSubresource], VK_IMAGE_LAYOUT_UNDEFINED);
+            }
+        }
+    }
+
+    // A transition that covers the entire image should collapse back to a single
+    //  VkImageLayout when merged...
+    transitions.set_image_layouts(gvk::get_default<VkImageSubresourceRange>(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    EXPECT_TRUE(transitions.is_uniform());
+    imageLayoutTracker.merge(transitions);
+    EXPECT_TRUE(imageLayoutTracker.is_uniform());
+    EXPECT_EQ(imageLayoutTracker.get_run_count(), 1u);
+}
+
+TEST(ImageLayout, ImageLayoutTrackerBenchmark)
+{
+    // Measure full image transitions, per layer transitions, and merges for a
+    //  2048 layer texture array...
+    const uint32_t MipLevelCount = 12;
+    const uint32_t ArrayLayerCount = 2048;
+    const uint32_t IterationCount = 1024;
+    gvk::state_tracker::ImageLayoutTracker imageLayoutTracker(MipLevelCount, ArrayLayerCount, VK_IMAGE_LAYOUT_UNDEFINED);
+    auto measure = [](const char* pName, uint32_t iterationCount, const auto& function)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterationCount; ++i) {
+            function(i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "[ ImageLayoutTracker ] " << pName << " : " << std::chrono::duration<double, std::micro>(end - begin).count() / iterationCount << " us" << std::endl;
+    };
+
+    measure("Full image transition", IterationCount,
+        [&](uint32_t i)
+        {
+            auto imageLayout = i % 2 ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageLayoutTracker.set_image_layouts(gvk::get_default<VkImageSubresourceRange>(), imageLayout);
+        }
+    );
+    EXPECT_TRUE(imageLayoutTracker.is_uniform());
+
+    measure("Single layer transition", IterationCount,
+        [&](uint32_t i)
+        {
+            auto imageSubresourceRange = gvk::get_default<VkImageSubresourceRange>();
+            imageSubresourceRange.baseArrayLayer = (i * 7) % ArrayLayerCount;
+            imageSubresourceRange.layerCount = 1;
+            imageLayoutTracker.set_image_layouts(imageSubresourceRange, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        }
+    );
+    EXPECT_LE(imageLayoutTracker.get_run_count(), ArrayLayerCount);
+
+    gvk::state_tracker::ImageLayoutTracker transitions(MipLevelCount, ArrayLayerCount, VK_IMAGE_LAYOUT_MAX_ENUM);
+    transitions.set_image_layouts(gvk::get_default<VkImageSubresourceRange>(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    measure("Full image merge", IterationCount,
+        [&](uint32_t)
+        {
+            imageLayoutTracker.merge(transitions);
+        }
+    );
+    EXPECT_TRUE(imageLayoutTracker.is_uniform());
+}
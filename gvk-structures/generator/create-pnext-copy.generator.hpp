@@ -56,6 +56,20 @@ public:
         file << "    return nullptr;" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
+        file << "size_t get_pnext_copy_size(const void* pNext)" << std::endl;
+        file << "{" << std::endl;
+        file << "    if (pNext) {" << std::endl;
+        generate_pnext_switch(
+            file,
+            manifest,
+            "        ",
+            "((const VkBaseInStructure*)pNext)->sType",
+            "return get_dynamic_array_copy_size(1, (const {structureType}*)pNext);"
+        );
+        file << "    }" << std::endl;
+        file << "    return 0;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
     }
 };
 
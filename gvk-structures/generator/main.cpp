@@ -31,6 +31,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "decerealize-pnext.generator.hpp"
 #include "destroy-pnext-copy.generator.hpp"
 #include "enumerate-pnext-handles.generator.hpp"
+#include "enumerate-pnext-pointers.generator.hpp"
 #include "get-object-type.generator.hpp"
 #include "handle-to-string.generator.hpp"
 #include "pnext-to-string.generator.hpp"
@@ -48,6 +49,7 @@ int main(int, const char*[])
         gvk::cppgen::DecerealizePNextGenerator::generate(manifest);
         gvk::cppgen::DestroyPNextCopyGenerator::generate(manifest);
         gvk::cppgen::EnumeratePNextHandlesGenerator::generate(manifest);
+        gvk::cppgen::EnumeratePNextPointersGenerator::generate(manifest);
         gvk::cppgen::GetObjectTypeGenerator::generate(manifest);
         gvk::cppgen::HandleToStringGenerator::generate(manifest);
         gvk::cppgen::PNextToStringGenerator::generate(manifest);
@@ -110,10 +112,11 @@ int main(int, const char*[])
         apiElements.manuallyImplemented.insert("VkPipelineExecutableStatisticValueKHR");
 
         gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
+        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements);
+        gvk::cppgen::StructureEnumeratePointersGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
         gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements);
         gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
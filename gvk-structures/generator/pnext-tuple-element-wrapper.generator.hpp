@@ -39,17 +39,18 @@ public:
         FileGenerator file(GVK_STRUCTURES_GENERATED_SOURCE_PATH "/pnext-tuple-element-wrapper.cpp");
         file << std::endl;
         file << "#include \"gvk-structures/generated/core-structure-comparison-operators.hpp\"" << std::endl;
+        file << "#include \"gvk-structures/detail/comparison-utilities.hpp\"" << std::endl;
         file << "#include \"gvk-structures/detail/make-tuple-utilities.hpp\"" << std::endl;
         file << std::endl;
         file << "#include <cassert>" << std::endl;
         file << std::endl;
         NamespaceGenerator namespaceGenerator(file, "gvk::detail");
         file << std::endl;
-        file << "bool operator==(const PNextTupleElementWrapper& lhs, const PNextTupleElementWrapper& rhs)" << std::endl;
+        file << "bool equal_pnext(const void* pLhs, const void* pRhs)" << std::endl;
         file << "{" << std::endl;
-        file << "    if (lhs.pNext && rhs.pNext) {" << std::endl;
-        file << "        auto lhsSType = ((const VkBaseInStructure*)lhs.pNext)->sType;" << std::endl;
-        file << "        auto rhsSType = ((const VkBaseInStructure*)rhs.pNext)->sType;" << std::endl;
+        file << "    if (pLhs && pRhs) {" << std::endl;
+        file << "        auto lhsSType = ((const VkBaseInStructure*)pLhs)->sType;" << std::endl;
+        file << "        auto rhsSType = ((const VkBaseInStructure*)pRhs)->sType;" << std::endl;
         file << "        if (lhsSType != rhsSType) {" << std::endl;
         file << "            return false;" << std::endl;
         file << "        }" << std::endl;
@@ -58,31 +59,56 @@ public:
             manifest,
             "        ",
             "lhsSType",
-            "return *(const {structureType}*)lhs.pNext == *(const {structureType}*)rhs.pNext;",
+            "return *(const {structureType}*)pLhs == *(const {structureType}*)pRhs;",
             "assert(false && \"Unsupported VkStructureType\");"
         );
         file << "    }" << std::endl;
-        file << "    return !lhs.pNext == !rhs.pNext;" << std::endl;
+        file << "    return !pLhs == !pRhs;" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
-        file << "bool operator<(const PNextTupleElementWrapper& lhs, const PNextTupleElementWrapper& rhs)" << std::endl;
+        file << "int compare_pnext(const void* pLhs, const void* pRhs)" << std::endl;
         file << "{" << std::endl;
-        file << "    if (lhs.pNext && rhs.pNext) {" << std::endl;
-        file << "        auto lhsSType = ((const VkBaseInStructure*)lhs.pNext)->sType;" << std::endl;
-        file << "        auto rhsSType = ((const VkBaseInStructure*)rhs.pNext)->sType;" << std::endl;
+        file << "    if (pLhs && pRhs) {" << std::endl;
+        file << "        auto lhsSType = ((const VkBaseInStructure*)pLhs)->sType;" << std::endl;
+        file << "        auto rhsSType = ((const VkBaseInStructure*)pRhs)->sType;" << std::endl;
         file << "        if (lhsSType != rhsSType) {" << std::endl;
-        file << "            return lhsSType < rhsSType;" << std::endl;
+        file << "            return compare(lhsSType, rhsSType);" << std::endl;
         file << "        }" << std::endl;
         generate_pnext_switch(
             file,
             manifest,
             "        ",
             "lhsSType",
-            "return *(const {structureType}*)lhs.pNext < *(const {structureType}*)rhs.pNext;",
+            "return compare(*(const {structureType}*)pLhs, *(const {structureType}*)pRhs);",
+            "assert(false && \"Unsupported VkStructureType\");"
+        );
+        file << "    }" << std::endl;
+        file << "    return compare(!!pLhs, !!pRhs);" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "uint64_t hash_pnext(const void* pNext)" << std::endl;
+        file << "{" << std::endl;
+        file << "    if (pNext) {" << std::endl;
+        generate_pnext_switch(
+            file,
+            manifest,
+            "        ",
+            "((const VkBaseInStructure*)pNext)->sType",
+            "return hash(*(const {structureType}*)pNext);",
             "assert(false && \"Unsupported VkStructureType\");"
         );
         file << "    }" << std::endl;
-        file << "    return !lhs.pNext == !!rhs.pNext;" << std::endl;
+        file << "    return 0;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "bool operator==(const PNextTupleElementWrapper& lhs, const PNextTupleElementWrapper& rhs)" << std::endl;
+        file << "{" << std::endl;
+        file << "    return equal_pnext(lhs.pNext, rhs.pNext);" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "bool operator<(const PNextTupleElementWrapper& lhs, const PNextTupleElementWrapper& rhs)" << std::endl;
+        file << "{" << std::endl;
+        file << "    return compare_pnext(lhs.pNext, rhs.pNext) < 0;" << std::endl;
         file << "}" << std::endl;
         file << std::endl;
     }
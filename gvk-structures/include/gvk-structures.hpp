@@ -37,3 +37,4 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-structures/pnext.hpp"
 #include "gvk-structures/serialization.hpp"
 #include "gvk-structures/to-string.hpp"
+#include "gvk-structures/view-serialization.hpp"
@@ -40,9 +40,10 @@ class Auto final
 public:
     Auto() = default;
 
-    inline Auto(const StructureType& other)
-        : mStructure { detail::create_structure_copy(other, nullptr) }
+    inline Auto(const StructureType& other, const VkAllocationCallbacks* pAllocator = nullptr)
+        : mpAllocator { pAllocator }
     {
+        mStructure = detail::create_packed_structure_copy(other, mpAllocator, &mpMemory);
     }
 
     inline Auto(const Auto<StructureType>& other)
@@ -64,7 +65,8 @@ public:
     {
         if (this != &other) {
             reset();
-            mStructure = detail::create_structure_copy(other.mStructure, nullptr);
+            mpAllocator = other.mpAllocator;
+            mStructure = detail::create_packed_structure_copy(other.mStructure, mpAllocator, &mpMemory);
         }
         return *this;
     }
@@ -72,8 +74,12 @@ public:
     inline Auto<StructureType>& operator=(Auto<StructureType>&& other)
     {
         if (this != &other) {
+            reset();
             mStructure = other.mStructure;
+            mpMemory = other.mpMemory;
+            mpAllocator = other.mpAllocator;
             other.mStructure = { };
+            other.mpMemory = nullptr;
         }
         return *this;
     }
@@ -95,12 +101,19 @@ public:
 
     inline void reset()
     {
-        detail::destroy_structure_copy(mStructure, nullptr);
+        detail::destroy_packed_structure_copy(mpMemory, mpAllocator);
         mStructure = { };
+        mpMemory = nullptr;
     }
 
 private:
+    // NOTE : mStructure's deep members are all placed in the single allocation
+    //  mpMemory so copying and destroying an Auto<> is a single malloc()/free().
+    //  mStructure must only ever be populated by create_packed_structure_copy(),
+    //  structures that are built or read piecewise are copied into an Auto<>.
     StructureType mStructure { };
+    void* mpMemory { nullptr };
+    const VkAllocationCallbacks* mpAllocator { nullptr };
 };
 
 } // namespace gvk
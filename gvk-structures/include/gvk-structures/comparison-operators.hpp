@@ -28,3 +28,22 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-defines.hpp"
 #include "gvk-structures/generated/core-structure-comparison-operators.hpp"
+
+namespace gvk {
+
+/**
+Hash function object for Vulkan structures
+    @note Hash values are consistent with generated operator==(), so gvk::hash<> can be used to key hash containers
+        with Vulkan structures (ie. std::unordered_map<VkSamplerCreateInfo, VkSampler, gvk::hash<VkSamplerCreateInfo>>)
+    @note Hash values include handle and pointer values so they shouldn't be persisted
+*/
+template <typename ObjectType>
+struct hash final
+{
+    inline size_t operator()(const ObjectType& obj) const
+    {
+        return (size_t)detail::hash(obj);
+    }
+};
+
+} // namespace gvk
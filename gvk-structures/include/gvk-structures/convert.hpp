@@ -38,8 +38,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace gvk {
 namespace detail {
 
-// NOTE : These functions operate on Auto<> structures that we are allocating
-//  storage for and populating manually.  Auto<>'s dtor takes care of cleanup.
+// NOTE : These functions populate structures whose deep members are allocated
+//  individually with the given VkAllocationCallbacks.  Populated structures are
+//  copied into an Auto<> then destroyed with destroy_structure_copy().
 
 template <typename T>
 inline void set_stypes(uint32_t objCount, const T* pObjs)
@@ -55,20 +56,22 @@ template<typename SrcType, typename DstType, typename ArrayElementConversionFunc
 inline void convert_array(
     uint32_t srcObjCount, const SrcType* pSrcObjs,
     const uint32_t& dstObjCount, const DstType*& pDstObjs,
-    ArrayElementConversionFunctionType convertArrayElement
+    ArrayElementConversionFunctionType convertArrayElement,
+    const VkAllocationCallbacks* pAllocator
 )
 {
     if (srcObjCount && pSrcObjs) {
+        pAllocator = validate_allocation_callbacks(pAllocator);
         const_cast<uint32_t&>(dstObjCount) = srcObjCount;
-        pDstObjs = (DstType*)malloc(sizeof(DstType) * dstObjCount);
+        pDstObjs = (DstType*)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(DstType) * dstObjCount, alignof(DstType), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
         for (uint32_t i = 0; i < dstObjCount; ++i) {
-            convertArrayElement(pSrcObjs[i], const_cast<DstType*>(pDstObjs)[i]);
+            convertArrayElement(pSrcObjs[i], const_cast<DstType*>(pDstObjs)[i], pAllocator);
         }
     }
 }
 
 template<typename SrcAttachmentDescriptionType, typename DstAttachmentDescriptionType>
-inline void convert_attachment_description(const SrcAttachmentDescriptionType& src, DstAttachmentDescriptionType& dst)
+inline void convert_attachment_description(const SrcAttachmentDescriptionType& src, DstAttachmentDescriptionType& dst, const VkAllocationCallbacks*)
 {
     dst = { };
     dst.flags = src.flags;
@@ -83,7 +86,7 @@ inline void convert_attachment_description(const SrcAttachmentDescriptionType& s
 }
 
 template<typename SrcAttachmentReferenceType, typename DstAttachmentReferenceType>
-inline void convert_attachment_reference(const SrcAttachmentReferenceType& src, DstAttachmentReferenceType& dst)
+inline void convert_attachment_reference(const SrcAttachmentReferenceType& src, DstAttachmentReferenceType& dst, const VkAllocationCallbacks*)
 {
     dst = { };
     dst.attachment = src.attachment;
@@ -91,7 +94,7 @@ inline void convert_attachment_reference(const SrcAttachmentReferenceType& src,
 }
 
 template<typename SrcSubpassDescriptionType, typename DstSubpassDescriptionType>
-inline void convert_subpass_description(const SrcSubpassDescriptionType& src, DstSubpassDescriptionType& dst)
+inline void convert_subpass_description(const SrcSubpassDescriptionType& src, DstSubpassDescriptionType& dst, const VkAllocationCallbacks* pAllocator)
 {
     dst = { };
     dst.flags = src.flags;
@@ -101,35 +104,40 @@ inline void convert_subpass_description(const SrcSubpassDescriptionType& src, Ds
     convert_array(
         src.inputAttachmentCount, src.pInputAttachments,
         dst.inputAttachmentCount, dst.pInputAttachments,
-        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>
+        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>,
+        pAllocator
     );
     convert_array(
         src.colorAttachmentCount, src.pColorAttachments,
         dst.colorAttachmentCount, dst.pColorAttachments,
-        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>
+        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>,
+        pAllocator
     );
     convert_array(
         src.colorAttachmentCount, src.pResolveAttachments,
         dst.colorAttachmentCount, dst.pResolveAttachments,
-        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>
+        convert_attachment_reference<SrcAttachmentReferenceType, DstAttachmentReferenceType>,
+        pAllocator
     );
     if (src.pDepthStencilAttachment) {
-        auto pDepthStencilAttachment = (DstAttachmentReferenceType*)malloc(sizeof(DstAttachmentReferenceType));
-        convert_attachment_reference(*src.pDepthStencilAttachment, *pDepthStencilAttachment);
+        pAllocator = validate_allocation_callbacks(pAllocator);
+        auto pDepthStencilAttachment = (DstAttachmentReferenceType*)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(DstAttachmentReferenceType), alignof(DstAttachmentReferenceType), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        convert_attachment_reference(*src.pDepthStencilAttachment, *pDepthStencilAttachment, pAllocator);
         dst.pDepthStencilAttachment = pDepthStencilAttachment;
     }
     convert_array(
         src.preserveAttachmentCount, src.pPreserveAttachments,
         dst.preserveAttachmentCount, dst.pPreserveAttachments,
-        [](uint32_t srcPreserveAttachment, uint32_t& dstPreserveAttachment)
+        [](uint32_t srcPreserveAttachment, uint32_t& dstPreserveAttachment, const VkAllocationCallbacks*)
         {
             dstPreserveAttachment = srcPreserveAttachment;
-        }
+        },
+        pAllocator
     );
 }
 
 template<typename SrcSubpassDependencyType, typename DstSubpassDependencyType>
-inline void convert_subpass_dependency(const SrcSubpassDependencyType& src, DstSubpassDependencyType& dst)
+inline void convert_subpass_dependency(const SrcSubpassDependencyType& src, DstSubpassDependencyType& dst, const VkAllocationCallbacks*)
 {
     dst = { };
     dst.srcSubpass = src.srcSubpass;
@@ -142,7 +150,7 @@ inline void convert_subpass_dependency(const SrcSubpassDependencyType& src, DstS
 }
 
 template<typename SrcRenderPassCreateInfoType, typename DstRenderPassCreateInfoType>
-inline void convert_render_pass_create_info(const SrcRenderPassCreateInfoType& src, DstRenderPassCreateInfoType& dst)
+inline void convert_render_pass_create_info(const SrcRenderPassCreateInfoType& src, DstRenderPassCreateInfoType& dst, const VkAllocationCallbacks* pAllocator)
 {
     dst.flags = src.flags;
     using SrcAttachmentDescriptionType = std::remove_const_t<std::remove_pointer_t<decltype(src.pAttachments)>>;
@@ -150,40 +158,42 @@ inline void convert_render_pass_create_info(const SrcRenderPassCreateInfoType& s
     convert_array(
         src.attachmentCount, src.pAttachments,
         dst.attachmentCount, dst.pAttachments,
-        convert_attachment_description<SrcAttachmentDescriptionType, DstAttachmentDescriptionType>
+        convert_attachment_description<SrcAttachmentDescriptionType, DstAttachmentDescriptionType>,
+        pAllocator
     );
     using SrcSubpassDescriptionType = std::remove_const_t<std::remove_pointer_t<decltype(src.pSubpasses)>>;
     using DstSubpassDescriptionType = std::remove_const_t<std::remove_pointer_t<decltype(dst.pSubpasses)>>;
     convert_array(
         src.subpassCount, src.pSubpasses,
         dst.subpassCount, dst.pSubpasses,
-        convert_subpass_description<SrcSubpassDescriptionType, DstSubpassDescriptionType>
+        convert_subpass_description<SrcSubpassDescriptionType, DstSubpassDescriptionType>,
+        pAllocator
     );
     using SrcSubpassDependencyType = std::remove_const_t<std::remove_pointer_t<decltype(src.pDependencies)>>;
     using DstSubpassDependencyType = std::remove_const_t<std::remove_pointer_t<decltype(dst.pDependencies)>>;
     convert_array(
         src.dependencyCount, src.pDependencies,
         dst.dependencyCount, dst.pDependencies,
-        convert_subpass_dependency<SrcSubpassDependencyType, DstSubpassDependencyType>
+        convert_subpass_dependency<SrcSubpassDependencyType, DstSubpassDependencyType>,
+        pAllocator
     );
 }
 
 } // namespace detail
 
 template<typename SrcType, typename DstType>
-inline Auto<DstType> convert(const SrcType& src)
+inline Auto<DstType> convert(const SrcType& src, const VkAllocationCallbacks* pAllocator = nullptr)
 {
-    return src;
+    return Auto<DstType>(src, pAllocator);
 }
 
 template<>
-inline Auto<VkRenderPassCreateInfo2> convert<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(const VkRenderPassCreateInfo& src)
+inline Auto<VkRenderPassCreateInfo2> convert<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(const VkRenderPassCreateInfo& src, const VkAllocationCallbacks* pAllocator)
 {
-    Auto<VkRenderPassCreateInfo2> dst;
-    auto& renderPassCreateInfo = const_cast<VkRenderPassCreateInfo2&>(*dst);
-    detail::convert_render_pass_create_info<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(src, renderPassCreateInfo);
+    VkRenderPassCreateInfo2 renderPassCreateInfo { };
+    detail::convert_render_pass_create_info<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(src, renderPassCreateInfo, pAllocator);
     renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2;
-    renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, nullptr);
+    renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, pAllocator);
     detail::set_stypes(renderPassCreateInfo.attachmentCount, renderPassCreateInfo.pAttachments);
     detail::set_stypes(renderPassCreateInfo.subpassCount, renderPassCreateInfo.pSubpasses);
     if (renderPassCreateInfo.subpassCount && renderPassCreateInfo.pSubpasses) {
@@ -196,27 +206,29 @@ inline Auto<VkRenderPassCreateInfo2> convert<VkRenderPassCreateInfo, VkRenderPas
         }
     }
     detail::set_stypes(renderPassCreateInfo.dependencyCount, renderPassCreateInfo.pDependencies);
+    Auto<VkRenderPassCreateInfo2> dst(renderPassCreateInfo, pAllocator);
+    detail::destroy_structure_copy(renderPassCreateInfo, pAllocator);
     return dst;
 }
 
 template<>
-inline Auto<VkRenderPassCreateInfo> convert<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(const VkRenderPassCreateInfo2& src)
+inline Auto<VkRenderPassCreateInfo> convert<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(const VkRenderPassCreateInfo2& src, const VkAllocationCallbacks* pAllocator)
 {
-    Auto<VkRenderPassCreateInfo> dst;
-    auto& renderPassCreateInfo = const_cast<VkRenderPassCreateInfo&>(*dst);
-    detail::convert_render_pass_create_info<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(src, renderPassCreateInfo);
+    VkRenderPassCreateInfo renderPassCreateInfo { };
+    detail::convert_render_pass_create_info<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(src, renderPassCreateInfo, pAllocator);
     renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, nullptr);
+    renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, pAllocator);
+    Auto<VkRenderPassCreateInfo> dst(renderPassCreateInfo, pAllocator);
+    detail::destroy_structure_copy(renderPassCreateInfo, pAllocator);
     return dst;
 }
 
 template<>
-inline Auto<VkImageMemoryBarrier2> convert<VkImageMemoryBarrier, VkImageMemoryBarrier2>(const VkImageMemoryBarrier& src)
+inline Auto<VkImageMemoryBarrier2> convert<VkImageMemoryBarrier, VkImageMemoryBarrier2>(const VkImageMemoryBarrier& src, const VkAllocationCallbacks* pAllocator)
 {
-    Auto<VkImageMemoryBarrier2> dst;
-    auto& imageMemoryBarrier = const_cast<VkImageMemoryBarrier2&>(*dst);
+    VkImageMemoryBarrier2 imageMemoryBarrier { };
     imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
-    imageMemoryBarrier.pNext = detail::create_pnext_copy(src.pNext, nullptr);
+    imageMemoryBarrier.pNext = src.pNext;
     imageMemoryBarrier.srcAccessMask = (VkAccessFlags2)src.srcAccessMask;
     imageMemoryBarrier.dstAccessMask = (VkAccessFlags2)src.dstAccessMask;
     imageMemoryBarrier.oldLayout = src.oldLayout;
@@ -225,16 +237,15 @@ inline Auto<VkImageMemoryBarrier2> convert<VkImageMemoryBarrier, VkImageMemoryBa
     imageMemoryBarrier.dstQueueFamilyIndex = src.dstQueueFamilyIndex;
     imageMemoryBarrier.image = src.image;
     imageMemoryBarrier.subresourceRange = src.subresourceRange;
-    return dst;
+    return Auto<VkImageMemoryBarrier2>(imageMemoryBarrier, pAllocator);
 }
 
 template<>
-inline Auto<VkImageMemoryBarrier> convert<VkImageMemoryBarrier2, VkImageMemoryBarrier>(const VkImageMemoryBarrier2& src)
+inline Auto<VkImageMemoryBarrier> convert<VkImageMemoryBarrier2, VkImageMemoryBarrier>(const VkImageMemoryBarrier2& src, const VkAllocationCallbacks* pAllocator)
 {
-    Auto<VkImageMemoryBarrier> dst;
-    auto& imageMemoryBarrier = const_cast<VkImageMemoryBarrier&>(*dst);
+    VkImageMemoryBarrier imageMemoryBarrier { };
     imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    imageMemoryBarrier.pNext = detail::create_pnext_copy(src.pNext, nullptr);
+    imageMemoryBarrier.pNext = src.pNext;
     imageMemoryBarrier.srcAccessMask = (VkAccessFlags)src.srcAccessMask;
     imageMemoryBarrier.dstAccessMask = (VkAccessFlags)src.dstAccessMask;
     imageMemoryBarrier.oldLayout = src.oldLayout;
@@ -243,7 +254,7 @@ inline Auto<VkImageMemoryBarrier> convert<VkImageMemoryBarrier2, VkImageMemoryBa
     imageMemoryBarrier.dstQueueFamilyIndex = src.dstQueueFamilyIndex;
     imageMemoryBarrier.image = src.image;
     imageMemoryBarrier.subresourceRange = src.subresourceRange;
-    return dst;
+    return Auto<VkImageMemoryBarrier>(imageMemoryBarrier, pAllocator);
 }
 
 } // namespace gvk
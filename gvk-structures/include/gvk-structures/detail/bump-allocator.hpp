@@ -0,0 +1,91 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace gvk {
+namespace detail {
+
+/**
+Places allocations sequentially in a single caller provided block of memory
+    @note Allocations that don't fit in the block return nullptr, the used size is still advanced so that it reports the
+        size the block would need to be to service every allocation
+    @note BumpAllocator doesn't own its block of memory and doesn't support freeing individual allocations
+*/
+class BumpAllocator final
+{
+public:
+    BumpAllocator() = default;
+
+    /**
+    Constructs an instance of BumpAllocator
+    @param [in] pMemory The block of memory to place allocations in
+    @param [in] size The size of the block of memory
+    */
+    inline BumpAllocator(void* pMemory, size_t size)
+        : mpMemory { (uint8_t*)pMemory }
+        , mSize { size }
+    {
+    }
+
+    /**
+    Places an allocation in this BumpAllocator's block of memory
+    @param [in] size The size of the allocation
+    @param [in] alignment The alignment of the allocation, must be a power of two
+    @return A pointer to the allocation, or nullptr if it doesn't fit in this BumpAllocator's block of memory
+    */
+    inline void* allocate(size_t size, size_t alignment)
+    {
+        assert(alignment && !(alignment & (alignment - 1)) && "BumpAllocator alignment must be a power of two");
+        auto address = (uintptr_t)mpMemory + mUsedSize;
+        auto alignedAddress = (address + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        auto alignedOffset = mUsedSize + (size_t)(alignedAddress - address);
+        mUsedSize = alignedOffset + size;
+        return mpMemory && mUsedSize <= mSize ? (void*)alignedAddress : nullptr;
+    }
+
+    /**
+    Gets the number of bytes used in this BumpAllocator's block of memory, including alignment padding
+    @return The number of bytes used in this BumpAllocator's block of memory, including alignment padding
+    @note This may be larger than the block of memory if allocations didn't fit
+    */
+    inline size_t get_used_size() const
+    {
+        return mUsedSize;
+    }
+
+private:
+    uint8_t* mpMemory { nullptr };
+    size_t mSize { };
+    size_t mUsedSize { };
+};
+
+} // namespace detail
+} // namespace gvk
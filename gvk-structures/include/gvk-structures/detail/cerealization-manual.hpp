@@ -30,6 +30,18 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-structures/detail/cerealization-utilities.hpp"
 #include "gvk-structures/detail/get-count.hpp"
 
+namespace gvk {
+namespace detail {
+
+// NOTE : The following structures are already cerealized as a block of bytes so
+//  arrays of them can be cerealized as a single block of bytes.
+template <> struct IsFlatCerealizable<VkAccelerationStructureInstanceKHR> : std::true_type { };
+template <> struct IsFlatCerealizable<VkAccelerationStructureMatrixMotionInstanceNV> : std::true_type { };
+template <> struct IsFlatCerealizable<VkAccelerationStructureSRTMotionInstanceNV> : std::true_type { };
+
+} // namespace detail
+} // namespace gvk
+
 namespace cereal {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +51,32 @@ template <typename ArchiveType> inline void load(ArchiveType&, VK_STRUCTURE_TYPE
 namespace gvk {
 namespace detail {
 
+/**
+Gets whether or not arrays of a given type can be cerealized as a single block of bytes
+    @note Arithmetic and enumeration types are flat, generated specializations mark pointer and handle free
+        structures without padding as flat so that the single block of bytes is identical to cerealizing members
+*/
+template <typename ObjectType>
+struct IsFlatCerealizable
+    : std::integral_constant<bool, std::is_arithmetic<ObjectType>::value || std::is_enum<ObjectType>::value>
+{
+};
+
+/**
+Gets whether or not an array of a given type can be cerealized as a single block of bytes with a given archive type
+    @note Only cereal's native binary archives are supported since they write values without any transformation
+*/
+template <typename ArchiveType, typename ObjectType>
+struct IsBulkCerealizable
+    : std::integral_constant<bool,
+        IsFlatCerealizable<ObjectType>::value && (
+            std::is_same<ArchiveType, cereal::BinaryOutputArchive>::value ||
+            std::is_same<ArchiveType, cereal::BinaryInputArchive>::value
+        )
+    >
+{
+};
+
 extern thread_local const VkAllocationCallbacks* tlpDecerealizationAllocator;
 extern thread_local VkPhysicalDeviceRayTracingPipelinePropertiesKHR tlPhysicalDeviceRayTracingPipelineProperties;
 
@@ -71,8 +97,12 @@ inline void cerealize_dynamic_array(ArchiveType& archive, size_t count, const Ob
 {
     if (count && pObjs) {
         archive(count);
-        for (size_t i = 0; i < count; ++i) {
-            archive(pObjs[i]);
+        if constexpr (IsBulkCerealizable<ArchiveType, ObjectType>::value) {
+            archive(cereal::binary_data(pObjs, count * sizeof(ObjectType)));
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                archive(pObjs[i]);
+            }
         }
     } else {
         archive(size_t{ 0 });
@@ -137,8 +167,12 @@ inline void cerealize_dynamic_string_array(ArchiveType& archive, size_t count, c
 template <size_t Count, typename ArchiveType, typename ObjectType>
 inline void cerealize_static_array(ArchiveType& archive, const ObjectType* pObjs)
 {
-    for (size_t i = 0; i < Count; ++i) {
-        archive(pObjs[i]);
+    if constexpr (IsBulkCerealizable<ArchiveType, ObjectType>::value) {
+        archive(cereal::binary_data(pObjs, Count * sizeof(ObjectType)));
+    } else {
+        for (size_t i = 0; i < Count; ++i) {
+            archive(pObjs[i]);
+        }
     }
 }
 
@@ -168,8 +202,12 @@ inline ObjectType* decerealize_dynamic_array(ArchiveType& archive)
         assert(tlpDecerealizationAllocator);
         auto pAllocator = tlpDecerealizationAllocator;
         pObjs = (ObjectType*)pAllocator->pfnAllocation(pAllocator->pUserData, count * sizeof(ObjectType), 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-        for (size_t i = 0; i < count; ++i) {
-            archive(pObjs[i]);
+        if constexpr (IsBulkCerealizable<ArchiveType, ObjectType>::value) {
+            archive(cereal::binary_data(pObjs, count * sizeof(ObjectType)));
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                archive(pObjs[i]);
+            }
         }
     }
     return pObjs;
@@ -246,8 +284,12 @@ inline CharType** decerealize_dynamic_string_array(ArchiveType& archive)
 template <size_t Count, typename ArchiveType, typename ObjectType>
 inline void decerealize_static_array(ArchiveType& archive, ObjectType* pObjs)
 {
-    for (size_t i = 0; i < Count; ++i) {
-        archive(pObjs[i]);
+    if constexpr (IsBulkCerealizable<ArchiveType, ObjectType>::value) {
+        archive(cereal::binary_data(pObjs, Count * sizeof(ObjectType)));
+    } else {
+        for (size_t i = 0; i < Count; ++i) {
+            archive(pObjs[i]);
+        }
     }
 }
 
@@ -0,0 +1,299 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/detail/make-tuple-utilities.hpp"
+
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace gvk {
+namespace detail {
+
+/**
+Gets whether or not objects of a given type can be compared and hashed as a block of bytes
+    @note Integral, enumeration, and handle types are bitwise comparable, generated specializations mark pointer,
+        floating point, and padding free structures as bitwise comparable
+*/
+template <typename ObjectType>
+struct IsBitwiseComparable
+    : std::integral_constant<bool, std::is_integral<ObjectType>::value || std::is_enum<ObjectType>::value || std::is_pointer<ObjectType>::value>
+{
+};
+
+/**
+Mixes the bits of a given value
+@param [in] value The value to mix
+@return The mixed value
+*/
+inline uint64_t hash_mix(uint64_t value)
+{
+    // NOTE : splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+Combines a given hash value with a given seed
+@param [in] seed The seed to combine the hash value with
+@param [in] value The hash value to combine with the seed
+@return The combined hash value
+*/
+inline uint64_t hash_combine(uint64_t seed, uint64_t value)
+{
+    return hash_mix(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+}
+
+/**
+Gets the hash value of a given block of bytes
+@param [in] pData A pointer to the block of bytes to hash
+@param [in] size The size of the block of bytes to hash
+@return The hash value of the given block of bytes
+*/
+inline uint64_t hash_bytes(const void* pData, size_t size)
+{
+    auto result = hash_mix(size);
+    auto pBytes = (const uint8_t*)pData;
+    for (; sizeof(uint64_t) <= size; pBytes += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+        uint64_t value = 0;
+        memcpy(&value, pBytes, sizeof(uint64_t));
+        result = hash_combine(result, value);
+    }
+    if (size) {
+        uint64_t value = 0;
+        memcpy(&value, pBytes, size);
+        result = hash_combine(result, value);
+    }
+    return result;
+}
+
+/**
+Compares two objects for equality
+    @note Generated comparison operators are used for structure types
+*/
+template <typename ObjectType>
+inline bool equal(const ObjectType& lhs, const ObjectType& rhs)
+{
+    return lhs == rhs;
+}
+
+/**
+Compares two objects
+@return A negative value if lhs orders before rhs, a positive value if rhs orders before lhs, otherwise 0
+    @note Specializations are generated for structure types
+*/
+template <typename ObjectType>
+inline int compare(const ObjectType& lhs, const ObjectType& rhs)
+{
+    return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+}
+
+/**
+Gets the hash value of an object
+    @note Specializations are generated for structure types
+*/
+template <typename ObjectType>
+inline uint64_t hash(const ObjectType& obj)
+{
+    static_assert(
+        std::is_arithmetic<ObjectType>::value || std::is_enum<ObjectType>::value || std::is_pointer<ObjectType>::value,
+        "gvk::detail::hash<>() unserviced; gvk maintenance required"
+    );
+    if constexpr (std::is_floating_point<ObjectType>::value) {
+        // NOTE : 0.0 and -0.0 are equal so they need to have the same hash value
+        return obj == 0 ? 0 : hash_bytes(&obj, sizeof(obj));
+    } else if constexpr (std::is_pointer<ObjectType>::value) {
+        return (uint64_t)(uintptr_t)obj;
+    } else {
+        return (uint64_t)obj;
+    }
+}
+
+template <typename ObjectType>
+inline bool equal_array(size_t lhsCount, const ObjectType* pLhs, size_t rhsCount, const ObjectType* pRhs)
+{
+    lhsCount = pLhs ? lhsCount : 0;
+    rhsCount = pRhs ? rhsCount : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    if (!lhsCount || pLhs == pRhs) {
+        return true;
+    }
+    if constexpr (IsBitwiseComparable<ObjectType>::value) {
+        return !memcmp(pLhs, pRhs, lhsCount * sizeof(ObjectType));
+    } else {
+        for (size_t i = 0; i < lhsCount; ++i) {
+            if (!equal(pLhs[i], pRhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+template <typename ObjectType>
+inline int compare_array(size_t lhsCount, const ObjectType* pLhs, size_t rhsCount, const ObjectType* pRhs)
+{
+    lhsCount = pLhs ? lhsCount : 0;
+    rhsCount = pRhs ? rhsCount : 0;
+    auto count = lhsCount < rhsCount ? lhsCount : rhsCount;
+    if constexpr (std::is_same<ObjectType, uint8_t>::value) {
+        if (count) {
+            if (auto result = memcmp(pLhs, pRhs, count)) {
+                return result < 0 ? -1 : 1;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            if (auto result = compare(pLhs[i], pRhs[i])) {
+                return result;
+            }
+        }
+    }
+    return compare(lhsCount, rhsCount);
+}
+
+template <typename ObjectType>
+inline uint64_t hash_array(size_t count, const ObjectType* pObjs)
+{
+    count = pObjs ? count : 0;
+    if constexpr (IsBitwiseComparable<ObjectType>::value) {
+        return hash_bytes(pObjs, count * sizeof(ObjectType));
+    } else {
+        auto result = hash_mix(count);
+        for (size_t i = 0; i < count; ++i) {
+            result = hash_combine(result, hash(pObjs[i]));
+        }
+        return result;
+    }
+}
+
+template <typename ObjectType>
+inline bool equal_pointer_array(size_t lhsCount, const ObjectType* const* ppLhs, size_t rhsCount, const ObjectType* const* ppRhs)
+{
+    lhsCount = ppLhs ? lhsCount : 0;
+    rhsCount = ppRhs ? rhsCount : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    for (size_t i = 0; i < lhsCount; ++i) {
+        if (!equal_array(1, ppLhs[i], 1, ppRhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ObjectType>
+inline uint64_t hash_pointer_array(size_t count, const ObjectType* const* ppObjs)
+{
+    count = ppObjs ? count : 0;
+    auto result = hash_mix(count);
+    for (size_t i = 0; i < count; ++i) {
+        result = hash_combine(result, hash_array(1, ppObjs[i]));
+    }
+    return result;
+}
+
+bool equal_string(const char* pLhs, const char* pRhs);
+int compare_string(const char* pLhs, const char* pRhs);
+uint64_t hash_string(const char* pStr);
+uint64_t hash_wstring(const wchar_t* pwStr);
+bool equal_string_array(size_t lhsCount, const char* const* ppLhs, size_t rhsCount, const char* const* ppRhs);
+int compare_string_array(size_t lhsCount, const char* const* ppLhs, size_t rhsCount, const char* const* ppRhs);
+uint64_t hash_string_array(size_t count, const char* const* ppStrs);
+
+// NOTE : Defined in gvk/structures/generated/pnext-tuple-element-wrapper.cpp
+bool equal_pnext(const void* pLhs, const void* pRhs);
+int compare_pnext(const void* pLhs, const void* pRhs);
+uint64_t hash_pnext(const void* pNext);
+
+/**
+Gets the hash value of a make_tuple() element
+    @note Used to hash manually implemented structures from their make_tuple() implementations
+*/
+template <typename ObjectType>
+inline uint64_t hash_tuple_element(const ObjectType& obj)
+{
+    return hash(obj);
+}
+
+template <typename ObjectType>
+inline uint64_t hash_tuple_element(const ArrayTupleElementWrapper<ObjectType>& obj)
+{
+    return hash_array(obj.count, obj.ptr);
+}
+
+template <typename ObjectType>
+inline uint64_t hash_tuple_element(const PointerArrayTupleElementWrapper<ObjectType>& obj)
+{
+    return hash_pointer_array(obj.count, obj.ptr);
+}
+
+inline uint64_t hash_tuple_element(const StringTupleElementWrapper& obj)
+{
+    return hash_string(obj.pStr);
+}
+
+inline uint64_t hash_tuple_element(const WStringTupleElementWrapper& obj)
+{
+    return hash_wstring(obj.pwStr);
+}
+
+inline uint64_t hash_tuple_element(const StringArrayTupleElementWrapper& obj)
+{
+    return hash_string_array(obj.count, obj.ppStrs);
+}
+
+inline uint64_t hash_tuple_element(const PNextTupleElementWrapper& obj)
+{
+    return hash_pnext(obj.pNext);
+}
+
+template <typename ... TupleElementTypes>
+inline uint64_t hash_tuple(const std::tuple<TupleElementTypes...>& tuple)
+{
+    return std::apply(
+        [](const auto& ... elements)
+        {
+            uint64_t result = 0;
+            ((result = hash_combine(result, hash_tuple_element(elements))), ...);
+            return result;
+        },
+        tuple
+    );
+}
+
+} // namespace detail
+} // namespace gvk
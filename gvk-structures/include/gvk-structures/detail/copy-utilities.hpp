@@ -27,14 +27,19 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "gvk-defines.hpp"
+#include "gvk-structures/detail/bump-allocator.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #define GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VK_STRUCTURE_TYPE)                                                                             \
 template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE& obj, const VkAllocationCallbacks*) { return obj; } \
-template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*) { }
+template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*) { }                         \
+template <> size_t get_structure_copy_size<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&) { return 0; }
 
 #define GVK_STUB_STRUCTURE_COPY_FUNCTIONS(VK_STRUCTURE_TYPE)                                                                       \
 template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE& obj, const VkAllocationCallbacks*) \
@@ -46,6 +51,12 @@ template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_
 template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*)                 \
 {                                                                                                                                  \
     assert(false && "gvk::detail::destroy_structure_copy<" #VK_STRUCTURE_TYPE ">() unserviced; gvk maintenance required");         \
+}                                                                                                                                  \
+                                                                                                                                   \
+template <> size_t get_structure_copy_size<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&)                                            \
+{                                                                                                                                  \
+    assert(false && "gvk::detail::get_structure_copy_size<" #VK_STRUCTURE_TYPE ">() unserviced; gvk maintenance required");        \
+    return 0;                                                                                                                      \
 }
 
 namespace gvk {
@@ -53,6 +64,7 @@ namespace detail {
 
 void* create_pnext_copy(const void* pNext, const VkAllocationCallbacks* pAllocator);
 void destroy_pnext_copy(const void* pNext, const VkAllocationCallbacks* pAllocator);
+size_t get_pnext_copy_size(const void* pNext);
 
 template <typename ObjectType>
 inline ObjectType create_structure_copy(const ObjectType& obj, const VkAllocationCallbacks*)
@@ -65,6 +77,19 @@ inline void destroy_structure_copy(const ObjectType&, const VkAllocationCallback
 {
 }
 
+/**
+Gets the number of bytes required to place all of a given structure's deep members in a single allocation
+@param [in] obj The structure to get the copy size of
+@return The number of bytes required to place all of the given structure's deep members in a single allocation
+@note The returned size doesn't include the given structure itself, only the memory its members point to
+@note The returned size includes worst case alignment padding for each allocation create_structure_copy() will make
+*/
+template <typename ObjectType>
+inline size_t get_structure_copy_size(const ObjectType&)
+{
+    return 0;
+}
+
 inline const VkAllocationCallbacks* validate_allocation_callbacks(const VkAllocationCallbacks* pAllocator)
 {
     static const VkAllocationCallbacks sAllocator{
@@ -85,7 +110,7 @@ inline ObjectType* create_dynamic_array_copy(CountType objCount, const ObjectTyp
     if (objCount && pObjs) {
         pAllocator = validate_allocation_callbacks(pAllocator);
         auto size = objCount * sizeof(ObjectType);
-        pResult = (ObjectType*)pAllocator->pfnAllocation(pAllocator->pUserData, size, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        pResult = (ObjectType*)pAllocator->pfnAllocation(pAllocator->pUserData, size, alignof(ObjectType), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
         for (CountType i = 0; i < objCount; ++i) {
             pResult[i] = create_structure_copy(pObjs[i], pAllocator);
         }
@@ -100,7 +125,7 @@ inline ObjectType** create_dynamic_pointer_array_copy(CountType objCount, const
     if (objCount && ppObjs) {
         pAllocator = validate_allocation_callbacks(pAllocator);
         auto size = objCount * sizeof(ObjectType*);
-        ppResult = (ObjectType**)pAllocator->pfnAllocation(pAllocator->pUserData, size, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        ppResult = (ObjectType**)pAllocator->pfnAllocation(pAllocator->pUserData, size, alignof(ObjectType*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
         for (CountType i = 0; i < objCount; ++i) {
             ppResult[i] = create_dynamic_array_copy(1, ppObjs[i], pAllocator);
         }
@@ -119,8 +144,8 @@ inline CharType* create_dynamic_string_copy(const CharType* pStr, const VkAlloca
             ++pEnd;
         }
         auto strLen = pEnd - pStr + 1;
-        pResult = (CharType*)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(CharType) * strLen, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-        memcpy(pResult, pStr, strLen);
+        pResult = (CharType*)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(CharType) * strLen, alignof(CharType), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        memcpy(pResult, pStr, sizeof(CharType) * strLen);
     }
     return pResult;
 }
@@ -131,7 +156,7 @@ inline CharType** create_dynamic_string_array_copy(CountType strCount, const Cha
     CharType** ppResult = nullptr;
     if (strCount && ppStrs) {
         pAllocator = validate_allocation_callbacks(pAllocator);
-        ppResult = (CharType**)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(CharType*) * strCount, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        ppResult = (CharType**)pAllocator->pfnAllocation(pAllocator->pUserData, sizeof(CharType*) * strCount, alignof(CharType*), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
         for (CountType i = 0; i < strCount; ++i) {
             ppResult[i] = create_dynamic_string_copy(ppStrs[i], pAllocator);
         }
@@ -217,9 +242,218 @@ inline void destroy_static_array_copy(const ObjectType* pObjs, const VkAllocatio
     }
 }
 
+template <typename ObjectType>
+inline constexpr size_t get_allocation_size(size_t objCount)
+{
+    // NOTE : Reserves enough space for worst case alignment padding so the sum
+    //  of allocation sizes doesn't depend on the order allocations are made in.
+    return objCount ? objCount * sizeof(ObjectType) + alignof(ObjectType) - 1 : 0;
+}
+
+template <typename CountType, typename ObjectType>
+inline size_t get_dynamic_array_copy_size(CountType objCount, const ObjectType* pObjs)
+{
+    size_t size = 0;
+    if (objCount && pObjs) {
+        size += get_allocation_size<ObjectType>((size_t)objCount);
+        for (CountType i = 0; i < objCount; ++i) {
+            size += get_structure_copy_size(pObjs[i]);
+        }
+    }
+    return size;
+}
+
+template <typename CountType, typename ObjectType>
+inline size_t get_dynamic_pointer_array_copy_size(CountType objCount, const ObjectType* const* ppObjs)
+{
+    size_t size = 0;
+    if (objCount && ppObjs) {
+        size += get_allocation_size<ObjectType*>((size_t)objCount);
+        for (CountType i = 0; i < objCount; ++i) {
+            size += get_dynamic_array_copy_size(1, ppObjs[i]);
+        }
+    }
+    return size;
+}
+
+template <typename CharType>
+inline size_t get_dynamic_string_copy_size(const CharType* pStr)
+{
+    size_t size = 0;
+    if (pStr) {
+        auto pEnd = pStr;
+        while (*pEnd) {
+            ++pEnd;
+        }
+        size += get_allocation_size<CharType>((size_t)(pEnd - pStr + 1));
+    }
+    return size;
+}
+
+template <typename CountType, typename CharType>
+inline size_t get_dynamic_string_array_copy_size(CountType strCount, const CharType* const* ppStrs)
+{
+    size_t size = 0;
+    if (strCount && ppStrs) {
+        size += get_allocation_size<CharType*>((size_t)strCount);
+        for (CountType i = 0; i < strCount; ++i) {
+            size += get_dynamic_string_copy_size(ppStrs[i]);
+        }
+    }
+    return size;
+}
+
+template <size_t Count, typename ObjectType>
+inline size_t get_static_array_copy_size(const ObjectType* pObjs)
+{
+    assert(Count);
+    assert(pObjs);
+    size_t size = 0;
+    for (size_t i = 0; i < Count; ++i) {
+        size += get_structure_copy_size(pObjs[i]);
+    }
+    return size;
+}
+
+/**
+Provides VkAllocationCallbacks that place allocations sequentially in a single caller provided block of memory
+    @note Frees are ignored, the block is released all at once by its owner
+    @note Allocations that don't fit in the block assert and are serviced individually by the fallback
+        VkAllocationCallbacks, these allocations are released when the PackedAllocator is destroyed
+*/
+class PackedAllocator final
+{
+public:
+    /**
+    Constructs an instance of PackedAllocator
+    @param [in] pMemory The block of memory to place allocations in
+    @param [in] size The size of the block of memory
+    @param [in] pFallbackAllocator (optional = nullptr) The VkAllocationCallbacks to use for allocations that don't fit
+    */
+    inline PackedAllocator(void* pMemory, size_t size, const VkAllocationCallbacks* pFallbackAllocator = nullptr)
+        : mBumpAllocator(pMemory, size)
+        , mpFallbackAllocator { validate_allocation_callbacks(pFallbackAllocator) }
+    {
+        mAllocationCallbacks.pUserData = this;
+        mAllocationCallbacks.pfnAllocation = allocation;
+        mAllocationCallbacks.pfnFree = free;
+    }
+
+    /**
+    Destroys this instance of PackedAllocator, releasing any allocations that didn't fit in its block of memory
+    */
+    inline ~PackedAllocator()
+    {
+        for (auto pFallbackAllocation : mFallbackAllocations) {
+            mpFallbackAllocator->pfnFree(mpFallbackAllocator->pUserData, pFallbackAllocation);
+        }
+    }
+
+    /**
+    Gets this PackedAllocator's VkAllocationCallbacks
+    @return This PackedAllocator's VkAllocationCallbacks
+    */
+    inline const VkAllocationCallbacks* get_allocation_callbacks() const
+    {
+        return &mAllocationCallbacks;
+    }
+
+    /**
+    Gets the number of bytes used in this PackedAllocator's block of memory, including alignment padding
+    @return The number of bytes used in this PackedAllocator's block of memory, including alignment padding
+    */
+    inline size_t get_used_size() const
+    {
+        return mBumpAllocator.get_used_size();
+    }
+
+    /**
+    Gets whether or not any allocations didn't fit in this PackedAllocator's block of memory
+    @return Whether or not any allocations didn't fit in this PackedAllocator's block of memory
+    */
+    inline bool exhausted() const
+    {
+        return !mFallbackAllocations.empty();
+    }
+
+private:
+    static inline VKAPI_ATTR void* VKAPI_CALL allocation(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
+    {
+        assert(pUserData);
+        if (!size) {
+            return nullptr;
+        }
+        auto& packedAllocator = *(PackedAllocator*)pUserData;
+        auto pMemory = packedAllocator.mBumpAllocator.allocate(size, alignment);
+        if (!pMemory) {
+            assert(false && "PackedAllocator block exhausted; get_structure_copy_size() is out of sync with create_structure_copy(); gvk maintenance required");
+            const auto& fallbackAllocator = *packedAllocator.mpFallbackAllocator;
+            pMemory = fallbackAllocator.pfnAllocation(fallbackAllocator.pUserData, size, alignment, allocationScope);
+            packedAllocator.mFallbackAllocations.push_back(pMemory);
+        }
+        return pMemory;
+    }
+
+    static inline VKAPI_ATTR void VKAPI_CALL free(void*, void*)
+    {
+    }
+
+    VkAllocationCallbacks mAllocationCallbacks { };
+    BumpAllocator mBumpAllocator;
+    const VkAllocationCallbacks* mpFallbackAllocator { nullptr };
+    std::vector<void*> mFallbackAllocations;
+
+    PackedAllocator(const PackedAllocator&) = delete;
+    PackedAllocator& operator=(const PackedAllocator&) = delete;
+};
+
+/**
+Destroys a copy created with create_packed_structure_copy()
+@param [in] pMemory The allocation backing the copy's deep members
+@param [in] pAllocator (optional = nullptr) The VkAllocationCallbacks that were used to create the copy
+*/
+inline void destroy_packed_structure_copy(void* pMemory, const VkAllocationCallbacks* pAllocator)
+{
+    if (pMemory) {
+        pAllocator = validate_allocation_callbacks(pAllocator);
+        pAllocator->pfnFree(pAllocator->pUserData, pMemory);
+    }
+}
+
+/**
+Creates a deep copy of a given structure with all of its deep members placed in a single allocation
+@param [in] obj The structure to copy
+@param [in] pAllocator (optional = nullptr) The VkAllocationCallbacks to use for the single allocation
+@param [out] ppMemory The allocation backing the copy's deep members, this will be nullptr if no allocation was necessary
+@return The copy
+@note The returned copy must be destroyed with destroy_packed_structure_copy(), not destroy_structure_copy()
+*/
+template <typename ObjectType>
+inline ObjectType create_packed_structure_copy(const ObjectType& obj, const VkAllocationCallbacks* pAllocator, void** ppMemory)
+{
+    assert(ppMemory);
+    pAllocator = validate_allocation_callbacks(pAllocator);
+    auto size = get_structure_copy_size(obj);
+    while (true) {
+        *ppMemory = size ? pAllocator->pfnAllocation(pAllocator->pUserData, size, alignof(std::max_align_t), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT) : nullptr;
+        PackedAllocator packedAllocator(*ppMemory, size, pAllocator);
+        auto copy = create_structure_copy(obj, packedAllocator.get_allocation_callbacks());
+        if (!packedAllocator.exhausted()) {
+            return copy;
+        }
+
+        // NOTE : If get_structure_copy_size() underestimates the size of the copy,
+        //  the copy is made again with the size that the PackedAllocator measured.
+        assert(size < packedAllocator.get_used_size());
+        destroy_packed_structure_copy(*ppMemory, pAllocator);
+        size = packedAllocator.get_used_size();
+    }
+}
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 template <> SECURITY_ATTRIBUTES create_structure_copy<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj, const VkAllocationCallbacks* pAllocator);
 template <> void destroy_structure_copy<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj, const VkAllocationCallbacks* pAllocator);
+template <> size_t get_structure_copy_size<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj);
 #endif
 
 } // namespace detail
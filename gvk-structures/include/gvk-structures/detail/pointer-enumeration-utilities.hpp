@@ -0,0 +1,138 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+#define GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VK_STRUCTURE_TYPE)                                                      \
+template <> void enumerate_structure_pointers<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const EnumeratePointersCallback&)     \
+{                                                                                                                                \
+    assert(false && "gvk::detail::enumerate_structure_pointers<" #VK_STRUCTURE_TYPE ">() unserviced; gvk maintenance required"); \
+}
+
+#define GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VK_STRUCTURE_TYPE)                                                       \
+template <> void enumerate_structure_pointers<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE& obj, const EnumeratePointersCallback& callback) \
+{                                                                                                                                         \
+    enumerate_value(obj, callback);                                                                                                       \
+}
+
+namespace gvk {
+namespace detail {
+
+/**
+Specifies how the memory reported to an EnumeratePointersCallback is used
+*/
+enum class EnumeratedMemberType
+{
+    Structure,   //!< A structure, bytes that aren't covered by one of its members are padding
+    Value,       //!< A member that doesn't point to anything
+    Pointer,     //!< A pointer to memory that was deep copied with the structure
+    HostPointer, //!< A pointer to memory that isn't copied with the structure (void*, PFN_*, etc.)
+};
+
+using EnumeratePointersCallback = std::function<void(EnumeratedMemberType, const void*, size_t)>;
+
+/**
+Enumerates the members of a structure, and everything it points to, that create_structure_copy() deep copies
+@param [in] obj The structure to enumerate
+@param [in] callback The callback to report each member to
+@note Members are reported in declaration order, pointers are reported before the memory they point to is enumerated
+*/
+template <typename StructureType>
+inline void enumerate_structure_pointers(const StructureType& obj, const EnumeratePointersCallback& callback)
+{
+    assert(false && "gvk::detail::enumerate_structure_pointers<>() unserviced; gvk maintenance required");
+    callback(EnumeratedMemberType::Value, &obj, sizeof(obj));
+}
+
+void enumerate_pnext_pointers(const void* pNext, const EnumeratePointersCallback& callback);
+
+template <typename ValueType>
+inline void enumerate_value(const ValueType& value, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Value, &value, sizeof(value));
+}
+
+template <typename PointeeType>
+inline void enumerate_pointer(PointeeType* const& pointer, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Pointer, &pointer, sizeof(pointer));
+}
+
+template <typename PointeeType>
+inline void enumerate_host_pointer(PointeeType* const& pointer, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::HostPointer, &pointer, sizeof(pointer));
+}
+
+template <typename CountType, typename ObjectType>
+inline void enumerate_dynamic_structure_array_pointers(CountType objCount, const ObjectType* pObjs, const EnumeratePointersCallback& callback)
+{
+    if (objCount && pObjs) {
+        for (CountType i = 0; i < objCount; ++i) {
+            enumerate_structure_pointers(pObjs[i], callback);
+        }
+    }
+}
+
+template <typename CountType, typename ObjectType>
+inline void enumerate_dynamic_structure_pointer_array_pointers(CountType objCount, const ObjectType* const* ppObjs, const EnumeratePointersCallback& callback)
+{
+    if (objCount && ppObjs) {
+        for (CountType i = 0; i < objCount; ++i) {
+            enumerate_pointer(ppObjs[i], callback);
+            enumerate_dynamic_structure_array_pointers(1, ppObjs[i], callback);
+        }
+    }
+}
+
+template <typename CountType, typename ObjectType>
+inline void enumerate_dynamic_pointer_array_pointers(CountType objCount, const ObjectType* const* ppObjs, const EnumeratePointersCallback& callback)
+{
+    if (objCount && ppObjs) {
+        for (CountType i = 0; i < objCount; ++i) {
+            enumerate_pointer(ppObjs[i], callback);
+        }
+    }
+}
+
+template <size_t Count, typename ObjectType>
+inline void enumerate_static_structure_array_pointers(const ObjectType* pObjs, const EnumeratePointersCallback& callback)
+{
+    if (pObjs) {
+        for (size_t i = 0; i < Count; ++i) {
+            enumerate_structure_pointers(pObjs[i], callback);
+        }
+    }
+}
+
+} // namespace detail
+} // namespace gvk
@@ -27,9 +27,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "gvk-defines.hpp"
+#include "gvk-structures/auto.hpp"
 #include "gvk-structures/get-stype.hpp"
 
 #include <set>
+#include <utility>
+#include <vector>
 
 namespace gvk {
 
@@ -56,28 +59,45 @@ inline const PNextStructureType* get_pnext_structure(const void* pNext)
         if (pBaseInStructure->sType == get_stype<PNextStructureType>()) {
             return (const PNextStructureType*)pBaseInStructure;
         }
-        pNext = pBaseInStructure->pNext;
+        pBaseInStructure = pBaseInStructure->pNext;
     }
     return nullptr;
 }
 
-inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureTypes)
+/**
+Removes entries with any of the given VkStructureTypes from an Auto<>'s pNext chain
+@param [in,out] obj The Auto<> to remove pNext entries from
+@param [in] structureTypes The VkStructureTypes of the pNext entries to remove
+@note obj is recreated without the removed entries, this is valid whether or not obj's deep members are packed in a
+    single allocation
+*/
+template <typename StructureType>
+inline void remove_pnext_entries(Auto<StructureType>& obj, const std::set<VkStructureType>& structureTypes)
 {
-    while (pNext) {
-        while (pNext->pNext && structureTypes.count(pNext->pNext->sType)) {
-            auto pRemove = pNext->pNext;
-            pNext->pNext = pRemove->pNext;
-            pRemove->pNext = nullptr;
-            detail::destroy_pnext_copy(pRemove, nullptr);
+    // NOTE : Entries are unlinked in place so obj can be copied without them, then
+    //  relinked so obj is destroyed with the pNext chain it was created with.
+    std::vector<std::pair<VkBaseOutStructure*, VkBaseOutStructure*>> removedEntries;
+    auto pBaseOutStructure = (VkBaseOutStructure*)&const_cast<StructureType&>(*obj);
+    while (pBaseOutStructure) {
+        while (pBaseOutStructure->pNext && structureTypes.count(pBaseOutStructure->pNext->sType)) {
+            removedEntries.push_back({ pBaseOutStructure, pBaseOutStructure->pNext });
+            pBaseOutStructure->pNext = pBaseOutStructure->pNext->pNext;
         }
-        pNext = pNext->pNext;
+        pBaseOutStructure = pBaseOutStructure->pNext;
+    }
+    if (!removedEntries.empty()) {
+        Auto<StructureType> result(*obj);
+        for (auto itr = removedEntries.rbegin(); itr != removedEntries.rend(); ++itr) {
+            itr->first->pNext = itr->second;
+        }
+        obj = std::move(result);
     }
-    return pNext;
 }
 
-inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, VkStructureType structureType)
+template <typename StructureType>
+inline void remove_pnext_entries(Auto<StructureType>& obj, VkStructureType structureType)
 {
-    return remove_pnext_entries(pNext, std::set<VkStructureType> { structureType });
+    remove_pnext_entries(obj, std::set<VkStructureType> { structureType });
 }
 
 } // namespace detail
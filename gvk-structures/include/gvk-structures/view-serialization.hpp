@@ -0,0 +1,105 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-structures/generated/core-structure-enumerate-pointers.hpp"
+#include "gvk-structures/detail/bump-allocator.hpp"
+#include "gvk-structures/copy.hpp"
+#include "gvk-defines.hpp"
+
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+namespace gvk {
+namespace detail {
+
+/**
+Provides VkAllocationCallbacks that lay out a structure copy in a single contiguous block of memory
+    @note Allocations that don't fit in the block are serviced from the heap and tracked so the block can be resized
+*/
+class ViewAllocator final
+{
+public:
+    ViewAllocator(uint8_t* pData, size_t size);
+    ViewAllocator(const ViewAllocator&) = delete;
+    ViewAllocator& operator=(const ViewAllocator&) = delete;
+    const VkAllocationCallbacks* get_allocation_callbacks() const;
+    void* allocate(size_t size, size_t alignment);
+    size_t get_required_size() const;
+
+private:
+    BumpAllocator mBumpAllocator;
+    std::vector<std::unique_ptr<uint8_t[]>> mOverflowAllocations;
+    VkAllocationCallbacks mAllocationCallbacks { };
+};
+
+void serialize_view(std::ostream& ostrm, const std::function<void(ViewAllocator&, const EnumeratePointersCallback&)>& createCopy);
+const void* deserialize_view(uint8_t* pData, size_t size);
+
+} // namespace detail
+
+/**
+Serializes a structure, and everything it points to, in a relocatable format that can be read in place
+    @param [in] ostrm The std::ostream to write the serialized structure to
+    @param [in] obj The structure to serialize
+    @note The structure is laid out in a single contiguous block with pointers stored as offsets into the block
+    @note Padding is zeroed and pointers to memory that isn't deep copied with the structure (void*, PFN_*, etc.) are
+        written as nullptr
+*/
+template <typename ObjectType>
+inline void serialize_view(std::ostream& ostrm, const ObjectType& obj)
+{
+    detail::serialize_view(
+        ostrm,
+        [&](detail::ViewAllocator& allocator, const detail::EnumeratePointersCallback& callback)
+        {
+            auto pObj = (ObjectType*)allocator.allocate(sizeof(ObjectType), alignof(ObjectType));
+            *pObj = detail::create_structure_copy(obj, allocator.get_allocation_callbacks());
+            detail::enumerate_structure_pointers(*pObj, callback);
+        }
+    );
+}
+
+/**
+Gets a pointer to a structure serialized with serialize_view() without allocating or copying
+    @param [in] pData A pointer to the data written by serialize_view(), must be aligned to 16 bytes
+    @param [in] size The size of the data written by serialize_view()
+    @return A pointer to the structure in the given data, or nullptr if the data isn't a valid view
+    @note Pointers in the given data are fixed up in place the first time it's read at a given address, so the data
+        must be writable (mapping a file with copy-on-write is sufficient) and must not be read concurrently while it's
+        being fixed up
+    @note The returned pointer and everything it points to is valid for the lifetime of the given data
+*/
+template <typename ObjectType>
+inline const ObjectType* deserialize_view(uint8_t* pData, size_t size)
+{
+    return (const ObjectType*)detail::deserialize_view(pData, size);
+}
+
+} // namespace gvk
@@ -0,0 +1,98 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/detail/comparison-utilities.hpp"
+
+#include <cstring>
+#include <cwchar>
+
+namespace gvk {
+namespace detail {
+
+bool equal_string(const char* pLhs, const char* pRhs)
+{
+    return pLhs && pRhs ? !strcmp(pLhs, pRhs) : !pLhs && !pRhs;
+}
+
+int compare_string(const char* pLhs, const char* pRhs)
+{
+    if (pLhs && pRhs) {
+        auto result = strcmp(pLhs, pRhs);
+        return result < 0 ? -1 : (0 < result ? 1 : 0);
+    }
+    return compare(!!pLhs, !!pRhs);
+}
+
+uint64_t hash_string(const char* pStr)
+{
+    return pStr ? hash_bytes(pStr, strlen(pStr)) : hash_mix(0);
+}
+
+uint64_t hash_wstring(const wchar_t* pwStr)
+{
+    return pwStr ? hash_bytes(pwStr, wcslen(pwStr) * sizeof(wchar_t)) : hash_mix(0);
+}
+
+bool equal_string_array(size_t lhsCount, const char* const* ppLhs, size_t rhsCount, const char* const* ppRhs)
+{
+    lhsCount = ppLhs ? lhsCount : 0;
+    rhsCount = ppRhs ? rhsCount : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    for (size_t i = 0; i < lhsCount; ++i) {
+        if (!equal_string(ppLhs[i], ppRhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int compare_string_array(size_t lhsCount, const char* const* ppLhs, size_t rhsCount, const char* const* ppRhs)
+{
+    lhsCount = ppLhs ? lhsCount : 0;
+    rhsCount = ppRhs ? rhsCount : 0;
+    auto count = lhsCount < rhsCount ? lhsCount : rhsCount;
+    for (size_t i = 0; i < count; ++i) {
+        if (auto result = compare_string(ppLhs[i], ppRhs[i])) {
+            return result;
+        }
+    }
+    return compare(lhsCount, rhsCount);
+}
+
+uint64_t hash_string_array(size_t count, const char* const* ppStrs)
+{
+    count = ppStrs ? count : 0;
+    auto result = hash_mix(count);
+    for (size_t i = 0; i < count; ++i) {
+        result = hash_combine(result, hash_string(ppStrs[i]));
+    }
+    return result;
+}
+
+} // namespace detail
+} // namespace gvk
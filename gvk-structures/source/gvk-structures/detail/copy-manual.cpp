@@ -45,6 +45,11 @@ template <> void destroy_structure_copy<VkXlibSurfaceCreateInfoKHR>(const VkXlib
 {
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
+
+template <> size_t get_structure_copy_size<VkXlibSurfaceCreateInfoKHR>(const VkXlibSurfaceCreateInfoKHR& obj)
+{
+    return get_pnext_copy_size(obj.pNext);
+}
 #endif // VK_USE_PLATFORM_XLIB_KHR
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +73,14 @@ template <> void destroy_structure_copy<VkExportFenceWin32HandleInfoKHR>(const V
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportFenceWin32HandleInfoKHR>(const VkExportFenceWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkExportMemoryWin32HandleInfoKHR create_structure_copy<VkExportMemoryWin32HandleInfoKHR>(const VkExportMemoryWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -84,6 +97,14 @@ template <> void destroy_structure_copy<VkExportMemoryWin32HandleInfoKHR>(const
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportMemoryWin32HandleInfoKHR>(const VkExportMemoryWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkExportMemoryWin32HandleInfoNV create_structure_copy<VkExportMemoryWin32HandleInfoNV>(const VkExportMemoryWin32HandleInfoNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -98,6 +119,13 @@ template <> void destroy_structure_copy<VkExportMemoryWin32HandleInfoNV>(const V
     destroy_dynamic_array_copy(1, obj.pAttributes, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportMemoryWin32HandleInfoNV>(const VkExportMemoryWin32HandleInfoNV& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    return size;
+}
+
 template <> VkExportSemaphoreWin32HandleInfoKHR create_structure_copy<VkExportSemaphoreWin32HandleInfoKHR>(const VkExportSemaphoreWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -114,6 +142,14 @@ template <> void destroy_structure_copy<VkExportSemaphoreWin32HandleInfoKHR>(con
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportSemaphoreWin32HandleInfoKHR>(const VkExportSemaphoreWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportFenceWin32HandleInfoKHR create_structure_copy<VkImportFenceWin32HandleInfoKHR>(const VkImportFenceWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -128,6 +164,13 @@ template <> void destroy_structure_copy<VkImportFenceWin32HandleInfoKHR>(const V
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportFenceWin32HandleInfoKHR>(const VkImportFenceWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportMemoryWin32HandleInfoKHR create_structure_copy<VkImportMemoryWin32HandleInfoKHR>(const VkImportMemoryWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -142,6 +185,13 @@ template <> void destroy_structure_copy<VkImportMemoryWin32HandleInfoKHR>(const
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportMemoryWin32HandleInfoKHR>(const VkImportMemoryWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportMemoryWin32HandleInfoNV create_structure_copy<VkImportMemoryWin32HandleInfoNV>(const VkImportMemoryWin32HandleInfoNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -154,6 +204,11 @@ template <> void destroy_structure_copy<VkImportMemoryWin32HandleInfoNV>(const V
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportMemoryWin32HandleInfoNV>(const VkImportMemoryWin32HandleInfoNV& obj)
+{
+    return get_pnext_copy_size(obj.pNext);
+}
+
 template <> VkImportSemaphoreWin32HandleInfoKHR create_structure_copy<VkImportSemaphoreWin32HandleInfoKHR>(const VkImportSemaphoreWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -167,6 +222,13 @@ template <> void destroy_structure_copy<VkImportSemaphoreWin32HandleInfoKHR>(con
     destroy_pnext_copy(obj.pNext, pAllocator);
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
+
+template <> size_t get_structure_copy_size<VkImportSemaphoreWin32HandleInfoKHR>(const VkImportSemaphoreWin32HandleInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +327,14 @@ template <> void destroy_structure_copy<VkAccelerationStructureBuildGeometryInfo
     destroy_dynamic_pointer_array_copy(obj.geometryCount, obj.ppGeometries, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureBuildGeometryInfoKHR>(const VkAccelerationStructureBuildGeometryInfoKHR& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.geometryCount, obj.pGeometries);
+    size += get_dynamic_pointer_array_copy_size(obj.geometryCount, obj.ppGeometries);
+    return size;
+}
+
 template <> VkAccelerationStructureTrianglesDisplacementMicromapNV create_structure_copy<VkAccelerationStructureTrianglesDisplacementMicromapNV>(const VkAccelerationStructureTrianglesDisplacementMicromapNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -281,6 +351,14 @@ template <> void destroy_structure_copy<VkAccelerationStructureTrianglesDisplace
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureTrianglesDisplacementMicromapNV>(const VkAccelerationStructureTrianglesDisplacementMicromapNV& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkAccelerationStructureTrianglesOpacityMicromapEXT create_structure_copy<VkAccelerationStructureTrianglesOpacityMicromapEXT>(const VkAccelerationStructureTrianglesOpacityMicromapEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -297,6 +375,14 @@ template <> void destroy_structure_copy<VkAccelerationStructureTrianglesOpacityM
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureTrianglesOpacityMicromapEXT>(const VkAccelerationStructureTrianglesOpacityMicromapEXT& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkAccelerationStructureVersionInfoKHR create_structure_copy<VkAccelerationStructureVersionInfoKHR>(const VkAccelerationStructureVersionInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -312,6 +398,11 @@ template <> void destroy_structure_copy<VkAccelerationStructureVersionInfoKHR>(c
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureVersionInfoKHR>(const VkAccelerationStructureVersionInfoKHR& obj)
+{
+    return get_pnext_copy_size(obj.pNext);
+}
+
 template <> VkMicromapBuildInfoEXT create_structure_copy<VkMicromapBuildInfoEXT>(const VkMicromapBuildInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -328,6 +419,14 @@ template <> void destroy_structure_copy<VkMicromapBuildInfoEXT>(const VkMicromap
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkMicromapBuildInfoEXT>(const VkMicromapBuildInfoEXT& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkMicromapVersionInfoEXT create_structure_copy<VkMicromapVersionInfoEXT>(const VkMicromapVersionInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -343,6 +442,11 @@ template <> void destroy_structure_copy<VkMicromapVersionInfoEXT>(const VkMicrom
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkMicromapVersionInfoEXT>(const VkMicromapVersionInfoEXT& obj)
+{
+    return get_pnext_copy_size(obj.pNext);
+}
+
 template <> VkPipelineCacheCreateInfo create_structure_copy<VkPipelineCacheCreateInfo>(const VkPipelineCacheCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -357,6 +461,13 @@ template <> void destroy_structure_copy<VkPipelineCacheCreateInfo>(const VkPipel
     destroy_dynamic_array_copy(obj.initialDataSize, (const uint8_t*)obj.pInitialData, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkPipelineCacheCreateInfo>(const VkPipelineCacheCreateInfo& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.initialDataSize, (const uint8_t*)obj.pInitialData);
+    return size;
+}
+
 template <> VkPipelineMultisampleStateCreateInfo create_structure_copy<VkPipelineMultisampleStateCreateInfo>(const VkPipelineMultisampleStateCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -371,6 +482,13 @@ template <> void destroy_structure_copy<VkPipelineMultisampleStateCreateInfo>(co
     destroy_dynamic_array_copy((obj.rasterizationSamples + 31) / 32, obj.pSampleMask, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkPipelineMultisampleStateCreateInfo>(const VkPipelineMultisampleStateCreateInfo& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size((obj.rasterizationSamples + 31) / 32, obj.pSampleMask);
+    return size;
+}
+
 template <> VkShaderCreateInfoEXT create_structure_copy<VkShaderCreateInfoEXT>(const VkShaderCreateInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -393,6 +511,17 @@ template <> void destroy_structure_copy<VkShaderCreateInfoEXT>(const VkShaderCre
     destroy_dynamic_array_copy(1, obj.pSpecializationInfo, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkShaderCreateInfoEXT>(const VkShaderCreateInfoEXT& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.codeSize, (uint8_t*)obj.pCode);
+    size += get_dynamic_string_copy_size(obj.pName);
+    size += get_dynamic_array_copy_size(obj.setLayoutCount, obj.pSetLayouts);
+    size += get_dynamic_array_copy_size(obj.pushConstantRangeCount, obj.pPushConstantRanges);
+    size += get_dynamic_array_copy_size(1, obj.pSpecializationInfo);
+    return size;
+}
+
 template <> VkShaderModuleCreateInfo create_structure_copy<VkShaderModuleCreateInfo>(const VkShaderModuleCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -407,6 +536,13 @@ template <> void destroy_structure_copy<VkShaderModuleCreateInfo>(const VkShader
     destroy_dynamic_array_copy(obj.codeSize / sizeof(uint32_t), obj.pCode, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkShaderModuleCreateInfo>(const VkShaderModuleCreateInfo& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.codeSize / sizeof(uint32_t), obj.pCode);
+    return size;
+}
+
 template <> VkSpecializationInfo create_structure_copy<VkSpecializationInfo>(const VkSpecializationInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -421,6 +557,13 @@ template <> void destroy_structure_copy<VkSpecializationInfo>(const VkSpecializa
     destroy_dynamic_array_copy(obj.dataSize, (const uint8_t*)obj.pData, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkSpecializationInfo>(const VkSpecializationInfo& obj)
+{
+    size_t size = get_dynamic_array_copy_size(obj.mapEntryCount, obj.pMapEntries);
+    size += get_dynamic_array_copy_size(obj.dataSize, (const uint8_t*)obj.pData);
+    return size;
+}
+
 GVK_STUB_STRUCTURE_COPY_FUNCTIONS(VkTransformMatrixKHR)
 
 template <> VkWriteDescriptorSet create_structure_copy<VkWriteDescriptorSet>(const VkWriteDescriptorSet& obj, const VkAllocationCallbacks* pAllocator)
@@ -494,6 +637,40 @@ template <> void destroy_structure_copy<VkWriteDescriptorSet>(const VkWriteDescr
     }
 }
 
+template <> size_t get_structure_copy_size<VkWriteDescriptorSet>(const VkWriteDescriptorSet& obj)
+{
+    size_t size = get_pnext_copy_size(obj.pNext);
+    switch (obj.descriptorType) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
+        size += get_dynamic_array_copy_size(obj.descriptorCount, obj.pBufferInfo);
+    } break;
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: {
+        size += get_dynamic_array_copy_size(obj.descriptorCount, obj.pImageInfo);
+    } break;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
+        size += get_dynamic_array_copy_size(obj.descriptorCount, obj.pTexelBufferView);
+    } break;
+    case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+    case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
+    case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
+    case VK_DESCRIPTOR_TYPE_MUTABLE_EXT:
+    default: {
+        assert(false && "Unserviced VkDescriptorType; gvk maintenance required");
+    } break;
+    }
+    return size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unions
 template <> VkAccelerationStructureGeometryDataKHR create_structure_copy<VkAccelerationStructureGeometryDataKHR>(const VkAccelerationStructureGeometryDataKHR& obj, const VkAllocationCallbacks* pAllocator)
@@ -532,6 +709,25 @@ template <> void destroy_structure_copy<VkAccelerationStructureGeometryDataKHR>(
     }
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureGeometryDataKHR>(const VkAccelerationStructureGeometryDataKHR& obj)
+{
+    size_t size = 0;
+    switch (((VkBaseInStructure&)obj).sType) {
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: {
+        size += get_structure_copy_size(obj.triangles);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: {
+        size += get_structure_copy_size(obj.aabbs);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: {
+        size += get_structure_copy_size(obj.instances);
+    } break;
+    default: {
+    } break;
+    }
+    return size;
+}
+
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkAccelerationStructureMotionInstanceDataNV)
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkClearColorValue)
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkClearValue)
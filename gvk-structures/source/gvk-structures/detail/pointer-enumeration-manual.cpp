@@ -0,0 +1,487 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/generated/core-structure-enumerate-pointers.hpp"
+
+namespace gvk {
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////
+// Linux
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+template <>
+void enumerate_structure_pointers<VkXlibSurfaceCreateInfoKHR>(const VkXlibSurfaceCreateInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_host_pointer(obj.dpy, callback);
+    enumerate_value(obj.window, callback);
+}
+#endif // VK_USE_PLATFORM_XLIB_KHR
+
+////////////////////////////////////////////////////////////////////////////////
+// Win32
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+template <>
+void enumerate_structure_pointers<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.nLength, callback);
+    enumerate_host_pointer(obj.lpSecurityDescriptor, callback);
+    enumerate_value(obj.bInheritHandle, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkExportFenceWin32HandleInfoKHR>(const VkExportFenceWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_pointer(obj.pAttributes, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pAttributes, callback);
+    enumerate_value(obj.dwAccess, callback);
+    enumerate_pointer(obj.name, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkExportMemoryWin32HandleInfoKHR>(const VkExportMemoryWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_pointer(obj.pAttributes, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pAttributes, callback);
+    enumerate_value(obj.dwAccess, callback);
+    enumerate_pointer(obj.name, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkExportMemoryWin32HandleInfoNV>(const VkExportMemoryWin32HandleInfoNV& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_pointer(obj.pAttributes, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pAttributes, callback);
+    enumerate_value(obj.dwAccess, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkExportSemaphoreWin32HandleInfoKHR>(const VkExportSemaphoreWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_pointer(obj.pAttributes, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pAttributes, callback);
+    enumerate_value(obj.dwAccess, callback);
+    enumerate_pointer(obj.name, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkImportFenceWin32HandleInfoKHR>(const VkImportFenceWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.fence, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.handleType, callback);
+    enumerate_host_pointer(obj.handle, callback);
+    enumerate_pointer(obj.name, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkImportMemoryWin32HandleInfoKHR>(const VkImportMemoryWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.handleType, callback);
+    enumerate_host_pointer(obj.handle, callback);
+    enumerate_pointer(obj.name, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkImportMemoryWin32HandleInfoNV>(const VkImportMemoryWin32HandleInfoNV& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.handleType, callback);
+    enumerate_host_pointer(obj.handle, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkImportSemaphoreWin32HandleInfoKHR>(const VkImportSemaphoreWin32HandleInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.semaphore, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.handleType, callback);
+    enumerate_host_pointer(obj.handle, callback);
+    enumerate_pointer(obj.name, callback);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+////////////////////////////////////////////////////////////////////////////////
+// Video encode/decode
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoBeginCodingInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoCapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoCodingControlInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeAV1CapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeAV1DpbSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeAV1PictureInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeAV1ProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeAV1SessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeCapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264CapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264DpbSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264PictureInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264ProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264SessionParametersAddInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH264SessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265CapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265DpbSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265PictureInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265ProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265SessionParametersAddInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeH265SessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoDecodeUsageInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeCapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264CapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264DpbSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264FrameSizeKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264GopRemainingFrameInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264NaluSliceInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264PictureInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264ProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264QpKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264QualityLevelPropertiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264RateControlInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264RateControlLayerInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264SessionCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264SessionParametersAddInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264SessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264SessionParametersFeedbackInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH264SessionParametersGetInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265CapabilitiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265DpbSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265FrameSizeKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265GopRemainingFrameInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265NaluSliceSegmentInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265PictureInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265ProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265QpKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265QualityLevelPropertiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265RateControlInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265RateControlLayerInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265SessionCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265SessionParametersAddInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265SessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265SessionParametersFeedbackInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeH265SessionParametersGetInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeQualityLevelInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeQualityLevelPropertiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeRateControlInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeRateControlLayerInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeSessionParametersFeedbackInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeSessionParametersGetInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEncodeUsageInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoEndCodingInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoFormatPropertiesKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoInlineQueryInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoPictureResourceInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoProfileInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoProfileListInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoReferenceSlotInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoSessionCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoSessionMemoryRequirementsKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoSessionParametersCreateInfoKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkVideoSessionParametersUpdateInfoKHR)
+
+////////////////////////////////////////////////////////////////////////////////
+// Special case members
+template <>
+void enumerate_structure_pointers<VkAccelerationStructureBuildGeometryInfoKHR>(const VkAccelerationStructureBuildGeometryInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.type, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.mode, callback);
+    enumerate_value(obj.srcAccelerationStructure, callback);
+    enumerate_value(obj.dstAccelerationStructure, callback);
+    enumerate_value(obj.geometryCount, callback);
+    enumerate_pointer(obj.pGeometries, callback);
+    enumerate_dynamic_structure_array_pointers(obj.geometryCount, obj.pGeometries, callback);
+    enumerate_pointer(obj.ppGeometries, callback);
+    enumerate_dynamic_structure_pointer_array_pointers(obj.geometryCount, obj.ppGeometries, callback);
+    enumerate_structure_pointers(obj.scratchData, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkAccelerationStructureTrianglesDisplacementMicromapNV>(const VkAccelerationStructureTrianglesDisplacementMicromapNV& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.displacementBiasAndScaleFormat, callback);
+    enumerate_value(obj.displacementVectorFormat, callback);
+    enumerate_structure_pointers(obj.displacementBiasAndScaleBuffer, callback);
+    enumerate_value(obj.displacementBiasAndScaleStride, callback);
+    enumerate_structure_pointers(obj.displacementVectorBuffer, callback);
+    enumerate_value(obj.displacementVectorStride, callback);
+    enumerate_structure_pointers(obj.displacedMicromapPrimitiveFlags, callback);
+    enumerate_value(obj.displacedMicromapPrimitiveFlagsStride, callback);
+    enumerate_value(obj.indexType, callback);
+    enumerate_structure_pointers(obj.indexBuffer, callback);
+    enumerate_value(obj.indexStride, callback);
+    enumerate_value(obj.baseTriangle, callback);
+    enumerate_value(obj.usageCountsCount, callback);
+    enumerate_pointer(obj.pUsageCounts, callback);
+    enumerate_dynamic_structure_array_pointers(obj.usageCountsCount, obj.pUsageCounts, callback);
+    enumerate_pointer(obj.ppUsageCounts, callback);
+    enumerate_dynamic_structure_pointer_array_pointers(obj.usageCountsCount, obj.ppUsageCounts, callback);
+    enumerate_value(obj.micromap, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkAccelerationStructureTrianglesOpacityMicromapEXT>(const VkAccelerationStructureTrianglesOpacityMicromapEXT& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.indexType, callback);
+    enumerate_structure_pointers(obj.indexBuffer, callback);
+    enumerate_value(obj.indexStride, callback);
+    enumerate_value(obj.baseTriangle, callback);
+    enumerate_value(obj.usageCountsCount, callback);
+    enumerate_pointer(obj.pUsageCounts, callback);
+    enumerate_dynamic_structure_array_pointers(obj.usageCountsCount, obj.pUsageCounts, callback);
+    enumerate_pointer(obj.ppUsageCounts, callback);
+    enumerate_dynamic_structure_pointer_array_pointers(obj.usageCountsCount, obj.ppUsageCounts, callback);
+    enumerate_value(obj.micromap, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkAccelerationStructureVersionInfoKHR>(const VkAccelerationStructureVersionInfoKHR& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    // NOTE : pVersionData isn't deep copied, see create_structure_copy<VkAccelerationStructureVersionInfoKHR>()
+    enumerate_host_pointer(obj.pVersionData, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkMicromapBuildInfoEXT>(const VkMicromapBuildInfoEXT& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.type, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.mode, callback);
+    enumerate_value(obj.dstMicromap, callback);
+    enumerate_value(obj.usageCountsCount, callback);
+    enumerate_pointer(obj.pUsageCounts, callback);
+    enumerate_dynamic_structure_array_pointers(obj.usageCountsCount, obj.pUsageCounts, callback);
+    enumerate_pointer(obj.ppUsageCounts, callback);
+    enumerate_dynamic_structure_pointer_array_pointers(obj.usageCountsCount, obj.ppUsageCounts, callback);
+    enumerate_structure_pointers(obj.data, callback);
+    enumerate_structure_pointers(obj.scratchData, callback);
+    enumerate_structure_pointers(obj.triangleArray, callback);
+    enumerate_value(obj.triangleArrayStride, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkMicromapVersionInfoEXT>(const VkMicromapVersionInfoEXT& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    // NOTE : pVersionData isn't deep copied, see create_structure_copy<VkMicromapVersionInfoEXT>()
+    enumerate_host_pointer(obj.pVersionData, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkPipelineCacheCreateInfo>(const VkPipelineCacheCreateInfo& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.initialDataSize, callback);
+    enumerate_pointer(obj.pInitialData, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkPipelineMultisampleStateCreateInfo>(const VkPipelineMultisampleStateCreateInfo& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.rasterizationSamples, callback);
+    enumerate_value(obj.sampleShadingEnable, callback);
+    enumerate_value(obj.minSampleShading, callback);
+    enumerate_pointer(obj.pSampleMask, callback);
+    enumerate_value(obj.alphaToCoverageEnable, callback);
+    enumerate_value(obj.alphaToOneEnable, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkShaderCreateInfoEXT>(const VkShaderCreateInfoEXT& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.stage, callback);
+    enumerate_value(obj.nextStage, callback);
+    enumerate_value(obj.codeType, callback);
+    enumerate_value(obj.codeSize, callback);
+    enumerate_pointer(obj.pCode, callback);
+    enumerate_pointer(obj.pName, callback);
+    enumerate_value(obj.setLayoutCount, callback);
+    enumerate_pointer(obj.pSetLayouts, callback);
+    enumerate_value(obj.pushConstantRangeCount, callback);
+    enumerate_pointer(obj.pPushConstantRanges, callback);
+    enumerate_dynamic_structure_array_pointers(obj.pushConstantRangeCount, obj.pPushConstantRanges, callback);
+    enumerate_pointer(obj.pSpecializationInfo, callback);
+    enumerate_dynamic_structure_array_pointers(1, obj.pSpecializationInfo, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkShaderModuleCreateInfo>(const VkShaderModuleCreateInfo& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.flags, callback);
+    enumerate_value(obj.codeSize, callback);
+    enumerate_pointer(obj.pCode, callback);
+}
+
+template <>
+void enumerate_structure_pointers<VkSpecializationInfo>(const VkSpecializationInfo& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.mapEntryCount, callback);
+    enumerate_pointer(obj.pMapEntries, callback);
+    enumerate_dynamic_structure_array_pointers(obj.mapEntryCount, obj.pMapEntries, callback);
+    enumerate_value(obj.dataSize, callback);
+    enumerate_pointer(obj.pData, callback);
+}
+
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkTransformMatrixKHR)
+
+template <>
+void enumerate_structure_pointers<VkWriteDescriptorSet>(const VkWriteDescriptorSet& obj, const EnumeratePointersCallback& callback)
+{
+    callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+    enumerate_value(obj.sType, callback);
+    enumerate_pointer(obj.pNext, callback);
+    enumerate_pnext_pointers(obj.pNext, callback);
+    enumerate_value(obj.dstSet, callback);
+    enumerate_value(obj.dstBinding, callback);
+    enumerate_value(obj.dstArrayElement, callback);
+    enumerate_value(obj.descriptorCount, callback);
+    enumerate_value(obj.descriptorType, callback);
+    // NOTE : create_structure_copy<VkWriteDescriptorSet>() only copies the array
+    //  used by descriptorType and sets the others to nullptr.
+    enumerate_pointer(obj.pImageInfo, callback);
+    enumerate_dynamic_structure_array_pointers(obj.descriptorCount, obj.pImageInfo, callback);
+    enumerate_pointer(obj.pBufferInfo, callback);
+    enumerate_dynamic_structure_array_pointers(obj.descriptorCount, obj.pBufferInfo, callback);
+    enumerate_pointer(obj.pTexelBufferView, callback);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unions
+template <>
+void enumerate_structure_pointers<VkAccelerationStructureGeometryDataKHR>(const VkAccelerationStructureGeometryDataKHR& obj, const EnumeratePointersCallback& callback)
+{
+    switch (((const VkBaseInStructure&)obj).sType) {
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: {
+        callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+        enumerate_structure_pointers(obj.triangles, callback);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: {
+        callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+        enumerate_structure_pointers(obj.aabbs, callback);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: {
+        callback(EnumeratedMemberType::Structure, &obj, sizeof(obj));
+        enumerate_structure_pointers(obj.instances, callback);
+    } break;
+    default: {
+        enumerate_value(obj, callback);
+    } break;
+    }
+}
+
+// NOTE : VkDeviceOrHostAddressKHR and VkDeviceOrHostAddressConstKHR don't
+//  indicate which member is active, they're reported as values and expected to
+//  hold device addresses.
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkAccelerationStructureMotionInstanceDataNV)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkClearColorValue)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkClearValue)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkDeviceOrHostAddressConstKHR)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkDeviceOrHostAddressKHR)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkPerformanceCounterResultKHR)
+GVK_STUB_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkPerformanceValueDataINTEL)
+GVK_DEFINE_VALUE_ENUMERATE_STRUCTURE_POINTERS_DEFINITION(VkPipelineExecutableStatisticValueKHR)
+
+} // namespace detail
+} // namespace gvk
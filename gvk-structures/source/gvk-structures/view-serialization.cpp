@@ -0,0 +1,234 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/view-serialization.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <ostream>
+
+namespace gvk {
+namespace detail {
+
+/*
+
+    Views are written as a ViewHeader, followed by the structure and everything it
+    points to, followed by an array of relocations...
+
+        +------------+------------------------------------+-------------------+
+        | ViewHeader | structure | pNext | arrays | ...   | relocation offsets |
+        +------------+------------------------------------+-------------------+
+
+    Every relocation is the offset of a pointer in the data block.  Pointers are
+    written as offsets from the start of the data block, when a view is read its
+    pointers are fixed up by adding the address of the data block and the address
+    is recorded in ViewHeader::base.  If the view is read again at a different
+    address, pointers are fixed up by the difference between the addresses.
+
+    Relocations come from gvk::detail::enumerate_structure_pointers(), which is
+    generated from the same member metadata as create_structure_copy().  Bytes in
+    a structure that aren't covered by one of its members are padding and are
+    zeroed, pointers to memory that isn't deep copied with the structure are
+    written as nullptr.
+
+*/
+
+static constexpr uint64_t ViewMagic = 0x57454956534b5647; // "GVKSVIEW"
+static constexpr size_t ViewAlignment = 16;
+
+struct ViewHeader final
+{
+    uint64_t magic { };
+    uint64_t base { };
+    uint64_t dataSize { };
+    uint64_t relocationCount { };
+};
+
+ViewAllocator::ViewAllocator(uint8_t* pData, size_t size)
+    : mBumpAllocator(pData, size)
+{
+    assert(!((uintptr_t)pData % ViewAlignment));
+    mAllocationCallbacks.pUserData = this;
+    mAllocationCallbacks.pfnAllocation = [](void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope)
+    {
+        assert(pUserData);
+        return ((ViewAllocator*)pUserData)->allocate(size, alignment);
+    };
+    mAllocationCallbacks.pfnFree = [](void*, void*)
+    {
+    };
+}
+
+const VkAllocationCallbacks* ViewAllocator::get_allocation_callbacks() const
+{
+    return &mAllocationCallbacks;
+}
+
+void* ViewAllocator::allocate(size_t size, size_t alignment)
+{
+    // NOTE : gvk::detail::create_structure_copy() doesn't specify an alignment so
+    //  every allocation is aligned to ViewAlignment, keeping the layout identical
+    //  across copies regardless of where each block lives.
+    auto pMemory = mBumpAllocator.allocate(size, std::max(alignment, ViewAlignment));
+    if (!pMemory) {
+        mOverflowAllocations.push_back(std::make_unique<uint8_t[]>(size));
+        pMemory = mOverflowAllocations.back().get();
+    }
+    return pMemory;
+}
+
+size_t ViewAllocator::get_required_size() const
+{
+    return mBumpAllocator.get_used_size();
+}
+
+void serialize_view(std::ostream& ostrm, const std::function<void(ViewAllocator&, const EnumeratePointersCallback&)>& createCopy)
+{
+    assert(createCopy);
+
+    // NOTE : The first copy determines the size of the data block, if it doesn't
+    //  fit, it's made again with the required size.
+    std::vector<uint8_t> data(4096);
+    size_t requiredSize = 0;
+    {
+        ViewAllocator allocator(data.data(), data.size());
+        createCopy(allocator, [](EnumeratedMemberType, const void*, size_t) { });
+        requiredSize = allocator.get_required_size();
+    }
+
+    // NOTE : The data block is padded so that the relocations that follow it are
+    //  aligned.  Every byte that isn't written by the copy stays zeroed.
+    auto dataSize = (requiredSize + ViewAlignment - 1) & ~(ViewAlignment - 1);
+    data.assign(std::max(dataSize, data.size()), 0);
+
+    // NOTE : Members are only recorded while they're enumerated, pointers can't be
+    //  rewritten as offsets until enumeration is complete because enumeration
+    //  follows them.
+    std::vector<uint8_t> padding(data.size());
+    std::vector<uint64_t> relocations;
+    std::vector<uint64_t> hostPointers;
+    {
+        ViewAllocator allocator(data.data(), data.size());
+        createCopy(
+            allocator,
+            [&](EnumeratedMemberType memberType, const void* pMember, size_t size)
+            {
+                auto offset = (uintptr_t)pMember - (uintptr_t)data.data();
+                assert(offset < data.size() && size <= data.size() - offset && "gvk::detail::serialize_view() enumerated memory outside of the view");
+                if (offset < data.size() && size <= data.size() - offset) {
+                    switch (memberType) {
+                    case EnumeratedMemberType::Structure: {
+                        memset(padding.data() + offset, 1, size);
+                    } break;
+                    case EnumeratedMemberType::Value: {
+                        memset(padding.data() + offset, 0, size);
+                    } break;
+                    case EnumeratedMemberType::Pointer: {
+                        memset(padding.data() + offset, 0, size);
+                        relocations.push_back(offset);
+                    } break;
+                    case EnumeratedMemberType::HostPointer: {
+                        memset(padding.data() + offset, 0, size);
+                        hostPointers.push_back(offset);
+                    } break;
+                    default: {
+                        assert(false && "gvk::detail::EnumeratedMemberType unserviced; gvk maintenance required");
+                    } break;
+                    }
+                }
+            }
+        );
+        assert(allocator.get_required_size() == requiredSize);
+    }
+    data.resize(dataSize);
+    padding.resize(dataSize);
+
+    // Zero padding, null host pointers, and rewrite pointers as offsets into the
+    //  data block
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = padding[i] ? 0 : data[i];
+    }
+    for (auto offset : hostPointers) {
+        memset(data.data() + offset, 0, sizeof(uintptr_t));
+    }
+    auto base = (uintptr_t)data.data();
+    relocations.erase(
+        std::remove_if(
+            relocations.begin(),
+            relocations.end(),
+            [&](uint64_t offset)
+            {
+                uintptr_t value = 0;
+                memcpy(&value, data.data() + offset, sizeof(uintptr_t));
+                auto inView = value && base <= value && value - base <= data.size();
+                assert((!value || inView) && "gvk::detail::serialize_view() enumerated a pointer outside of the view");
+                value = inView ? value - base : 0;
+                memcpy(data.data() + offset, &value, sizeof(uintptr_t));
+                return !inView;
+            }
+        ),
+        relocations.end()
+    );
+    std::sort(relocations.begin(), relocations.end());
+
+    ViewHeader header { };
+    header.magic = ViewMagic;
+    header.dataSize = data.size();
+    header.relocationCount = relocations.size();
+    ostrm.write((const char*)&header, sizeof(header));
+    ostrm.write((const char*)data.data(), data.size());
+    ostrm.write((const char*)relocations.data(), relocations.size() * sizeof(uint64_t));
+}
+
+const void* deserialize_view(uint8_t* pData, size_t size)
+{
+    if (!pData || size < sizeof(ViewHeader)) {
+        return nullptr;
+    }
+    auto pHeader = (ViewHeader*)pData;
+    if (pHeader->magic != ViewMagic ||
+        pHeader->dataSize > size - sizeof(ViewHeader) ||
+        pHeader->relocationCount > (size - sizeof(ViewHeader) - pHeader->dataSize) / sizeof(uint64_t)) {
+        return nullptr;
+    }
+    assert(!((uintptr_t)pData % ViewAlignment) && "gvk::deserialize_view() requires data aligned to 16 bytes");
+    auto pViewData = pData + sizeof(ViewHeader);
+    auto base = (uint64_t)(uintptr_t)pViewData;
+    if (pHeader->base != base) {
+        auto pRelocations = (const uint64_t*)(pViewData + pHeader->dataSize);
+        for (uint64_t i = 0; i < pHeader->relocationCount; ++i) {
+            assert(pRelocations[i] + sizeof(uintptr_t) <= pHeader->dataSize);
+            auto pPointer = (uintptr_t*)(pViewData + pRelocations[i]);
+            *pPointer = *pPointer - (uintptr_t)pHeader->base + (uintptr_t)base;
+        }
+        pHeader->base = base;
+    }
+    return pViewData;
+}
+
+} // namespace detail
+} // namespace gvk
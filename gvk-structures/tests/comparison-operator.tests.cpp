@@ -36,6 +36,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gtest/gtest.h"
 
 #include <array>
+#include <map>
+#include <unordered_set>
 
 /*
 The following tests validate that generated comparison operators for Vulkan structures work correctly
@@ -54,6 +56,10 @@ Test cases cover the following:
     (special case members)
     VkPipelineMultisampleStateCreateInfo
     VkShaderModuleCreateInfo
+
+    (ordering and hashing)
+    Ordering
+    Hashing
 */
 
 TEST(ComparisonOperators, Basic)
@@ -406,3 +412,70 @@ TEST(ComparisonOperators, VkShaderModuleCreateInfo)
     shaderModuleCreateInfo1.codeSize /= 2;
     EXPECT_NE(shaderModuleCreateInfo0, shaderModuleCreateInfo1);
 }
+
+TEST(ComparisonOperators, Ordering)
+{
+    VkImageCreateInfo imageCreateInfo0{ };
+    std::array<uint32_t, 4> queueFamilyIndices0{ 1, 4, 6, 8 };
+    imageCreateInfo0.extent = { 256, 256, 1 };
+    imageCreateInfo0.queueFamilyIndexCount = (uint32_t)queueFamilyIndices0.size();
+    imageCreateInfo0.pQueueFamilyIndices = queueFamilyIndices0.data();
+
+    VkImageCreateInfo imageCreateInfo1 = imageCreateInfo0;
+    auto queueFamilyIndices1 = queueFamilyIndices0;
+    imageCreateInfo1.pQueueFamilyIndices = queueFamilyIndices1.data();
+    EXPECT_FALSE(imageCreateInfo0 < imageCreateInfo1);
+    EXPECT_FALSE(imageCreateInfo1 < imageCreateInfo0);
+    EXPECT_LE(imageCreateInfo0, imageCreateInfo1);
+    EXPECT_GE(imageCreateInfo0, imageCreateInfo1);
+
+    // Ordering is determined by the first member that differs...
+    queueFamilyIndices1.back() = 9;
+    EXPECT_LT(imageCreateInfo0, imageCreateInfo1);
+    EXPECT_GT(imageCreateInfo1, imageCreateInfo0);
+    imageCreateInfo0.extent.width = 512;
+    EXPECT_GT(imageCreateInfo0, imageCreateInfo1);
+
+    // ...and is consistent with equality when used as a key in ordered
+    //  containers.
+    std::map<VkExtent3D, uint32_t> extents;
+    extents[{ 1, 2, 3 }] = 0;
+    extents[{ 1, 2, 4 }] = 1;
+    extents[{ 1, 2, 3 }] = 2;
+    ASSERT_EQ(extents.size(), (size_t)2);
+    EXPECT_EQ(extents.begin()->second, 2);
+}
+
+TEST(ComparisonOperators, Hashing)
+{
+    // Structures with the same contents at different addresses must produce
+    //  the same hash...
+    VkImageCreateInfo imageCreateInfo0{ };
+    std::array<uint32_t, 4> queueFamilyIndices0{ 1, 4, 6, 8 };
+    imageCreateInfo0.queueFamilyIndexCount = (uint32_t)queueFamilyIndices0.size();
+    imageCreateInfo0.pQueueFamilyIndices = queueFamilyIndices0.data();
+
+    VkImageCreateInfo imageCreateInfo1 = imageCreateInfo0;
+    auto queueFamilyIndices1 = queueFamilyIndices0;
+    imageCreateInfo1.pQueueFamilyIndices = queueFamilyIndices1.data();
+    gvk::hash<VkImageCreateInfo> hash;
+    EXPECT_EQ(hash(imageCreateInfo0), hash(imageCreateInfo1));
+
+    std::unordered_set<VkImageCreateInfo, gvk::hash<VkImageCreateInfo>> imageCreateInfos;
+    imageCreateInfos.insert(imageCreateInfo0);
+    imageCreateInfos.insert(imageCreateInfo1);
+    EXPECT_EQ(imageCreateInfos.size(), (size_t)1);
+
+    // ...and structures that compare equal must hash equal even when their
+    //  floating point members differ in sign of zero.
+    auto samplerCreateInfo0 = gvk::get_default<VkSamplerCreateInfo>();
+    samplerCreateInfo0.mipLodBias = 0.0f;
+    auto samplerCreateInfo1 = samplerCreateInfo0;
+    samplerCreateInfo1.mipLodBias = -0.0f;
+    EXPECT_EQ(samplerCreateInfo0, samplerCreateInfo1);
+    EXPECT_EQ(gvk::hash<VkSamplerCreateInfo>()(samplerCreateInfo0), gvk::hash<VkSamplerCreateInfo>()(samplerCreateInfo1));
+
+    queueFamilyIndices1.back() = 9;
+    imageCreateInfos.insert(imageCreateInfo1);
+    EXPECT_EQ(imageCreateInfos.size(), (size_t)2);
+}
@@ -26,7 +26,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include "gvk-structures/auto.hpp"
 #include "gvk-structures/comparison-operators.hpp"
+#include "gvk-structures/convert.hpp"
 #include "gvk-structures/copy.hpp"
 #include "gvk-structures/serialization.hpp"
 #include "validate-structure-serialization.hpp"
@@ -40,6 +42,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <array>
 #include <cstdlib>
+#include <sstream>
 
 TEST(create_structure_copy, Basic)
 {
@@ -283,6 +286,142 @@ TEST(create_structure_copy, VkShaderModuleCreateInfo)
     gvk::detail::destroy_structure_copy(copy, &allocator.get_allocation_callbacks());
 }
 
+TEST(create_packed_structure_copy, SingleAllocation)
+{
+    std::array<float, 4> queuePriorities { 0.25f, 0.5f, 0.75f, 1.0f };
+    std::array<VkDeviceQueueCreateInfo, 2> deviceQueueCreateInfos { };
+    for (uint32_t i = 0; i < (uint32_t)deviceQueueCreateInfos.size(); ++i) {
+        deviceQueueCreateInfos[i].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        deviceQueueCreateInfos[i].queueFamilyIndex = i;
+        deviceQueueCreateInfos[i].queueCount = (uint32_t)queuePriorities.size();
+        deviceQueueCreateInfos[i].pQueuePriorities = queuePriorities.data();
+    }
+    std::array<const char*, 2> enabledExtensionNames { VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_MAINTENANCE_1_EXTENSION_NAME };
+    VkPhysicalDeviceFeatures enabledFeatures { };
+    enabledFeatures.samplerAnisotropy = VK_TRUE;
+    VkPhysicalDeviceVulkan12Features physicalDeviceVulkan12Features { };
+    physicalDeviceVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    physicalDeviceVulkan12Features.bufferDeviceAddress = VK_TRUE;
+    VkDeviceCreateInfo deviceCreateInfo { };
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.pNext = &physicalDeviceVulkan12Features;
+    deviceCreateInfo.queueCreateInfoCount = (uint32_t)deviceQueueCreateInfos.size();
+    deviceCreateInfo.pQueueCreateInfos = deviceQueueCreateInfos.data();
+    deviceCreateInfo.enabledExtensionCount = (uint32_t)enabledExtensionNames.size();
+    deviceCreateInfo.ppEnabledExtensionNames = enabledExtensionNames.data();
+    deviceCreateInfo.pEnabledFeatures = &enabledFeatures;
+
+    // All of the copy's deep members should be placed in a single allocation...
+    gvk::validation::Allocator allocator;
+    void* pMemory = nullptr;
+    auto copy = gvk::detail::create_packed_structure_copy(deviceCreateInfo, &allocator.get_allocation_callbacks(), &pMemory);
+    ASSERT_TRUE(pMemory);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)1);
+    EXPECT_EQ(deviceCreateInfo, copy);
+    auto size = gvk::detail::get_structure_copy_size(deviceCreateInfo);
+    auto isInAllocation = [&](const void* p) { return (const uint8_t*)pMemory <= (const uint8_t*)p && (const uint8_t*)p < (const uint8_t*)pMemory + size; };
+    EXPECT_TRUE(isInAllocation(copy.pNext));
+    EXPECT_TRUE(isInAllocation(copy.pQueueCreateInfos));
+    EXPECT_TRUE(isInAllocation(copy.pQueueCreateInfos[1].pQueuePriorities));
+    EXPECT_TRUE(isInAllocation(copy.ppEnabledExtensionNames));
+    EXPECT_TRUE(isInAllocation(copy.ppEnabledExtensionNames[1]));
+    EXPECT_TRUE(isInAllocation(copy.pEnabledFeatures));
+
+    // ...and destroying the copy should release that single allocation.
+    queuePriorities[3] = 0;
+    EXPECT_NE(deviceCreateInfo, copy);
+    gvk::detail::destroy_packed_structure_copy(pMemory, &allocator.get_allocation_callbacks());
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)0);
+}
+
+TEST(create_packed_structure_copy, NoDeepMembers)
+{
+    VkExtent3D extent3d { 256, 512, 1024 };
+    gvk::validation::Allocator allocator;
+    void* pMemory = nullptr;
+    auto copy = gvk::detail::create_packed_structure_copy(extent3d, &allocator.get_allocation_callbacks(), &pMemory);
+    EXPECT_FALSE(pMemory);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)0);
+    EXPECT_EQ(extent3d, copy);
+    gvk::detail::destroy_packed_structure_copy(pMemory, &allocator.get_allocation_callbacks());
+}
+
+TEST(Auto, CopyAndMove)
+{
+    std::array<uint32_t, 8> spirv { 8, 16, 32, 64, 128, 256, 512, 1024 };
+    VkShaderModuleCreateInfo shaderModuleCreateInfo { };
+    shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderModuleCreateInfo.codeSize = (uint32_t)spirv.size() * sizeof(uint32_t);
+    shaderModuleCreateInfo.pCode = spirv.data();
+    gvk::Auto<VkShaderModuleCreateInfo> autoShaderModuleCreateInfo0 = shaderModuleCreateInfo;
+    EXPECT_EQ(*autoShaderModuleCreateInfo0, shaderModuleCreateInfo);
+    EXPECT_NE(autoShaderModuleCreateInfo0->pCode, shaderModuleCreateInfo.pCode);
+    auto autoShaderModuleCreateInfo1 = autoShaderModuleCreateInfo0;
+    EXPECT_EQ(*autoShaderModuleCreateInfo1, shaderModuleCreateInfo);
+    EXPECT_NE(autoShaderModuleCreateInfo1->pCode, autoShaderModuleCreateInfo0->pCode);
+    auto pCode = autoShaderModuleCreateInfo1->pCode;
+    gvk::Auto<VkShaderModuleCreateInfo> autoShaderModuleCreateInfo2 = std::move(autoShaderModuleCreateInfo1);
+    EXPECT_EQ(autoShaderModuleCreateInfo2->pCode, pCode);
+    EXPECT_EQ(autoShaderModuleCreateInfo1->pCode, nullptr);
+    autoShaderModuleCreateInfo2 = std::move(autoShaderModuleCreateInfo0);
+    EXPECT_EQ(*autoShaderModuleCreateInfo2, shaderModuleCreateInfo);
+}
+
+TEST(Auto, DeserializeAndConvert)
+{
+    std::array<VkAttachmentDescription2, 2> attachmentDescriptions { };
+    for (auto& attachmentDescription : attachmentDescriptions) {
+        attachmentDescription.sType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
+        attachmentDescription.format = VK_FORMAT_B8G8R8A8_UNORM;
+        attachmentDescription.samples = VK_SAMPLE_COUNT_1_BIT;
+    }
+    attachmentDescriptions[1].format = VK_FORMAT_D32_SFLOAT;
+    VkAttachmentReference2 colorAttachmentReference { };
+    colorAttachmentReference.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
+    colorAttachmentReference.attachment = 0;
+    colorAttachmentReference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    VkAttachmentReference2 depthAttachmentReference { };
+    depthAttachmentReference.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
+    depthAttachmentReference.attachment = 1;
+    depthAttachmentReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    VkSubpassDescription2 subpassDescription { };
+    subpassDescription.sType = VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2;
+    subpassDescription.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpassDescription.colorAttachmentCount = 1;
+    subpassDescription.pColorAttachments = &colorAttachmentReference;
+    subpassDescription.pDepthStencilAttachment = &depthAttachmentReference;
+    VkRenderPassCreateInfo2 renderPassCreateInfo { };
+    renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2;
+    renderPassCreateInfo.attachmentCount = (uint32_t)attachmentDescriptions.size();
+    renderPassCreateInfo.pAttachments = attachmentDescriptions.data();
+    renderPassCreateInfo.subpassCount = 1;
+    renderPassCreateInfo.pSubpasses = &subpassDescription;
+
+    // Auto<> structures produced by deserialize() and convert() should be packed
+    //  in a single allocation and should release everything they allocate...
+    gvk::validation::Allocator allocator;
+    {
+        std::stringstream strStrm(std::ios::binary | std::ios::in | std::ios::out);
+        gvk::serialize(strStrm, renderPassCreateInfo);
+        gvk::Auto<VkRenderPassCreateInfo2> deserialized;
+        gvk::deserialize(strStrm, &allocator.get_allocation_callbacks(), deserialized);
+        EXPECT_EQ(*deserialized, renderPassCreateInfo);
+        EXPECT_EQ(allocator.get_allocation_count(), (size_t)1);
+
+        auto converted = gvk::convert<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(*deserialized, &allocator.get_allocation_callbacks());
+        EXPECT_EQ(allocator.get_allocation_count(), (size_t)2);
+        ASSERT_EQ(converted->attachmentCount, renderPassCreateInfo.attachmentCount);
+        EXPECT_EQ(converted->pAttachments[1].format, VK_FORMAT_D32_SFLOAT);
+        ASSERT_TRUE(converted->pSubpasses[0].pDepthStencilAttachment);
+        EXPECT_EQ(converted->pSubpasses[0].pDepthStencilAttachment->attachment, 1u);
+
+        auto roundTripped = gvk::convert<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(*converted, &allocator.get_allocation_callbacks());
+        EXPECT_EQ(allocator.get_allocation_count(), (size_t)3);
+        EXPECT_EQ(*roundTripped, renderPassCreateInfo);
+    }
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)0);
+}
+
 template <typename StructureType, typename FieldType, typename ModifyFieldFunctionType>
 inline bool modify_validate_revert(const StructureType& lhs, const StructureType& rhs, FieldType& field, ModifyFieldFunctionType modifyField)
 {
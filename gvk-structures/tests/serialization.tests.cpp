@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-structures/defaults.hpp"
 #include "gvk-structures/serialization.hpp"
 #include "gvk-structures/to-string.hpp"
+#include "gvk-structures/view-serialization.hpp"
 #include "validate-structure-serialization.hpp"
 
 #ifdef VK_USE_PLATFORM_XLIB_KHR
@@ -37,7 +38,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <sstream>
 
 /*
@@ -54,6 +57,9 @@ Test cases cover the following:
     Structures with dynamic array members of structures with dynamic array members
     Structures with pointers to structures
 
+    Arrays of flat structures
+    Relocatable views
+
     (special case members)
     VkPipelineMultisampleStateCreateInfo
     VkShaderModuleCreateInfo
@@ -154,6 +160,60 @@ TEST(Serialization, StructureWithDynamicallySizedArrayMember)
     gvk::validation::validate_structure_serialization(imageCreateInfo);
 }
 
+TEST(Serialization, FlatCerealizationTraits)
+{
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<uint32_t>::value);
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<VkFormat>::value);
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<VkBufferCopy>::value);
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<VkRect2D>::value);
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<VkViewport>::value);
+    EXPECT_TRUE(gvk::detail::IsFlatCerealizable<VkAccelerationStructureInstanceKHR>::value);
+    EXPECT_FALSE(gvk::detail::IsFlatCerealizable<VkBufferCreateInfo>::value);
+    EXPECT_FALSE(gvk::detail::IsFlatCerealizable<VkClearValue>::value);
+    EXPECT_FALSE(gvk::detail::IsFlatCerealizable<VkDescriptorBufferInfo>::value);
+    EXPECT_FALSE(gvk::detail::IsFlatCerealizable<VkMemoryHeap>::value);
+}
+
+TEST(Serialization, StructureWithDynamicallySizedFlatArrayMember)
+{
+    std::array<VkBufferCopy, 3> regions { };
+    for (size_t i = 0; i < regions.size(); ++i) {
+        regions[i].srcOffset = i * 3;
+        regions[i].dstOffset = i * 3 + 1;
+        regions[i].size = i * 3 + 2;
+    }
+
+    // Arrays of flat structures should be byte for byte identical to member-wise
+    //  cerealization...
+    std::stringstream bulk(std::ios::binary | std::ios::in | std::ios::out);
+    std::stringstream memberwise(std::ios::binary | std::ios::in | std::ios::out);
+    {
+        cereal::BinaryOutputArchive archive(bulk);
+        gvk::detail::cerealize_dynamic_array(archive, regions.size(), regions.data());
+    }
+    {
+        cereal::BinaryOutputArchive archive(memberwise);
+        archive(regions.size());
+        for (const auto& region : regions) {
+            archive(region.srcOffset, region.dstOffset, region.size);
+        }
+    }
+    EXPECT_EQ(bulk.str(), memberwise.str());
+
+    std::array<VkViewport, 2> viewports { };
+    viewports[0] = { 0, 0, 1280, 720, 0, 1 };
+    viewports[1] = { 1280, 0, 640, 360, 0, 1 };
+    std::array<VkRect2D, 2> scissors { };
+    scissors[0] = { { 0, 0 }, { 1280, 720 } };
+    scissors[1] = { { 1280, 0 }, { 640, 360 } };
+    auto pipelineViewportStateCreateInfo = gvk::get_default<VkPipelineViewportStateCreateInfo>();
+    pipelineViewportStateCreateInfo.viewportCount = (uint32_t)viewports.size();
+    pipelineViewportStateCreateInfo.pViewports = viewports.data();
+    pipelineViewportStateCreateInfo.scissorCount = (uint32_t)scissors.size();
+    pipelineViewportStateCreateInfo.pScissors = scissors.data();
+    gvk::validation::validate_structure_serialization(pipelineViewportStateCreateInfo);
+}
+
 TEST(Serialization, StructureWithStaticallySizedStringMember)
 {
     VkPhysicalDeviceProperties intelHD530Properties{ };
@@ -258,3 +318,93 @@ TEST(Serialization, VkShaderModuleCreateInfo)
     shaderModuleCreateInfo.pCode = spirv.data();
     gvk::validation::validate_structure_serialization(shaderModuleCreateInfo);
 }
+
+TEST(Serialization, View)
+{
+    std::array<const char*, 2> enabledLayerNames {
+        "VK_LAYER_KHRONOS_validation",
+        "VK_LAYER_INTEL_gvk_state_tracker",
+    };
+    std::array<VkValidationFeatureEnableEXT, 2> enabledValidationFeatures {
+        VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT,
+        VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT,
+    };
+    auto validationFeatures = gvk::get_default<VkValidationFeaturesEXT>();
+    validationFeatures.enabledValidationFeatureCount = (uint32_t)enabledValidationFeatures.size();
+    validationFeatures.pEnabledValidationFeatures = enabledValidationFeatures.data();
+    auto applicationInfo = gvk::get_default<VkApplicationInfo>();
+    applicationInfo.pApplicationName = "gvk-structures.tests";
+    auto instanceCreateInfo = gvk::get_default<VkInstanceCreateInfo>();
+    instanceCreateInfo.pNext = &validationFeatures;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    instanceCreateInfo.enabledLayerCount = (uint32_t)enabledLayerNames.size();
+    instanceCreateInfo.ppEnabledLayerNames = enabledLayerNames.data();
+
+    std::stringstream strStrm(std::ios::binary | std::ios::in | std::ios::out);
+    gvk::serialize_view(strStrm, instanceCreateInfo);
+    auto serialized = strStrm.str();
+    struct alignas(16) Block final
+    {
+        uint8_t bytes[16];
+    };
+    std::vector<Block> blocks((serialized.size() + sizeof(Block) - 1) / sizeof(Block));
+    memcpy(blocks.data(), serialized.data(), serialized.size());
+
+    // Views should be readable in place, and readable again after being moved...
+    auto pView = gvk::deserialize_view<VkInstanceCreateInfo>((uint8_t*)blocks.data(), serialized.size());
+    ASSERT_NE(pView, nullptr);
+    EXPECT_LT((const uint8_t*)pView->pApplicationInfo->pApplicationName - (const uint8_t*)blocks.data(), (ptrdiff_t)serialized.size());
+    EXPECT_EQ(*pView, instanceCreateInfo);
+    auto movedBlocks = blocks;
+    pView = gvk::deserialize_view<VkInstanceCreateInfo>((uint8_t*)movedBlocks.data(), serialized.size());
+    ASSERT_NE(pView, nullptr);
+    EXPECT_EQ(*pView, instanceCreateInfo);
+
+    // Data that isn't a view should be rejected...
+    EXPECT_EQ(gvk::deserialize_view<VkInstanceCreateInfo>((uint8_t*)movedBlocks.data(), 8), nullptr);
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL debug_utils_messenger_callback(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT, const VkDebugUtilsMessengerCallbackDataEXT*, void*)
+{
+    return VK_FALSE;
+}
+
+TEST(Serialization, ViewHostPointersAndPadding)
+{
+    // NOTE : The structure is filled with 0xFF so that its padding (between sType
+    //  and pNext) would be written as 0xFF if it weren't zeroed.
+    int userData = 0;
+    VkDebugUtilsMessengerCreateInfoEXT debugUtilsMessengerCreateInfo;
+    memset(&debugUtilsMessengerCreateInfo, 0xFF, sizeof(debugUtilsMessengerCreateInfo));
+    debugUtilsMessengerCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+    debugUtilsMessengerCreateInfo.pNext = nullptr;
+    debugUtilsMessengerCreateInfo.flags = 0;
+    debugUtilsMessengerCreateInfo.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debugUtilsMessengerCreateInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    debugUtilsMessengerCreateInfo.pfnUserCallback = debug_utils_messenger_callback;
+    debugUtilsMessengerCreateInfo.pUserData = &userData;
+
+    std::stringstream strStrm(std::ios::binary | std::ios::in | std::ios::out);
+    gvk::serialize_view(strStrm, debugUtilsMessengerCreateInfo);
+    auto serialized = strStrm.str();
+    struct alignas(16) Block final
+    {
+        uint8_t bytes[16];
+    };
+    std::vector<Block> blocks((serialized.size() + sizeof(Block) - 1) / sizeof(Block));
+    memcpy(blocks.data(), serialized.data(), serialized.size());
+
+    // Host pointers shouldn't be written or relocated, and padding should be zeroed...
+    uint64_t relocationCount = 0;
+    memcpy(&relocationCount, serialized.data() + 3 * sizeof(uint64_t), sizeof(relocationCount));
+    EXPECT_EQ(relocationCount, (uint64_t)0);
+    auto pView = gvk::deserialize_view<VkDebugUtilsMessengerCreateInfoEXT>((uint8_t*)blocks.data(), serialized.size());
+    ASSERT_NE(pView, nullptr);
+    EXPECT_EQ(pView->messageSeverity, debugUtilsMessengerCreateInfo.messageSeverity);
+    EXPECT_EQ(pView->messageType, debugUtilsMessengerCreateInfo.messageType);
+    EXPECT_EQ(pView->pfnUserCallback, nullptr);
+    EXPECT_EQ(pView->pUserData, nullptr);
+    auto pPaddingBegin = (const uint8_t*)pView + sizeof(VkStructureType);
+    auto pPaddingEnd = (const uint8_t*)pView + offsetof(VkDebugUtilsMessengerCreateInfoEXT, pNext);
+    EXPECT_TRUE(std::all_of(pPaddingBegin, pPaddingEnd, [](uint8_t byte) { return byte == 0; }));
+}
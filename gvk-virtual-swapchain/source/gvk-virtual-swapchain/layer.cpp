@@ -923,7 +923,7 @@ namespace layer {
 
 void on_load(Registry& registry)
 {
-    registry.layers.push_back(std::make_unique<virtual_swapchain::Layer>());
+    registry.add_layer<virtual_swapchain::Layer>();
 }
 
 } // namespace layer
@@ -103,14 +103,16 @@ public:
 //  loader as a single layer, this is useful for configuring functionality
 //  without requiring enable/disable logic be built directly into layers.  If
 //  multiple different layers are required at the loader level, a CMake target
-//  should be created for each individually.
+//  should be created for each individually.  Layers registered with
+//  Registry::add_layer<>() record which hooks they override, Vulkan API calls
+//  that no registered layer hooks are passed directly down the layer chain.
 // NOTE : pre API call hooks are run in the order registered, post API call
 //  hooks are run in the opposite order, for example:
 //
 //      If the following layers were registered in on_load()...
-//          registry.layers.push_back(std::make_unique<FooLayer>());
-//          registry.layers.push_back(std::make_unique<BarLayer>());
-//          registry.layers.push_back(std::make_unique<BazLayer>());
+//          registry.add_layer<FooLayer>();
+//          registry.add_layer<BarLayer>();
+//          registry.add_layer<BazLayer>();
 //
 //      API call vkCreateDevice() will result in the following call order...
 //          FooLayer::pre_vkCreateDevice()
@@ -125,7 +127,7 @@ namespace layer {
 
 void on_load(Registry& registry)
 {
-    registry.layers.push_back(std::make_unique<GvkSampleLayer>());
+    registry.add_layer<GvkSampleLayer>();
 }
 
 } // namespace layer